@@ -7,6 +7,7 @@
 #define KAGOME_CUSTOM_JSON_WRITER_HPP
 
 #include <jsonrpc-lean/json.h>
+#include <jsonrpc-lean/jsonformathandler.h>
 #include <jsonrpc-lean/jsonformatteddata.h>
 #include <jsonrpc-lean/util.h>
 #include <jsonrpc-lean/value.h>
@@ -149,8 +150,9 @@ namespace kagome::api {
       // Empty
     }
 
+    /// Binary values carry pre-serialized JSON (see raw_json.hpp)
     void WriteBinary(const char *data, size_t size) override {
-      myRequestData->Writer.String(data, size, true);
+      myRequestData->Writer.RawValue(data, size, rapidjson::kObjectType);
     }
 
     void WriteNull() override {
@@ -202,6 +204,17 @@ namespace kagome::api {
     std::shared_ptr<jsonrpc::JsonFormattedData> myRequestData;
   };
 
+  /**
+   * Json format handler, which writes responses with custom JsonWriter, so
+   * that pre-serialized results are emitted as they are.
+   */
+  class JsonFormatHandler final : public jsonrpc::JsonFormatHandler {
+   public:
+    std::unique_ptr<jsonrpc::Writer> CreateWriter() override {
+      return std::make_unique<JsonWriter>();
+    }
+  };
+
 }  // namespace kagome::api
 
 #endif  // KAGOME_CUSTOM_JSON_WRITER_HPP
@@ -12,6 +12,7 @@
 #include <memory>
 #include <type_traits>
 
+#include "api/jrpc/raw_json.hpp"
 #include "api/jrpc/value_converter.hpp"
 
 namespace kagome::api {
@@ -47,6 +48,8 @@ namespace kagome::api {
 
       if constexpr (std::is_same_v<decltype(result.value()), void>) {
         return {};
+      } else if constexpr (kRawJsonResult<RequestType>) {
+        return makeRawJson(result.value());
       } else {
         return makeValue(result.value());
       }
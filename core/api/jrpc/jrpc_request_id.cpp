@@ -0,0 +1,106 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/jrpc/jrpc_request_id.hpp"
+
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+namespace kagome::api {
+  /**
+   * Parses jsonrpc request until top level "id" member.
+   * Scalar value of the member is written to buffer.
+   */
+  struct IdParser {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+    size_t level = 0;
+    bool is_id = false;
+    bool found = false;
+
+    bool parse(std::string_view request) {
+      rapidjson::MemoryStream stream{request.data(), request.size()};
+      rapidjson::Reader reader;
+      reader.Parse(stream, *this);
+      return found;
+    }
+
+    /// @return false to stop parsing, when id is written
+    template <typename F>
+    bool scalar(F &&write) {
+      if (level == 1 and is_id) {
+        found = std::forward<F>(write)();
+        return false;
+      }
+      return true;
+    }
+    bool Null() {
+      return scalar([&] { return writer.Null(); });
+    }
+    bool Bool(bool b) {
+      return scalar([&] { return writer.Bool(b); });
+    }
+    bool Int(int i) {
+      return scalar([&] { return writer.Int(i); });
+    }
+    bool Uint(unsigned u) {
+      return scalar([&] { return writer.Uint(u); });
+    }
+    bool Int64(int64_t i) {
+      return scalar([&] { return writer.Int64(i); });
+    }
+    bool Uint64(uint64_t u) {
+      return scalar([&] { return writer.Uint64(u); });
+    }
+    bool Double(double d) {
+      return scalar([&] { return writer.Double(d); });
+    }
+    bool RawNumber(const char *str, size_t length, bool copy) {
+      return scalar([&] { return writer.RawNumber(str, length, copy); });
+    }
+    bool String(const char *str, size_t length, bool copy) {
+      return scalar([&] { return writer.String(str, length, copy); });
+    }
+    bool Key(const char *str, size_t length, bool) {
+      if (level == 1) {
+        is_id = std::string_view(str, length) == "id";
+      }
+      return true;
+    }
+    bool StartArray() {
+      // batch request or invalid id
+      if (level == 0 or (level == 1 and is_id)) {
+        return false;
+      }
+      ++level;
+      return true;
+    }
+    bool EndArray(size_t) {
+      --level;
+      return true;
+    }
+    bool StartObject() {
+      // invalid id
+      if (level == 1 and is_id) {
+        return false;
+      }
+      ++level;
+      return true;
+    }
+    bool EndObject(size_t) {
+      --level;
+      return true;
+    }
+  };
+
+  std::string jrpcRequestId(std::string_view request) {
+    IdParser parser;
+    if (not parser.parse(request)) {
+      return "null";
+    }
+    return {parser.buffer.GetString(), parser.buffer.GetSize()};
+  }
+}  // namespace kagome::api
@@ -0,0 +1,22 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_API_JRPC_REQUEST_ID_HPP
+#define KAGOME_API_JRPC_REQUEST_ID_HPP
+
+#include <string>
+#include <string_view>
+
+namespace kagome::api {
+  /**
+   * Extracts id of single jsonrpc request without building the request.
+   * Parsing stops as soon as id is found.
+   * @return id serialized to json, or "null" if id is not found or request is
+   * malformed or batch
+   */
+  std::string jrpcRequestId(std::string_view request);
+}  // namespace kagome::api
+
+#endif  // KAGOME_API_JRPC_REQUEST_ID_HPP
@@ -5,6 +5,12 @@
 
 #include "api/jrpc/jrpc_server_impl.hpp"
 
+#include <atomic>
+#include <chrono>
+
+#include <fmt/format.h>
+#include <jsonrpc-lean/fault.h>
+
 #include "api/jrpc/custom_json_writer.hpp"
 #include "api/jrpc/jrpc_handle_batch.hpp"
 
@@ -19,11 +25,14 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::api, JRpcServerImpl::Error, e) {
 
 namespace {
   constexpr auto rpcRequestsCountMetricName = "kagome_rpc_requests_count";
+  constexpr auto rpcCallTimeMetricName = "kagome_rpc_call_time";
+  constexpr auto rpcCallsRejectedMetricName = "kagome_rpc_calls_rejected";
 }
 
 namespace kagome::api {
 
-  JRpcServerImpl::JRpcServerImpl() {
+  JRpcServerImpl::JRpcServerImpl(const Configuration &config)
+      : config_{config} {
     // register json format handler
     jsonrpc_handler_.RegisterFormatHandler(format_handler_);
 
@@ -33,11 +42,66 @@ namespace kagome::api {
 
     metric_rpc_requests_count_ =
         metrics_registry_->registerCounterMetric(rpcRequestsCountMetricName);
+    metrics_registry_->registerHistogramFamily(
+        rpcCallTimeMetricName, "Time taken by calls of RPC methods");
+    metrics_registry_->registerCounterFamily(
+        rpcCallsRejectedMetricName,
+        "Number of RPC calls rejected due to concurrency limit of method");
+    metric_rpc_calls_rejected_ =
+        metrics_registry_->registerCounterMetric(rpcCallsRejectedMetricName);
   }
 
   void JRpcServerImpl::registerHandler(const std::string &name, Method method) {
+    auto limit = config_.max_concurrent_calls;
+    if (auto it = config_.method_concurrent_calls.find(name);
+        it != config_.method_concurrent_calls.end()) {
+      limit = it->second;
+    }
+    auto call_time = metrics_registry_->registerHistogramMetric(
+        rpcCallTimeMetricName,
+        {0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1, 5, 10, 30},
+        {{"method", name}});
+    auto calls = std::make_shared<std::atomic_size_t>(0);
+
+    Method limited_method =
+        [method{std::move(method)},
+         limit,
+         calls,
+         calls_lock{config_.calls_lock},
+         call_time,
+         rejected{metric_rpc_calls_rejected_},
+         name](const jsonrpc::Request::Parameters &params) mutable {
+          auto active = calls->fetch_add(1);
+          if (limit != 0 and active >= limit) {
+            calls->fetch_sub(1);
+            rejected->inc();
+            throw jsonrpc::Fault(
+                fmt::format("Too many simultaneous calls of {}", name),
+                kServerBusyCode);
+          }
+          std::shared_lock<std::shared_mutex> state_lock;
+          if (calls_lock != nullptr) {
+            state_lock = std::shared_lock{*calls_lock};
+          }
+          auto start = std::chrono::steady_clock::now();
+          auto finish = [&] {
+            call_time->observe(std::chrono::duration<double>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count());
+            calls->fetch_sub(1);
+          };
+          try {
+            auto result = method(params);
+            finish();
+            return result;
+          } catch (...) {
+            finish();
+            throw;
+          }
+        };
+
     auto &dispatcher = jsonrpc_handler_.GetDispatcher();
-    dispatcher.AddMethod(name, std::move(method));
+    dispatcher.AddMethod(name, std::move(limited_method));
   }
 
   std::vector<std::string> JRpcServerImpl::getHandlerNames() {
@@ -6,8 +6,12 @@
 #ifndef KAGOME_API_JRPC_SERVER_IMPL_HPP
 #define KAGOME_API_JRPC_SERVER_IMPL_HPP
 
+#include <shared_mutex>
+#include <unordered_map>
+
 #include <jsonrpc-lean/server.h>
 
+#include "api/jrpc/custom_json_writer.hpp"
 #include "api/jrpc/jrpc_server.hpp"
 #include "metrics/metrics.hpp"
 
@@ -19,12 +23,37 @@ namespace kagome::api {
       JSON_FORMAT_FAILED = 1,
     };
 
-    JRpcServerImpl();
+    /// Code of error returned to calls rejected by admission control
+    static constexpr int32_t kServerBusyCode = -32005;
+
+    struct Configuration {
+      /// Max number of simultaneous calls of each method, 0 means no limit
+      size_t max_concurrent_calls = 0;
+      /// Limits of simultaneous calls of particular methods, which override
+      /// the common one. Heavy methods are limited by default, so that they
+      /// can't occupy all threads of RPC pool. Both are set from
+      /// AppConfiguration, calls over a limit are rejected with
+      /// kServerBusyCode instead of waiting for a free slot
+      std::unordered_map<std::string, size_t> method_concurrent_calls{
+          {"state_queryStorage", 2},
+          {"state_queryStorageAt", 2},
+          {"state_getKeysPaged", 4},
+          {"childstate_getKeys", 4},
+          {"childstate_getKeysPaged", 4},
+          {"state_call", 4},
+      };
+      /// If set, calls hold it shared, so that state read by them can be
+      /// changed exclusively between calls (e.g. in read-only RPC mode)
+      std::shared_ptr<std::shared_mutex> calls_lock;
+    };
+
+    explicit JRpcServerImpl(const Configuration &config);
 
     ~JRpcServerImpl() override = default;
 
     /**
-     * @brief registers rpc request handler lambda
+     * @brief registers rpc request handler lambda, calls of which are limited
+     * in concurrency and timed
      * @param name rpc method name
      * @param method handler functor
      */
@@ -53,14 +82,17 @@ namespace kagome::api {
                          const FormatterHandler &cb) override;
 
    private:
+    const Configuration config_;
+
     /// json rpc server instance
     jsonrpc::Server jsonrpc_handler_{};
     /// format handler instance
-    jsonrpc::JsonFormatHandler format_handler_{};
+    JsonFormatHandler format_handler_{};
 
     // Metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
     metrics::Counter *metric_rpc_requests_count_;
+    metrics::Counter *metric_rpc_calls_rejected_;
   };
 
 }  // namespace kagome::api
@@ -0,0 +1,277 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_JRPC_RAW_JSON_HPP
+#define KAGOME_CORE_API_JRPC_RAW_JSON_HPP
+
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+#include <jsonrpc-lean/value.h>
+
+#include "api/service/state/state_api.hpp"
+#include "common/blob.hpp"
+#include "common/buffer.hpp"
+#include "common/hexutil.hpp"
+#include "primitives/block_data.hpp"
+#include "primitives/block_header.hpp"
+#include "primitives/digest.hpp"
+#include "primitives/extrinsic.hpp"
+#include "primitives/justification.hpp"
+#include "scale/scale.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Serializes RPC result straight to JSON text, without building a tree of
+   * jsonrpc::Value. Text is accumulated in a buffer owned by the thread, so
+   * its capacity is reused by following calls on the same thread.
+   * Result is passed to jsonrpc-lean as binary value, which is written
+   * verbatim by JsonWriter (see custom_json_writer.hpp).
+   * Output is the same as JsonWriter produces for makeValue() of the same
+   * object, keys of objects go in alphabetical order.
+   * Only one instance may exist on a thread at a time.
+   */
+  class RawJson {
+   public:
+    RawJson() : out_{buffer()} {
+      out_.clear();
+    }
+
+    RawJson(const RawJson &) = delete;
+    RawJson &operator=(const RawJson &) = delete;
+
+    /// Result of serialization, buffer is ready for the next one
+    jsonrpc::Value take() {
+      jsonrpc::Value value(std::string(out_), true);
+      out_.clear();
+      return value;
+    }
+
+    void raw(std::string_view json) {
+      out_.append(json);
+    }
+
+    void null() {
+      out_.append("null");
+    }
+
+    void integer(int64_t value) {
+      fmt::format_to(std::back_inserter(out_), "{}", value);
+    }
+
+    /// String with no characters to be escaped
+    void string(std::string_view value) {
+      out_.push_back('"');
+      out_.append(value);
+      out_.push_back('"');
+    }
+
+    /// Quoted hex with 0x prefix of concatenated {@param parts}
+    void hex(std::initializer_list<gsl::span<const uint8_t>> parts) {
+      size_t size = 0;
+      for (auto &part : parts) {
+        size += part.size();
+      }
+      auto pos = out_.size();
+      out_.resize(pos + 4 + 2 * size);
+      out_[pos++] = '"';
+      out_[pos++] = '0';
+      out_[pos++] = 'x';
+      for (auto &part : parts) {
+        common::hex_lower_to(part, out_.data() + pos);
+        pos += 2 * part.size();
+      }
+      out_[pos] = '"';
+    }
+
+    void hex(gsl::span<const uint8_t> bytes) {
+      hex({bytes});
+    }
+
+    /// Key of object member, preceded by comma unless {@param first}
+    void key(std::string_view name, bool first = false) {
+      if (not first) {
+        out_.push_back(',');
+      }
+      string(name);
+      out_.push_back(':');
+    }
+
+    void beginObject() {
+      out_.push_back('{');
+    }
+
+    void endObject() {
+      out_.push_back('}');
+    }
+
+    void beginArray() {
+      out_.push_back('[');
+    }
+
+    void endArray() {
+      out_.push_back(']');
+    }
+
+    void comma() {
+      out_.push_back(',');
+    }
+
+   private:
+    static std::string &buffer() {
+      thread_local std::string buffer;
+      return buffer;
+    }
+
+    std::string &out_;
+  };
+
+  inline void writeJson(RawJson &json, const common::Buffer &value) {
+    json.hex(value);
+  }
+
+  template <size_t N>
+  inline void writeJson(RawJson &json, const common::Blob<N> &value) {
+    json.hex(value);
+  }
+
+  /// Hex of SCALE encoding of extrinsic, i.e. its compact length and data
+  inline void writeJson(RawJson &json, const primitives::Extrinsic &value) {
+    auto encoded = primitives::encodeExtrinsic(value);
+    json.hex({encoded.length, encoded.data});
+  }
+
+  inline void writeJson(RawJson &json, const primitives::DigestItem &value) {
+    auto encoded = scale::encode(value);
+    if (not encoded.has_value()) {
+      throw jsonrpc::InternalErrorFault("Unable to encode arguments.");
+    }
+    json.hex(encoded.value());
+  }
+
+  inline void writeJson(RawJson &json,
+                        const primitives::Justification &value) {
+    json.raw("[[[70,82,78,75],[");
+    bool first = true;
+    for (auto byte : value.data) {
+      if (not first) {
+        json.comma();
+      }
+      first = false;
+      json.integer(byte);
+    }
+    json.raw("]]]");
+  }
+
+  template <typename T>
+  inline void writeJson(RawJson &json, const std::optional<T> &value) {
+    if (not value) {
+      json.null();
+      return;
+    }
+    writeJson(json, *value);
+  }
+
+  template <typename T>
+  inline void writeJson(RawJson &json, const std::vector<T> &values) {
+    json.beginArray();
+    bool first = true;
+    for (auto &value : values) {
+      if (not first) {
+        json.comma();
+      }
+      first = false;
+      writeJson(json, value);
+    }
+    json.endArray();
+  }
+
+  inline void writeJson(RawJson &json, const primitives::BlockHeader &value) {
+    json.beginObject();
+    json.key("digest", true);
+    json.beginObject();
+    json.key("logs", true);
+    writeJson(json, value.digest);
+    json.endObject();
+    json.key("extrinsicsRoot");
+    json.hex(value.extrinsics_root);
+    json.key("number");
+    json.string(fmt::format("{:#x}", value.number));
+    json.key("parentHash");
+    json.hex(value.parent_hash);
+    json.key("stateRoot");
+    json.hex(value.state_root);
+    json.endObject();
+  }
+
+  inline void writeJson(RawJson &json, const primitives::BlockData &value) {
+    json.beginObject();
+    json.key("block", true);
+    json.beginObject();
+    json.key("extrinsics", true);
+    writeJson(json, value.body);
+    json.key("header");
+    writeJson(json, value.header);
+    json.endObject();
+    json.key("justifications");
+    writeJson(json, value.justification);
+    json.endObject();
+  }
+
+  inline void writeJson(RawJson &json,
+                        const StateApi::StorageChangeSet &value) {
+    json.beginObject();
+    json.key("block", true);
+    json.hex(value.block);
+    json.key("changes");
+    json.beginArray();
+    bool first = true;
+    for (auto &change : value.changes) {
+      if (not first) {
+        json.comma();
+      }
+      first = false;
+      json.beginArray();
+      writeJson(json, change.key);
+      json.comma();
+      writeJson(json, change.data);
+      json.endArray();
+    }
+    json.endArray();
+    json.endObject();
+  }
+
+  /**
+   * Makes value of RPC result, which is serialized by writeJson() right away
+   */
+  template <typename T>
+  inline jsonrpc::Value makeRawJson(const T &value) {
+    RawJson json;
+    writeJson(json, value);
+    return json.take();
+  }
+
+  /**
+   * Whether result of \tparam Request is returned as pre-serialized JSON.
+   * Request opts in by `static constexpr bool kRawJsonResult = true;`
+   */
+  template <typename Request, typename = void>
+  constexpr bool kRawJsonResult = false;
+
+  template <typename Request>
+  constexpr bool kRawJsonResult<
+      Request,
+      std::void_t<decltype(Request::kRawJsonResult)>> =
+      Request::kRawJsonResult;
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_CORE_API_JRPC_RAW_JSON_HPP
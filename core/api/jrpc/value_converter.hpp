@@ -8,6 +8,7 @@
 
 #include <vector>
 
+#include <fmt/format.h>
 #include <jsonrpc-lean/value.h>
 #include <boost/range/adaptor/transformed.hpp>
 
@@ -186,9 +187,7 @@ namespace kagome::api {
   inline jsonrpc::Value makeValue(const primitives::BlockHeader &val) {
     jStruct data;
     data["parentHash"] = makeValue(common::hex_lower_0x(val.parent_hash));
-    std::stringstream stream;
-    stream << "0x" << std::hex << val.number;
-    data["number"] = makeValue(stream.str());
+    data["number"] = makeValue(fmt::format("{:#x}", val.number));
     data["stateRoot"] = makeValue(common::hex_lower_0x(val.state_root));
     data["extrinsicsRoot"] =
         makeValue(common::hex_lower_0x(val.extrinsics_root));
@@ -306,8 +305,16 @@ namespace kagome::api {
         });
   }
 
+  /// Hex of SCALE encoding of extrinsic (i.e. its length and data), written
+  /// right into the string, without intermediate encoded copy of data
   inline jsonrpc::Value makeValue(const primitives::Extrinsic &v) {
-    return common::hex_lower_0x(scale::encode(v.data).value());
+    auto encoded = primitives::encodeExtrinsic(v);
+    std::string hex(2 + 2 * encoded.size(), '0');
+    hex[1] = 'x';
+    common::hex_lower_to(encoded.length, hex.data() + 2);
+    common::hex_lower_to(encoded.data,
+                         hex.data() + 2 + 2 * encoded.length.size());
+    return hex;
   }
 
 }  // namespace kagome::api
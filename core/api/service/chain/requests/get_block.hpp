@@ -12,6 +12,9 @@ namespace kagome::api::chain::request {
 
   struct GetBlock final : details::RequestType<primitives::BlockData,
                                                std::optional<std::string>> {
+    /// Result is written by writeJson(), without tree of jsonrpc::Value
+    static constexpr bool kRawJsonResult = true;
+
     explicit GetBlock(std::shared_ptr<ChainApi> &api) : api_(api) {}
 
     outcome::result<primitives::BlockData> execute() override {
@@ -6,14 +6,19 @@
 #include "api/service/impl/api_service_impl.hpp"
 
 #include <boost/algorithm/string/replace.hpp>
+#include <boost/asio/post.hpp>
+#include <fmt/format.h>
 
+#include "api/jrpc/custom_json_writer.hpp"
 #include "api/jrpc/jrpc_processor.hpp"
+#include "api/jrpc/jrpc_request_id.hpp"
 #include "api/jrpc/jrpc_server.hpp"
 #include "api/jrpc/value_converter.hpp"
 #include "api/transport/listener.hpp"
 #include "application/app_state_manager.hpp"
 #include "blockchain/block_tree.hpp"
 #include "common/hexutil.hpp"
+#include "common/visitor.hpp"
 #include "primitives/common.hpp"
 #include "primitives/transaction.hpp"
 #include "storage/trie/trie_storage.hpp"
@@ -87,21 +92,67 @@ namespace {
                       response.error().message());
     });
   }
-  inline void sendEvent(std::shared_ptr<JRpcServer> server,
-                        std::shared_ptr<Session> session,
-                        kagome::log::Logger logger,
-                        uint32_t set_id,
-                        std::string_view name,
-                        jsonrpc::Value &&value) {
-    BOOST_ASSERT(session);
-    forJsonData(server,
-                logger,
-                set_id,
-                name,
-                std::move(value),
-                [session{std::move(session)}](const auto &response) {
-                  session->respond(response);
-                });
+
+  /// JSON text of {@param value}, to be written verbatim as binary value
+  jsonrpc::Value preformat(const jsonrpc::Value &value) {
+    JsonWriter writer;
+    value.Write(writer);
+    auto data = writer.GetData();
+    return jsonrpc::Value(std::string(data->GetData(), data->GetSize()), true);
+  }
+
+  /**
+   * Copies params of extrinsic event, which refer to data of the notifier, so
+   * that value of the event can be built later on another thread
+   */
+  std::function<jsonrpc::Value()> deferValue(
+      const kagome::primitives::events::ExtrinsicLifecycleEvent &event) {
+    using namespace kagome::primitives::events;
+    using Factory =
+        ExtrinsicLifecycleEvent (*)(SubscribedExtrinsicId, Hash256Span);
+    auto with_hash = [id{event.id}](Hash256Span span, Factory factory) {
+      kagome::common::Hash256 hash;
+      std::copy(span.begin(), span.end(), hash.begin());
+      return [id, hash, factory] {
+        return makeValue(factory(id, Hash256Span(hash.data(), hash.size())));
+      };
+    };
+    return kagome::visit_in_place(
+        event.params,
+        [&](std::nullopt_t) -> std::function<jsonrpc::Value()> {
+          return [event] { return makeValue(event); };
+        },
+        [&](const BroadcastEventParams &params)
+            -> std::function<jsonrpc::Value()> {
+          return [id{event.id},
+                  peers{std::vector<libp2p::peer::PeerId>(
+                      params.peers.begin(), params.peers.end())}] {
+            return makeValue(ExtrinsicLifecycleEvent::Broadcast(id, peers));
+          };
+        },
+        [&](const InBlockEventParams &params)
+            -> std::function<jsonrpc::Value()> {
+          return with_hash(params.block, &ExtrinsicLifecycleEvent::InBlock);
+        },
+        [&](const RetractedEventParams &params)
+            -> std::function<jsonrpc::Value()> {
+          return with_hash(params.retracted_block,
+                           &ExtrinsicLifecycleEvent::Retracted);
+        },
+        [&](const FinalityTimeoutEventParams &params)
+            -> std::function<jsonrpc::Value()> {
+          return with_hash(params.block,
+                           &ExtrinsicLifecycleEvent::FinalityTimeout);
+        },
+        [&](const FinalizedEventParams &params)
+            -> std::function<jsonrpc::Value()> {
+          return with_hash(params.block, &ExtrinsicLifecycleEvent::Finalized);
+        },
+        [&](const UsurpedEventParams &params)
+            -> std::function<jsonrpc::Value()> {
+          return with_hash(params.transaction_hash,
+                           &ExtrinsicLifecycleEvent::Usurped);
+        });
   }
 }  // namespace
 
@@ -115,6 +166,28 @@ namespace kagome::api {
 
   const std::string kRpcEventUpdateExtrinsic = "author_extrinsicUpdate";
 
+  /// Messages of errors for requests rejected by admission control
+  const std::string kRpcTooManyRequests = "Too many requests";
+  const std::string kRpcRequestExpired =
+      "Request waited for processing too long";
+
+  namespace {
+    /**
+     * Formats response to request rejected by admission control. Request is
+     * not processed, so only its id is extracted to be echoed back.
+     * @param request rejected request
+     * @param message error message
+     */
+    std::string rejectedResponse(std::string_view request,
+                                 std::string_view message) {
+      return fmt::format(
+          R"({{"jsonrpc":"2.0","error":{{"code":-32005,"message":"{}"}},)"
+          R"("id":{}}})",
+          message,
+          jrpcRequestId(request));
+    }
+  }  // namespace
+
   ApiServiceImpl::ApiServiceImpl(
       const std::shared_ptr<application::AppStateManager> &app_state_manager,
       std::shared_ptr<api::RpcThreadPool> thread_pool,
@@ -127,8 +200,10 @@ namespace kagome::api {
       std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
           extrinsic_event_key_repo,
       std::shared_ptr<blockchain::BlockTree> block_tree,
-      std::shared_ptr<storage::trie::TrieStorage> trie_storage)
-      : thread_pool_(std::move(thread_pool)),
+      std::shared_ptr<storage::trie::TrieStorage> trie_storage,
+      const Configuration &config)
+      : config_{config},
+        thread_pool_(std::move(thread_pool)),
         listeners_(std::move(listeners.listeners)),
         server_(std::move(server)),
         logger_{log::createLogger("ApiService", "api")},
@@ -141,6 +216,7 @@ namespace kagome::api {
     BOOST_ASSERT(thread_pool_);
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(trie_storage_);
+    BOOST_ASSERT(config_.requests_per_second > 0);
     BOOST_ASSERT(
         std::all_of(listeners_.cbegin(), listeners_.cend(), [](auto &listener) {
           return listener != nullptr;
@@ -164,12 +240,6 @@ namespace kagome::api {
           std::pair<common::Buffer, std::optional<common::Buffer>>>
           &key_value_pairs,
       const primitives::BlockHash &block) {
-    /// TODO(iceseer): PRE-475 make event notification depending
-    /// in packs blocks, to batch them in a single message Because
-    /// of a spec, we can send an array of changes in a single
-    /// message. We can receive here a pack of events and format
-    /// them in a single json message.
-
     jsonrpc::Value::Array changes;
     changes.reserve(key_value_pairs.size());
     for (auto &[key, value] : key_value_pairs) {
@@ -187,6 +257,18 @@ namespace kagome::api {
   }
 
   bool ApiServiceImpl::prepare() {
+    storage_changes_sub_ = std::make_shared<ChainEventSubscriber>(
+        subscription_engines_.chain, nullptr);
+    storage_changes_sub_->subscribe(
+        storage_changes_sub_->generateSubscriptionSetId(),
+        primitives::events::ChainEventType::kStorageChangesNotified);
+    storage_changes_sub_->setCallback(
+        [wp = weak_from_this()](auto, auto &, auto, const auto &) {
+          if (auto self = wp.lock()) {
+            self->flushStorageEvents();
+          }
+        });
+
     for (const auto &listener : listeners_) {
       auto on_new_session =
           [wp = weak_from_this()](const sptr<Session> &session) mutable {
@@ -231,6 +313,7 @@ namespace kagome::api {
   }
 
   void ApiServiceImpl::stop() {
+    storage_changes_sub_.reset();
     thread_pool_->stop();
     SL_DEBUG(logger_, "API Service stopped");
   }
@@ -249,7 +332,10 @@ namespace kagome::api {
                     subscription_engines_.chain, session),
                 .ext_sub = std::make_shared<ExtrinsicEventSubscriber>(
                     subscription_engines_.ext, session),
-                .messages = {}}));
+                .messages = {},
+                .strand = boost::asio::make_strand(thread_pool_->context()),
+                .request_tokens = static_cast<double>(config_.requests_burst),
+                .request_tokens_updated = std::chrono::steady_clock::now()}));
 
     BOOST_ASSERT(inserted);
     return it->second;
@@ -468,6 +554,68 @@ namespace kagome::api {
 
   void ApiServiceImpl::onSessionRequest(std::string_view request,
                                         std::shared_ptr<Session> session) {
+    auto received = std::chrono::steady_clock::now();
+
+    // TODO(kamilsa): remove that string replacement when
+    // https://github.com/soramitsu/kagome/issues/572 resolved
+    std::string str_request(request);
+    boost::replace_first(str_request, "\"params\":null", "\"params\":[null]");
+
+    auto process = [wp = weak_from_this(),
+                    request = std::move(str_request),
+                    session,
+                    received] {
+      if (auto self = wp.lock()) {
+        self->processRequest(request, session, received);
+      }
+    };
+
+    // Requests of websocket session are processed one by one in order of
+    // receiving, http session doesn't send next request until response
+    if (auto session_context = findSessionById(session->id())) {
+      if (not admitRequest(**session_context)) {
+        SL_DEBUG(logger_,
+                 "Request of session#{} is rejected due to rate limit",
+                 session->id());
+        session->respond(rejectedResponse(request, kRpcTooManyRequests));
+        return;
+      }
+      boost::asio::post((*session_context)->strand, std::move(process));
+    } else {
+      boost::asio::post(thread_pool_->context(), std::move(process));
+    }
+  }
+
+  bool ApiServiceImpl::admitRequest(SessionSubscriptions &session_context) {
+    auto now = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double>(
+                       now - session_context.request_tokens_updated)
+                       .count();
+    session_context.request_tokens_updated = now;
+    session_context.request_tokens =
+        std::min(session_context.request_tokens
+                     + elapsed * config_.requests_per_second,
+                 static_cast<double>(config_.requests_burst));
+    if (session_context.request_tokens < 1) {
+      return false;
+    }
+    session_context.request_tokens -= 1;
+    return true;
+  }
+
+  void ApiServiceImpl::processRequest(
+      const std::string &request,
+      const std::shared_ptr<Session> &session,
+      std::chrono::steady_clock::time_point received) {
+    if (std::chrono::steady_clock::now() - received
+        > config_.request_deadline) {
+      SL_DEBUG(logger_,
+               "Request of session#{} is expired in queue",
+               session->id());
+      session->respond(rejectedResponse(request, kRpcRequestExpired));
+      return;
+    }
+
     auto thread_session_auto_release = [](void *) {
       threaded_info.releaseSessionId();
     };
@@ -483,13 +631,8 @@ namespace kagome::api {
         thread_session_keeper(reinterpret_cast<void *>(0xff),
                               std::move(thread_session_auto_release));
 
-    // TODO(kamilsa): remove that string replacement when
-    // https://github.com/soramitsu/kagome/issues/572 resolved
-    std::string str_request(request);
-    boost::replace_first(str_request, "\"params\":null", "\"params\":[null]");
-
     // process new request
-    server_->processData(str_request, [&](std::string_view response) mutable {
+    server_->processData(request, [&](std::string_view response) mutable {
       // process response
       session->respond(response);
     });
@@ -517,12 +660,35 @@ namespace kagome::api {
                                       const Buffer &key,
                                       const std::optional<Buffer> &data,
                                       const common::Hash256 &block) {
-    sendEvent(server_,
-              session,
-              logger_,
-              set_id,
-              kRpcEventSubscribeStorage,
-              createStateStorageEvent({{key, data}}, block));
+    std::lock_guard guard(pending_storage_events_cs_);
+    auto &pending = pending_storage_events_[session->id()];
+    if (not pending.session) {
+      pending.session = session;
+      pending.block = block;
+    } else if (pending.block != block) {
+      // changes of another block must not be mixed in one message
+      for (auto &[id, changes] : pending.changes) {
+        sendStorageEvent(
+            pending.session, id, std::move(changes), pending.block);
+      }
+      pending.changes.clear();
+      pending.block = block;
+    }
+    pending.changes[set_id].emplace_back(key, data);
+  }
+
+  void ApiServiceImpl::flushStorageEvents() {
+    decltype(pending_storage_events_) pending_events;
+    {
+      std::lock_guard guard(pending_storage_events_cs_);
+      pending_events.swap(pending_storage_events_);
+    }
+    for (auto &[_, pending] : pending_events) {
+      for (auto &[set_id, changes] : pending.changes) {
+        sendStorageEvent(
+            pending.session, set_id, std::move(changes), pending.block);
+      }
+    }
   }
 
   void ApiServiceImpl::onChainEvent(
@@ -542,6 +708,7 @@ namespace kagome::api {
         name = kRpcEventRuntimeVersion;
       } break;
       case primitives::events::ChainEventType::kNewRuntime:
+      case primitives::events::ChainEventType::kStorageChangesNotified:
         return;
       default:
         BOOST_ASSERT(!"Unknown chain event");
@@ -550,7 +717,61 @@ namespace kagome::api {
 
     BOOST_ASSERT(!name.empty());
     sendEvent(
-        server_, session, logger_, set_id, name, api::makeValue(event_params));
+        session, set_id, name, sharedChainEvent(event_type, event_params));
+  }
+
+  ApiServiceImpl::SharedEventPtr ApiServiceImpl::sharedChainEvent(
+      primitives::events::ChainEventType event_type,
+      const primitives::events::ChainEventParams &event_params) {
+    using primitives::events::HeadsEventParams;
+    using primitives::events::RuntimeVersionEventParams;
+    std::lock_guard lock{last_chain_event_cs_};
+    // Sessions are notified one after another with the same params, so the
+    // event is shared if the params are equal to the last ones
+    bool same = last_chain_event_.has_value()
+            and last_chain_event_->type == event_type
+            and visit_in_place(
+                    event_params,
+                    [&](const HeadsEventParams &header) {
+                      auto last = boost::get<primitives::BlockHeader>(
+                          &last_chain_event_->params);
+                      return last != nullptr and *last == header.get();
+                    },
+                    [&](const RuntimeVersionEventParams &version) {
+                      auto last = boost::get<primitives::Version>(
+                          &last_chain_event_->params);
+                      return last != nullptr and *last == version.get();
+                    },
+                    [](const auto &) { return false; });
+    if (not same) {
+      auto params = visit_in_place(
+          event_params,
+          [](const HeadsEventParams &header)
+              -> decltype(LastChainEvent::params) { return header.get(); },
+          [](const RuntimeVersionEventParams &version)
+              -> decltype(LastChainEvent::params) { return version.get(); },
+          [](const auto &) -> decltype(LastChainEvent::params) {
+            BOOST_UNREACHABLE_RETURN({});
+          });
+      auto event = std::make_shared<SharedEvent>();
+      event->make_value = [params] {
+        return visit_in_place(
+            params, [](const auto &value) { return api::makeValue(value); });
+      };
+      last_chain_event_ = LastChainEvent{event_type, std::move(params), event};
+    }
+    return last_chain_event_->event;
+  }
+
+  void ApiServiceImpl::sendStorageEvent(const SessionPtr &session,
+                                        SubscriptionSetId set_id,
+                                        PendingStorageEvents::Changes changes,
+                                        const primitives::BlockHash &block) {
+    auto event = std::make_shared<SharedEvent>();
+    event->make_value = [changes{std::move(changes)}, block] {
+      return createStateStorageEvent(changes, block);
+    };
+    sendEvent(session, set_id, kRpcEventSubscribeStorage, std::move(event));
   }
 
   void ApiServiceImpl::onExtrinsicEvent(
@@ -558,12 +779,43 @@ namespace kagome::api {
       SessionPtr &session,
       primitives::events::SubscribedExtrinsicId ext_id,
       const primitives::events::ExtrinsicLifecycleEvent &params) {
-    sendEvent(server_,
-              session,
-              logger_,
-              set_id,
-              kRpcEventUpdateExtrinsic,
-              api::makeValue(params));
+    auto event = std::make_shared<SharedEvent>();
+    event->make_value = deferValue(params);
+    sendEvent(session, set_id, kRpcEventUpdateExtrinsic, std::move(event));
+  }
+
+  void ApiServiceImpl::sendEvent(const SessionPtr &session,
+                                 SubscriptionSetId set_id,
+                                 std::string_view name,
+                                 SharedEventPtr event) {
+    BOOST_ASSERT(session);
+    auto session_context = findSessionById(session->id());
+    if (not session_context) {
+      // session is already closed
+      return;
+    }
+    boost::asio::post(
+        (*session_context)->strand,
+        [server{server_},
+         logger{logger_},
+         session,
+         set_id,
+         name,
+         event{std::move(event)}] {
+          std::call_once(event->formatted, [&] {
+            event->json = preformat(event->make_value());
+            // params are not needed anymore
+            event->make_value = nullptr;
+          });
+          forJsonData(server,
+                      logger,
+                      set_id,
+                      name,
+                      jsonrpc::Value(event->json),
+                      [&](const auto &response) {
+                        session->respond(response);
+                      });
+        });
   }
 
 }  // namespace kagome::api
@@ -8,11 +8,16 @@
 
 #include "api/service/api_service.hpp"
 
+#include <chrono>
 #include <functional>
+#include <map>
 #include <mutex>
+#include <optional>
 #include <type_traits>
 #include <unordered_map>
 
+#include <boost/asio/strand.hpp>
+#include <boost/variant.hpp>
 #include <jsonrpc-lean/fault.h>
 
 #include "api/transport/rpc_thread_pool.hpp"
@@ -20,8 +25,10 @@
 #include "common/buffer.hpp"
 #include "containers/objects_cache.hpp"
 #include "log/logger.hpp"
+#include "primitives/block_header.hpp"
 #include "primitives/block_id.hpp"
 #include "primitives/event_types.hpp"
+#include "primitives/version.hpp"
 #include "subscription/subscription_engine.hpp"
 
 namespace kagome::api {
@@ -105,12 +112,60 @@ namespace kagome::api {
       ChainEventSubscriberPtr chain_sub;
       ExtrinsicEventSubscriberPtr ext_sub;
       CachedAdditionMessagesList messages;
+      /// Serializes delivery of events to the session and processing of its
+      /// requests
+      boost::asio::strand<RpcContext::executor_type> strand;
+      /// Token bucket of requests rate limit, accessed by the reading
+      /// thread of the session only
+      double request_tokens;
+      std::chrono::steady_clock::time_point request_tokens_updated;
+    };
+
+    /// Event sent to sessions. Its value is built from copied params on the
+    /// strand of the first session sending it, and is shared by the rest
+    struct SharedEvent {
+      std::function<jsonrpc::Value()> make_value;
+      std::once_flag formatted;
+      /// JSON text of the value, written verbatim as binary value
+      jsonrpc::Value json;
+    };
+    using SharedEventPtr = std::shared_ptr<SharedEvent>;
+
+    /// The last chain event with its params, to share it between sessions
+    /// notified about it one after another
+    struct LastChainEvent {
+      primitives::events::ChainEventType type;
+      boost::variant<primitives::BlockHeader, primitives::Version> params;
+      SharedEventPtr event;
+    };
+
+    /// Storage changes of a block collected for a session, to be sent in
+    /// a single message per subscription set
+    struct PendingStorageEvents {
+      using Changes =
+          std::vector<std::pair<common::Buffer, std::optional<common::Buffer>>>;
+
+      SessionPtr session;
+      primitives::BlockHash block;
+      std::map<SubscriptionSetId, Changes> changes;
     };
 
    public:
     template <class T>
     using sptr = std::shared_ptr<T>;
 
+    struct Configuration {
+      /// Average number of requests per second allowed for a websocket
+      /// session
+      double requests_per_second = 100;
+      /// Number of requests a websocket session may send at once over the
+      /// average rate
+      size_t requests_burst = 200;
+      /// Requests waiting for processing longer are rejected without being
+      /// processed, since client has likely given up on them
+      std::chrono::milliseconds request_deadline{std::chrono::seconds{10}};
+    };
+
     struct ListenerList {
       std::vector<sptr<Listener>> listeners;
     };
@@ -135,7 +190,8 @@ namespace kagome::api {
         std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
             extrinsic_event_key_repo,
         std::shared_ptr<blockchain::BlockTree> block_tree,
-        std::shared_ptr<storage::trie::TrieStorage> trie_storage);
+        std::shared_ptr<storage::trie::TrieStorage> trie_storage,
+        const Configuration &config);
 
     ~ApiServiceImpl() override = default;
 
@@ -172,7 +228,7 @@ namespace kagome::api {
         PubsubSubscriptionId subscription_id) override;
 
    private:
-    jsonrpc::Value createStateStorageEvent(
+    static jsonrpc::Value createStateStorageEvent(
         const std::vector<
             std::pair<common::Buffer, std::optional<common::Buffer>>>
             &key_value_pairs,
@@ -193,12 +249,39 @@ namespace kagome::api {
 
     void onSessionRequest(std::string_view request,
                           std::shared_ptr<Session> session);
+
+    /// Takes a token from the rate limit bucket of the session
+    bool admitRequest(SessionSubscriptions &session_context);
+
+    void processRequest(const std::string &request,
+                        const std::shared_ptr<Session> &session,
+                        std::chrono::steady_clock::time_point received);
     void onSessionClose(Session::SessionId id, SessionType);
     void onStorageEvent(SubscriptionSetId set_id,
                         SessionPtr &session,
                         const Buffer &key,
                         const std::optional<Buffer> &data,
                         const common::Hash256 &block);
+    void flushStorageEvents();
+
+    /**
+     * Formats and sends the event to the session asynchronously, in order of
+     * events of the session, so that the notifying thread (e.g. block import)
+     * doesn't wait for it
+     */
+    void sendEvent(const SessionPtr &session,
+                   SubscriptionSetId set_id,
+                   std::string_view name,
+                   SharedEventPtr event);
+    void sendStorageEvent(const SessionPtr &session,
+                          SubscriptionSetId set_id,
+                          PendingStorageEvents::Changes changes,
+                          const primitives::BlockHash &block);
+    /// Event of chain {@param event_type} with copy of its params, the same
+    /// one for all the sessions notified about it
+    SharedEventPtr sharedChainEvent(
+        primitives::events::ChainEventType event_type,
+        const primitives::events::ChainEventParams &event_params);
     void onChainEvent(SubscriptionSetId set_id,
                       SessionPtr &session,
                       primitives::events::ChainEventType event_type,
@@ -235,6 +318,7 @@ namespace kagome::api {
       return obj;
     }
 
+    const Configuration config_;
     std::shared_ptr<api::RpcThreadPool> thread_pool_;
     std::vector<sptr<Listener>> listeners_;
     std::shared_ptr<JRpcServer> server_;
@@ -247,6 +331,14 @@ namespace kagome::api {
                        std::shared_ptr<SessionSubscriptions>>
         subscribed_sessions_;
 
+    std::mutex pending_storage_events_cs_;
+    std::unordered_map<Session::SessionId, PendingStorageEvents>
+        pending_storage_events_;
+    ChainEventSubscriberPtr storage_changes_sub_;
+
+    std::mutex last_chain_event_cs_;
+    std::optional<LastChainEvent> last_chain_event_;
+
     struct {
       StorageSubscriptionEnginePtr storage;
       ChainSubscriptionEnginePtr chain;
@@ -5,6 +5,7 @@
 
 #include "api/service/state/impl/state_api_impl.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
 
@@ -13,6 +14,7 @@
 #include "common/hexutil.hpp"
 #include "common/monadic_utils.hpp"
 #include "runtime/common/executor.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_diff.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::api, StateApiImpl::Error, e) {
   using E = kagome::api::StateApiImpl::Error;
@@ -37,18 +39,21 @@ namespace kagome::api {
   StateApiImpl::StateApiImpl(
       std::shared_ptr<blockchain::BlockHeaderRepository> block_repo,
       std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
+      std::shared_ptr<const storage::trie::TrieSerializer> trie_serializer,
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<runtime::Core> runtime_core,
       std::shared_ptr<runtime::Metadata> metadata,
       std::shared_ptr<runtime::RawExecutor> executor)
       : header_repo_{std::move(block_repo)},
         storage_{std::move(trie_storage)},
+        trie_serializer_{std::move(trie_serializer)},
         block_tree_{std::move(block_tree)},
         runtime_core_{std::move(runtime_core)},
         metadata_{std::move(metadata)},
         executor_{std::move(executor)} {
     BOOST_ASSERT(nullptr != header_repo_);
     BOOST_ASSERT(nullptr != storage_);
+    BOOST_ASSERT(nullptr != trie_serializer_);
     BOOST_ASSERT(nullptr != block_tree_);
     BOOST_ASSERT(nullptr != runtime_core_);
     BOOST_ASSERT(nullptr != metadata_);
@@ -154,31 +159,57 @@ namespace kagome::api {
     }
 
     std::vector<StorageChangeSet> changes;
-    std::map<gsl::span<const uint8_t>, std::optional<common::Buffer>>
-        last_values;
 
     // TODO(Harrm): optimize it to use a lazy generator instead of returning the
     // whole vector with block ids
     OUTCOME_TRY(range, block_tree_->getChainByBlocks(from, to));
+    // Values of the first block are looked up, and then each state is
+    // compared with the previous one, skipping subtrees with equal merkle
+    // values instead of looking every key up in every block
+    std::optional<storage::trie::RootHash> prev_state_root;
     for (auto &block : range) {
       OUTCOME_TRY(header, header_repo_->getBlockHeader(block));
-      OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(header.state_root));
+      if (prev_state_root == header.state_root) {
+        continue;
+      }
+      OUTCOME_TRY(trie,
+                  trie_serializer_->retrieveTrie(
+                      common::Buffer{header.state_root}));
       StorageChangeSet change{block, {}};
-      for (auto &key : keys) {
-        OUTCOME_TRY(opt_value, batch->tryGet(key));
-        auto it = last_values.find(key);
-        if (it == last_values.end() || it->second != opt_value) {
-          std::optional<common::Buffer> opt_buffer =
-              opt_value ? std::make_optional(opt_value.value().get())
-                        : std::nullopt;
+      if (not prev_state_root.has_value()) {
+        for (auto &key : keys) {
+          OUTCOME_TRY(opt_value, trie->tryGet(key));
+          change.changes.push_back(StorageChangeSet::Change{
+              key,
+              opt_value ? std::make_optional(opt_value->get())
+                        : std::nullopt});
+        }
+      } else {
+        // Previous state is retrieved anew, because its nodes loaded by the
+        // former comparison are no longer known by merkle values and would
+        // be walked again
+        OUTCOME_TRY(prev_trie,
+                    trie_serializer_->retrieveTrie(
+                        common::Buffer{prev_state_root.value()}));
+        std::vector<std::pair<size_t, std::optional<common::Buffer>>> changed;
+        OUTCOME_TRY(storage::trie::forEachChangedValue(
+            *prev_trie, *trie, keys, [&](size_t i, const auto &value) {
+              changed.emplace_back(i, value);
+            }));
+        // changes are found in order of the trie, but reported in order of
+        // the queried keys
+        std::sort(changed.begin(),
+                  changed.end(),
+                  [](auto &lhs, auto &rhs) { return lhs.first < rhs.first; });
+        for (auto &[i, value] : changed) {
           change.changes.push_back(
-              StorageChangeSet::Change{common::Buffer{key}, opt_buffer});
+              StorageChangeSet::Change{keys[i], std::move(value)});
         }
-        last_values[key] = std::move(opt_value);
       }
       if (!change.changes.empty()) {
         changes.emplace_back(std::move(change));
       }
+      prev_state_root = header.state_root;
     }
     return changes;
   }
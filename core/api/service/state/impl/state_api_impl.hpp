@@ -11,6 +11,7 @@
 #include "blockchain/block_tree.hpp"
 #include "runtime/runtime_api/core.hpp"
 #include "runtime/runtime_api/metadata.hpp"
+#include "storage/trie/serialization/trie_serializer.hpp"
 #include "storage/trie/trie_storage.hpp"
 
 namespace kagome::runtime {
@@ -32,6 +33,8 @@ namespace kagome::api {
 
     StateApiImpl(std::shared_ptr<blockchain::BlockHeaderRepository> block_repo,
                  std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
+                 std::shared_ptr<const storage::trie::TrieSerializer>
+                     trie_serializer,
                  std::shared_ptr<blockchain::BlockTree> block_tree,
                  std::shared_ptr<runtime::Core> runtime_core,
                  std::shared_ptr<runtime::Metadata> metadata,
@@ -88,6 +91,7 @@ namespace kagome::api {
    private:
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
     std::shared_ptr<const storage::trie::TrieStorage> storage_;
+    std::shared_ptr<const storage::trie::TrieSerializer> trie_serializer_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<runtime::Core> runtime_core_;
 
@@ -21,6 +21,9 @@ namespace kagome::api::state::request {
    */
   class GetKeysPaged final {
    public:
+    /// Result is written by writeJson(), without tree of jsonrpc::Value
+    static constexpr bool kRawJsonResult = true;
+
     GetKeysPaged(GetKeysPaged const &) = delete;
     GetKeysPaged &operator=(GetKeysPaged const &) = delete;
 
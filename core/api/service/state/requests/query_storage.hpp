@@ -41,6 +41,9 @@ namespace kagome::api::state::request {
                                     std::string,
                                     std::optional<std::string>> {
    public:
+    /// Result is written by writeJson(), without tree of jsonrpc::Value
+    static constexpr bool kRawJsonResult = true;
+
     explicit QueryStorage(std::shared_ptr<StateApi> api)
         : api_(std::move(api)) {
       BOOST_ASSERT(api_);
@@ -74,6 +77,9 @@ namespace kagome::api::state::request {
                                     std::vector<std::string>,
                                     std::optional<std::string>> {
    public:
+    /// Result is written by writeJson(), without tree of jsonrpc::Value
+    static constexpr bool kRawJsonResult = true;
+
     explicit QueryStorageAt(std::shared_ptr<StateApi> api)
         : api_(std::move(api)) {
       BOOST_ASSERT(api_);
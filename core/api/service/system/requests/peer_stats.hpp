@@ -0,0 +1,69 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_API_SYSTEM_REQUEST_PEERSTATS
+#define KAGOME_API_SYSTEM_REQUEST_PEERSTATS
+
+#include "api/service/base_request.hpp"
+
+#include "api/service/system/system_api.hpp"
+
+namespace kagome::api::system::request {
+
+  /**
+   * @brief Returns score of each connected peer and statistics of
+   * interaction with it by protocols, which the score is based on
+   */
+  struct PeerStats final : details::RequestType<jsonrpc::Value::Array> {
+    explicit PeerStats(std::shared_ptr<SystemApi> &api) : api_(api) {
+      BOOST_ASSERT(api_);
+    }
+
+    outcome::result<Return> execute() override {
+      auto &peer_manager = *api_->getPeerManager();
+
+      jsonrpc::Value::Array result;
+      result.reserve(peer_manager.activePeersNumber());
+
+      peer_manager.forEachPeer([&](auto &peer_id) {
+        auto stats_opt = peer_manager.getPeerStats(peer_id);
+        if (not stats_opt.has_value()) {
+          return;
+        }
+        auto &stats = stats_opt.value();
+
+        jsonrpc::Value::Struct protocols;
+        for (auto &[protocol, protocol_stats] : stats.protocols) {
+          jsonrpc::Value::Struct item;
+          item.emplace("requests", makeValue(protocol_stats.requests));
+          item.emplace("failures", makeValue(protocol_stats.failures));
+          item.emplace("latencyMs",
+                       makeValue(static_cast<uint64_t>(
+                           protocol_stats.latency.count())));
+          item.emplace("throughput", protocol_stats.throughput);
+          item.emplace("messages", makeValue(protocol_stats.messages));
+          item.emplace("usefulMessages",
+                       makeValue(protocol_stats.useful_messages));
+          protocols.emplace(protocol, std::move(item));
+        }
+
+        jsonrpc::Value::Struct peer;
+        peer.emplace("peerId", peer_id.toBase58());
+        peer.emplace("score", stats.score);
+        peer.emplace("protocols", std::move(protocols));
+
+        result.emplace_back(std::move(peer));
+      });
+
+      return result;
+    }
+
+   private:
+    std::shared_ptr<SystemApi> api_;
+  };
+
+}  // namespace kagome::api::system::request
+
+#endif  // KAGOME_API_SYSTEM_REQUEST_PEERSTATS
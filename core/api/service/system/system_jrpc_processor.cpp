@@ -11,6 +11,7 @@
 #include "api/service/system/requests/chain_type.hpp"
 #include "api/service/system/requests/health.hpp"
 #include "api/service/system/requests/name.hpp"
+#include "api/service/system/requests/peer_stats.hpp"
 #include "api/service/system/requests/peers.hpp"
 #include "api/service/system/requests/properties.hpp"
 #include "api/service/system/requests/version.hpp"
@@ -49,6 +50,9 @@ namespace kagome::api::system {
         Handler<request::AccountNextIndex>(api_));  // an alias
 
     server_->registerHandler("system_peers", Handler<request::Peers>(api_));
+
+    server_->registerHandler("system_peerStats",
+                             Handler<request::PeerStats>(api_));
   }
 
 }  // namespace kagome::api::system
@@ -43,6 +43,13 @@ namespace kagome::api {
      */
     void stop();
 
+    /**
+     * @brief io context served by the pool
+     */
+    Context &context() {
+      return *context_;
+    }
+
    private:
     std::shared_ptr<Context> context_;
     const Configuration config_;
@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/filesystem.hpp>
@@ -155,6 +156,20 @@ namespace kagome::application {
      */
     virtual uint32_t maxWsConnections() const = 0;
 
+    /**
+     * @return maximum number of simultaneous calls of each RPC method, 0 means
+     * no limit. Calls over the limit are rejected rather than queued, so that
+     * they don't occupy threads of RPC pool while waiting
+     */
+    virtual uint32_t rpcMaxConcurrentCalls() const = 0;
+
+    /**
+     * @return limits of simultaneous calls of particular RPC methods, which
+     * override the common one and the default limits of heavy methods
+     */
+    virtual const std::unordered_map<std::string, uint32_t> &
+    rpcMethodConcurrentCalls() const = 0;
+
     /**
      * @return Kademlia random walk interval
      */
@@ -204,7 +219,7 @@ namespace kagome::application {
     virtual const std::vector<telemetry::TelemetryEndpoint>
         &telemetryEndpoints() const = 0;
 
-    enum class SyncMethod { Full, Fast };
+    enum class SyncMethod { Full, Fast, Warp };
     /**
      * @return enum constant of the chosen sync method
      */
@@ -240,6 +255,13 @@ namespace kagome::application {
 
     virtual std::optional<primitives::BlockId> recoverState() const = 0;
 
+    /**
+     * @return path to own files of RocksDB secondary instance, if the node
+     * should only serve read-only RPC from database of another node
+     */
+    virtual std::optional<boost::filesystem::path> dbSecondaryPath()
+        const = 0;
+
     enum class StorageBackend { RocksDB };
 
     /**
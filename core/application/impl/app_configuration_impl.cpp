@@ -49,6 +49,7 @@ namespace {
   const uint16_t def_rpc_ws_port = 9944;
   const uint16_t def_openmetrics_http_port = 9615;
   const uint32_t def_ws_max_connections = 500;
+  const uint32_t def_rpc_max_concurrent_calls = 0;
   const uint16_t def_p2p_port = 30363;
   const bool def_dev_mode = false;
   const kagome::network::Roles def_roles = [] {
@@ -103,6 +104,9 @@ namespace {
     if (str == "Fast") {
       return SM::Fast;
     }
+    if (str == "Warp") {
+      return SM::Warp;
+    }
     return std::nullopt;
   }
 
@@ -148,6 +152,23 @@ namespace {
 
     return std::nullopt;
   }
+
+  /// Parses limit of RPC method calls given as "method=limit"
+  std::optional<std::pair<std::string, uint32_t>> str_to_method_limit(
+      std::string_view str) {
+    auto pos = str.find('=');
+    if (pos == 0 or pos == std::string_view::npos) {
+      return std::nullopt;
+    }
+    auto value = str.substr(pos + 1);
+    uint32_t limit;
+    auto result =
+        std::from_chars(value.data(), value.data() + value.size(), limit);
+    if (result.ec != std::errc{} or result.ptr != value.data() + value.size()) {
+      return std::nullopt;
+    }
+    return std::pair{std::string(str.substr(0, pos)), limit};
+  }
 }  // namespace
 
 namespace kagome::application {
@@ -173,6 +194,7 @@ namespace kagome::application {
         node_name_(randomNodeName()),
         node_version_(buildVersion()),
         max_ws_connections_(def_ws_max_connections),
+        rpc_max_concurrent_calls_(def_rpc_max_concurrent_calls),
         random_walk_interval_(def_random_walk_interval),
         sync_method_{def_sync_method},
         runtime_exec_method_{def_runtime_exec_method},
@@ -374,6 +396,7 @@ namespace kagome::application {
     load_str(val, "ws-host", rpc_ws_host_);
     load_u16(val, "ws-port", rpc_ws_port_);
     load_u32(val, "ws-max-connections", max_ws_connections_);
+    load_u32(val, "rpc-max-concurrent-calls", rpc_max_concurrent_calls_);
     load_str(val, "prometheus-host", openmetrics_http_host_);
     load_u16(val, "prometheus-port", openmetrics_http_port_);
     load_str(val, "name", node_name_);
@@ -699,6 +722,7 @@ namespace kagome::application {
         ("database", po::value<std::string>()->default_value("rocksdb"), "Database backend to use [rocksdb]")
         ("enable-offchain-indexing", po::value<bool>(), "enable Offchain Indexing API, which allow block import to write to offchain DB)")
         ("recovery", po::value<std::string>(), "recovers block storage to state after provided block presented by number or hash, and stop after that")
+        ("db-secondary", po::value<std::string>(), "opens database of node in base path as secondary instance keeping own files in provided path, and only serves read-only state, chain and child state RPC from it")
         ;
 
     po::options_description network_desc("Network options");
@@ -715,6 +739,8 @@ namespace kagome::application {
         ("ws-host", po::value<std::string>(), "address for RPC over Websocket protocol")
         ("ws-port", po::value<uint16_t>(), "port for RPC over Websocket protocol")
         ("ws-max-connections", po::value<uint32_t>(), "maximum number of WS RPC server connections")
+        ("rpc-max-concurrent-calls", po::value<uint32_t>(), "maximum number of simultaneous calls of each RPC method, calls over it are rejected (0 - no limit)")
+        ("rpc-method-concurrent-calls", po::value<std::vector<std::string>>()->multitoken(), "limits of simultaneous calls of particular RPC methods, e.g. state_queryStorage=2 (0 - no limit)")
         ("prometheus-host", po::value<std::string>(), "address for OpenMetrics over HTTP")
         ("prometheus-port", po::value<uint16_t>(), "port for OpenMetrics over HTTP")
         ("out-peers", po::value<uint32_t>()->default_value(def_out_peers), "number of outgoing connections we're trying to maintain")
@@ -735,7 +761,7 @@ namespace kagome::application {
         ("dev", "if node run in development mode")
         ("dev-with-wipe", "if needed to wipe base path (only for dev mode)")
         ("sync", po::value<std::string>()->default_value(def_full_sync),
-          "choose the desired sync method (Full, Fast). Full is used by default.")
+          "choose the desired sync method (Full, Fast, Warp). Full is used by default.")
         ("wasm-execution", po::value<std::string>()->default_value(def_wasm_execution),
           "choose the desired wasm execution method (Compiled, Interpreted)")
         ("unsafe-cached-wavm-runtime", "use WAVM runtime cache")
@@ -1091,6 +1117,31 @@ namespace kagome::application {
       max_ws_connections_ = val;
     });
 
+    find_argument<uint32_t>(vm, "rpc-max-concurrent-calls", [&](uint32_t val) {
+      rpc_max_concurrent_calls_ = val;
+    });
+
+    bool rpc_method_limit_error = false;
+    find_argument<std::vector<std::string>>(
+        vm,
+        "rpc-method-concurrent-calls",
+        [&](const std::vector<std::string> &val) {
+          for (auto &method_limit : val) {
+            auto limit = str_to_method_limit(method_limit);
+            if (not limit) {
+              rpc_method_limit_error = true;
+              SL_ERROR(logger_,
+                       "Invalid RPC method limit specified: '{}'",
+                       method_limit);
+              continue;
+            }
+            rpc_method_concurrent_calls_[limit->first] = limit->second;
+          }
+        });
+    if (rpc_method_limit_error) {
+      return false;
+    }
+
     find_argument<uint32_t>(vm, "random-walk-interval", [&](uint32_t val) {
       random_walk_interval_ = val;
     });
@@ -1221,6 +1272,10 @@ namespace kagome::application {
       return false;
     }
 
+    find_argument<std::string>(vm, "db-secondary", [&](const std::string &val) {
+      db_secondary_path_ = val;
+    });
+
     // if something wrong with config print help message
     if (not validate_config()) {
       std::cout << desc << std::endl;
@@ -130,6 +130,13 @@ namespace kagome::application {
     uint32_t maxWsConnections() const override {
       return max_ws_connections_;
     }
+    uint32_t rpcMaxConcurrentCalls() const override {
+      return rpc_max_concurrent_calls_;
+    }
+    const std::unordered_map<std::string, uint32_t> &rpcMethodConcurrentCalls()
+        const override {
+      return rpc_method_concurrent_calls_;
+    }
     std::chrono::seconds getRandomWalkInterval() const override {
       return std::chrono::seconds(random_walk_interval_);
     }
@@ -182,6 +189,9 @@ namespace kagome::application {
     std::optional<primitives::BlockId> recoverState() const override {
       return recovery_state_;
     }
+    std::optional<boost::filesystem::path> dbSecondaryPath() const override {
+      return db_secondary_path_;
+    }
     StorageBackend storageBackend() const override {
       return storage_backend_;
     }
@@ -312,6 +322,8 @@ namespace kagome::application {
     std::string node_name_;
     std::string node_version_;
     uint32_t max_ws_connections_;
+    uint32_t rpc_max_concurrent_calls_;
+    std::unordered_map<std::string, uint32_t> rpc_method_concurrent_calls_;
     uint32_t random_walk_interval_;
     SyncMethod sync_method_;
     RuntimeExecutionMethod runtime_exec_method_;
@@ -321,6 +333,7 @@ namespace kagome::application {
     bool enable_offchain_indexing_;
     bool subcommand_chain_info_;
     std::optional<primitives::BlockId> recovery_state_;
+    std::optional<boost::filesystem::path> db_secondary_path_;
     StorageBackend storage_backend_ = StorageBackend::RocksDB;
   };
 
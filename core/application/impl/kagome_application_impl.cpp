@@ -10,10 +10,18 @@
 #include "application/impl/util.hpp"
 #include "application/modes/print_chain_info_mode.hpp"
 #include "application/modes/recovery_mode.hpp"
+#include "blockchain/impl/block_tree_impl.hpp"
 #include "consensus/babe/babe.hpp"
 #include "metrics/impl/metrics_watcher.hpp"
 #include "metrics/metrics.hpp"
+#include "storage/rocksdb/rocksdb.hpp"
 #include "telemetry/service.hpp"
+#include "transaction_pool/impl/transaction_pool_revalidator.hpp"
+
+namespace {
+  /// Period of applying changes of primary database in read-only RPC mode
+  constexpr std::chrono::milliseconds kCatchUpWithPrimaryPeriod{500};
+}  // namespace
 
 namespace kagome::application {
 
@@ -40,6 +48,64 @@ namespace kagome::application {
     return mode->run();
   }
 
+  int KagomeApplicationImpl::readOnlyRpc() {
+    app_state_manager_ = injector_->injectAppStateManager();
+    io_context_ = injector_->injectIoContext();
+    exposer_ = injector_->injectOpenMetricsService();
+    jrpc_api_service_ = injector_->injectRpcApiService();
+    secondary_db_ =
+        std::dynamic_pointer_cast<storage::RocksDB>(injector_->injectStorage());
+    BOOST_ASSERT(secondary_db_ != nullptr);
+    block_tree_ = std::dynamic_pointer_cast<blockchain::BlockTreeImpl>(
+        injector_->injectBlockTree());
+    BOOST_ASSERT(block_tree_ != nullptr);
+    rpc_calls_lock_ = injector_->injectRpcCallsLock();
+    BOOST_ASSERT(rpc_calls_lock_ != nullptr);
+
+    logger_->info("Start as read-only RPC node over database {} with PID {}",
+                  app_config_.databasePath(chain_spec_->id()).native(),
+                  getpid());
+
+    catch_up_timer_.emplace(*io_context_);
+    app_state_manager_->atLaunch([this] {
+      catchUpWithPrimary();
+      std::thread asio_runner([ctx{io_context_}] { ctx->run(); });
+      asio_runner.detach();
+      return true;
+    });
+
+    app_state_manager_->atShutdown([this] {
+      catch_up_timer_->cancel();
+      io_context_->stop();
+    });
+
+    app_state_manager_->run();
+    return EXIT_SUCCESS;
+  }
+
+  void KagomeApplicationImpl::catchUpWithPrimary() {
+    catch_up_timer_->expires_after(kCatchUpWithPrimaryPeriod);
+    catch_up_timer_->async_wait([this](boost::system::error_code ec) {
+      if (ec) {
+        return;
+      }
+      if (auto res = secondary_db_->tryCatchUpWithPrimary(); not res) {
+        SL_WARN(logger_,
+                "Can't catch up with primary database: {}",
+                res.error().message());
+      } else {
+        // Block tree is not thread safe, so it's refreshed between RPC calls
+        std::unique_lock lock{*rpc_calls_lock_};
+        if (auto res = block_tree_->syncWithStorage(); not res) {
+          SL_WARN(logger_,
+                  "Can't load new blocks to block tree: {}",
+                  res.error().message());
+        }
+      }
+      catchUpWithPrimary();
+    });
+  }
+
   void KagomeApplicationImpl::run() {
     app_state_manager_ = injector_->injectAppStateManager();
     io_context_ = injector_->injectIoContext();
@@ -52,9 +118,11 @@ namespace kagome::application {
     jrpc_api_service_ = injector_->injectRpcApiService();
     state_observer_ = injector_->injectStateObserver();
     sync_observer_ = injector_->injectSyncObserver();
+    warp_observer_ = injector_->injectWarpObserver();
     parachain_observer_ = injector_->injectParachainObserver();
     metrics_watcher_ = injector_->injectMetricsWatcher();
     telemetry_service_ = injector_->injectTelemetryService();
+    tx_pool_revalidator_ = injector_->injectTransactionPoolRevalidator();
     kagome::telemetry::setTelemetryService(telemetry_service_);
 
     logger_->info("Start as node version '{}' named as '{}' with PID {}",
@@ -8,11 +8,24 @@
 
 #include "application/kagome_application.hpp"
 
+#include <optional>
+#include <shared_mutex>
+
+#include <boost/asio/steady_timer.hpp>
+
 #include "application/app_configuration.hpp"
 #include "application/app_state_manager.hpp"
 #include "application/chain_spec.hpp"
 #include "injector/application_injector.hpp"
 
+namespace kagome::blockchain {
+  class BlockTreeImpl;
+}
+
+namespace kagome::storage {
+  class RocksDB;
+}
+
 namespace kagome::application {
 
   class KagomeApplicationImpl : public KagomeApplication {
@@ -31,9 +44,14 @@ namespace kagome::application {
 
     int recovery() override;
 
+    int readOnlyRpc() override;
+
     void run() override;
 
    private:
+    /// Applies changes of primary database and loads new blocks periodically
+    void catchUpWithPrimary();
+
     const AppConfiguration &app_config_;
     uptr<injector::KagomeNodeInjector> injector_;
     log::Logger logger_;
@@ -50,10 +68,16 @@ namespace kagome::application {
     sptr<api::ApiService> jrpc_api_service_;
     sptr<network::StateProtocolObserver> state_observer_;
     sptr<network::SyncProtocolObserver> sync_observer_;
+    sptr<network::WarpProtocolObserver> warp_observer_;
     sptr<parachain::ParachainObserverImpl> parachain_observer_;
     sptr<parachain::ParachainProcessorImpl> parachain_processor_;
     sptr<metrics::MetricsWatcher> metrics_watcher_;
     sptr<telemetry::TelemetryService> telemetry_service_;
+    sptr<transaction_pool::TransactionPoolRevalidator> tx_pool_revalidator_;
+    sptr<storage::RocksDB> secondary_db_;
+    sptr<blockchain::BlockTreeImpl> block_tree_;
+    sptr<std::shared_mutex> rpc_calls_lock_;
+    std::optional<boost::asio::steady_timer> catch_up_timer_;
   };
 
 }  // namespace kagome::application
@@ -21,6 +21,9 @@ namespace kagome::application {
     /// Runs recovery mode
     virtual int recovery() = 0;
 
+    /// Runs read-only RPC over database of another node
+    virtual int readOnlyRpc() = 0;
+
     /// Runs node
     virtual void run() = 0;
   };
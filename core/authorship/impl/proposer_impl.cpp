@@ -40,7 +40,10 @@ namespace kagome::authorship {
   outcome::result<primitives::Block> ProposerImpl::propose(
       const primitives::BlockInfo &parent_block,
       const primitives::InherentData &inherent_data,
-      const primitives::Digest &inherent_digest) {
+      const primitives::Digest &inherent_digest,
+      std::chrono::milliseconds max_duration) {
+    auto deadline = std::chrono::steady_clock::now() + max_duration;
+
     OUTCOME_TRY(block_builder,
                 block_builder_factory_->make(parent_block, inherent_digest));
 
@@ -82,10 +85,11 @@ namespace kagome::authorship {
                remove_res.error().message(),
                parent_block);
     }
-    const auto &ready_txs = transaction_pool_->getReadyTransactions();
+    using Visit = transaction_pool::TransactionPool::Visit;
 
     bool transaction_pushed = false;
     bool hit_block_size_limit = false;
+    bool hit_deadline = false;
 
     auto skipped = 0;
     auto block_size_limit = kBlockSizeLimit;
@@ -97,12 +101,21 @@ namespace kagome::authorship {
     // at the moment block_size includes block headers and a counter to hold a
     // number of transactions to be pushed to the block
 
+    // included and invalid transactions, which are removed from the pool
+    std::vector<primitives::Transaction::Hash> processed_txs;
+
     size_t included_tx_count = 0;
-    for (const auto &[hash, tx] : ready_txs) {
-      const auto &tx_ref = tx;
-      scale::ScaleEncoderStream s(true);
-      s << tx_ref->ext;
-      auto estimate_tx_size = s.size();
+    transaction_pool_->forEachReadyTransaction([&](const auto &tx) {
+      if (std::chrono::steady_clock::now() >= deadline) {
+        SL_DEBUG(logger_,
+                 "Time budget of {} ms is spent, proceeding with proposing.",
+                 max_duration.count());
+        hit_deadline = true;
+        return Visit::STOP;
+      }
+
+      // size of encoded extrinsic is estimated once on import to the pool
+      auto estimate_tx_size = tx->bytes;
 
       if (block_size + estimate_tx_size > block_size_limit) {
         if (skipped < kMaxSkippedTransactions) {
@@ -111,15 +124,15 @@ namespace kagome::authorship {
                    "Transaction would overflow the block size limit, but will "
                    "try {} more transactions before quitting.",
                    kMaxSkippedTransactions - skipped);
-          continue;
+          return Visit::SKIPPED;
         }
         SL_DEBUG(logger_,
                  "Reached block size limit, proceeding with proposing.");
         hit_block_size_limit = true;
-        break;
+        return Visit::STOP;
       }
 
-      SL_DEBUG(logger_, "Adding extrinsic: {}", tx_ref->ext.data);
+      SL_DEBUG(logger_, "Adding extrinsic: {}", tx->ext.data);
       auto inserted_res = block_builder->pushExtrinsic(tx->ext);
       if (not inserted_res) {
         if (BlockBuilderError::EXHAUSTS_RESOURCES == inserted_res.error()) {
@@ -129,21 +142,26 @@ namespace kagome::authorship {
                      "Block seems full, but will try {} more transactions "
                      "before quitting.",
                      kMaxSkippedTransactions - skipped);
-          } else {  // maximum amount of txs is pushed
-            SL_DEBUG(logger_, "Block is full, proceed with proposing.");
-            break;
+            return Visit::SKIPPED;
           }
-        } else {  // any other error than exhausted resources
-          logger_->warn("Extrinsic {} was not added to the block. Reason: {}",
-                        tx->ext.data,
-                        inserted_res.error().message());
+          // maximum amount of txs is pushed
+          SL_DEBUG(logger_, "Block is full, proceed with proposing.");
+          return Visit::STOP;
         }
-      } else {  // tx was pushed successfully
-        block_size += estimate_tx_size;
-        transaction_pushed = true;
-        ++included_tx_count;
+        // any other error than exhausted resources
+        logger_->warn("Extrinsic {} was not added to the block. Reason: {}",
+                      tx->ext.data,
+                      inserted_res.error().message());
+        processed_txs.push_back(tx->hash);
+        return Visit::SKIPPED;
       }
-    }
+      // tx was pushed successfully
+      block_size += estimate_tx_size;
+      transaction_pushed = true;
+      ++included_tx_count;
+      processed_txs.push_back(tx->hash);
+      return Visit::TAKEN;
+    });
     metric_tx_included_in_block_->set(included_tx_count);
 
     if (hit_block_size_limit and not transaction_pushed) {
@@ -152,9 +170,16 @@ namespace kagome::authorship {
               block_size_limit);
     }
 
+    if (hit_deadline and not transaction_pushed) {
+      SL_WARN(logger_,
+              "Time budget of {} ms was spent without including any "
+              "transaction!",
+              max_duration.count());
+    }
+
     OUTCOME_TRY(block, block_builder->bake());
 
-    for (const auto &[hash, tx] : ready_txs) {
+    for (const auto &hash : processed_txs) {
       auto removed_res = transaction_pool_->removeOne(hash);
       if (not removed_res) {
         logger_->error(
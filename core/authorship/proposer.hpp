@@ -7,6 +7,8 @@
 #define KAGOME_CORE_AUTHORSHIP_PROPOSER_TEST_HPP
 
 #include "clock/clock.hpp"
+#include <chrono>
+
 #include "primitives/block.hpp"
 #include "primitives/common.hpp"
 #include "primitives/digest.hpp"
@@ -26,12 +28,15 @@ namespace kagome::authorship {
      * @param parent_block number and hash of parent block
      * @param inherent_data additional data on block from unsigned extrinsics
      * @param inherent_digests - chain-specific block auxiliary data
+     * @param max_duration - time budget for building of the block; once it
+     * is spent, no more transactions are pushed and the block is baked
      * @return proposed block or error
      */
     virtual outcome::result<primitives::Block> propose(
         const primitives::BlockInfo &parent_block,
         const primitives::InherentData &inherent_data,
-        const primitives::Digest &inherent_digest) = 0;
+        const primitives::Digest &inherent_digest,
+        std::chrono::milliseconds max_duration) = 0;
   };
 
 }  // namespace kagome::authorship
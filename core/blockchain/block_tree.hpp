@@ -143,6 +143,19 @@ namespace kagome::blockchain {
         const primitives::BlockHash &block,
         const primitives::Justification &justification) = 0;
 
+    /**
+     * Makes block {@param header}, finality of which is proven by {@param
+     * justification} without its ancestry (i.e. by warp sync), the last
+     * finalized block and the only leaf. Other blocks are dropped from the
+     * tree, but not from storage. BABE epochs of the block are read from its
+     * state; if the state is not synced yet, the method has to be called
+     * again once it is.
+     * @return nothing or error
+     */
+    virtual outcome::result<void> resetToFinalized(
+        const primitives::BlockHeader &header,
+        const primitives::Justification &justification) = 0;
+
     /**
      * Get a chain of blocks from the specified as a (\param block) up to the
      * closest finalized one
@@ -111,6 +111,63 @@ namespace kagome::blockchain {
 
       return block_tree_leaves;
     }
+
+    /// BABE epochs of the root block of the tree
+    struct RootEpochs {
+      consensus::EpochNumber epoch_number;
+      consensus::EpochDigest current;
+      consensus::EpochDigest next;
+    };
+
+    /**
+     * Reads BABE epochs of the block, whose ancestry is not stored as its
+     * finality was proven by warp sync, from its state. Slot of block #1, which
+     * epochs are counted from, is derived from them too. Epochs of genesis are
+     * used until the state is synced.
+     */
+    RootEpochs loadRootEpochs(runtime::BabeApi &babe_api,
+                              consensus::BabeUtil &babe_util,
+                              const primitives::BabeConfiguration &config,
+                              const primitives::BlockInfo &block,
+                              const log::Logger &log) {
+      auto current_res = babe_api.current_epoch(block.hash);
+      auto next_res = babe_api.next_epoch(block.hash);
+      if (current_res.has_error() or next_res.has_error()) {
+        SL_VERBOSE(log,
+                   "BABE epochs of block {} are unknown until its state is "
+                   "synced: {}",
+                   block,
+                   (current_res.has_error() ? current_res.error()
+                                            : next_res.error())
+                       .message());
+        return RootEpochs{
+            0,
+            {.authorities = config.genesis_authorities,
+             .randomness = config.randomness},
+            {.authorities = config.genesis_authorities,
+             .randomness = config.randomness}};
+      }
+      auto &current = current_res.value();
+      auto &next = next_res.value();
+
+      babe_util.syncEpoch([&] {
+        auto first_slot_number =
+            current.start_slot - current.epoch_index * config.epoch_length;
+        return std::tuple(first_slot_number, true);
+      });
+
+      SL_DEBUG(log,
+               "BABE epoch of block {} is read from its state: Epoch #{}, "
+               "Randomness: {}",
+               block,
+               current.epoch_index,
+               current.randomness);
+      return RootEpochs{current.epoch_index,
+                        {.authorities = std::move(current.authorities),
+                         .randomness = current.randomness},
+                        {.authorities = std::move(next.authorities),
+                         .randomness = next.randomness}};
+    }
   }  // namespace
 
   outcome::result<std::shared_ptr<BlockTreeImpl>> BlockTreeImpl::create(
@@ -125,6 +182,7 @@ namespace kagome::blockchain {
           extrinsic_event_key_repo,
       std::shared_ptr<runtime::Core> runtime_core,
       std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
+      std::shared_ptr<runtime::BabeApi> babe_api,
       std::shared_ptr<primitives::BabeConfiguration> babe_configuration,
       std::shared_ptr<consensus::BabeUtil> babe_util,
       std::shared_ptr<const class JustificationStoragePolicy>
@@ -229,10 +287,19 @@ namespace kagome::blockchain {
       }
 
       OUTCOME_TRY(header_opt_tmp, storage->getBlockHeader(hash_tmp));
-      BOOST_ASSERT_MSG(
-          header_opt_tmp.has_value(),
-          "Header retrieved by hash previously retrieved from "
-          "HeaderRepository, thus the header should be present there");
+      if (not header_opt_tmp.has_value()) {
+        // Ancestry of the last finalized block is not stored, as its finality
+        // was proven by warp sync
+        auto epochs = loadRootEpochs(*babe_api,
+                                     *babe_util,
+                                     *babe_configuration,
+                                     last_finalized_block_info,
+                                     log);
+        curr_epoch_number = epochs.epoch_number;
+        curr_epoch.emplace(std::move(epochs.current));
+        next_epoch.emplace(std::move(epochs.next));
+        break;
+      }
       auto &header_tmp = header_opt_tmp.value();
 
       auto babe_digests_res = consensus::getBabeDigests(header_tmp);
@@ -347,6 +414,8 @@ namespace kagome::blockchain {
                           std::move(extrinsic_event_key_repo),
                           std::move(runtime_core),
                           std::move(changes_tracker),
+                          std::move(babe_api),
+                          std::move(babe_configuration),
                           std::move(babe_util),
                           std::move(justification_storage_policy));
 
@@ -469,6 +538,8 @@ namespace kagome::blockchain {
           extrinsic_event_key_repo,
       std::shared_ptr<runtime::Core> runtime_core,
       std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
+      std::shared_ptr<runtime::BabeApi> babe_api,
+      std::shared_ptr<primitives::BabeConfiguration> babe_configuration,
       std::shared_ptr<consensus::BabeUtil> babe_util,
       std::shared_ptr<const JustificationStoragePolicy>
           justification_storage_policy)
@@ -482,6 +553,8 @@ namespace kagome::blockchain {
         extrinsic_event_key_repo_{std::move(extrinsic_event_key_repo)},
         runtime_core_(std::move(runtime_core)),
         trie_changes_tracker_(std::move(changes_tracker)),
+        babe_api_(std::move(babe_api)),
+        babe_configuration_(std::move(babe_configuration)),
         babe_util_(std::move(babe_util)),
         justification_storage_policy_{std::move(justification_storage_policy)} {
     BOOST_ASSERT(header_repo_ != nullptr);
@@ -494,6 +567,8 @@ namespace kagome::blockchain {
     BOOST_ASSERT(extrinsic_event_key_repo_ != nullptr);
     BOOST_ASSERT(runtime_core_ != nullptr);
     BOOST_ASSERT(trie_changes_tracker_ != nullptr);
+    BOOST_ASSERT(babe_api_ != nullptr);
+    BOOST_ASSERT(babe_configuration_ != nullptr);
     BOOST_ASSERT(babe_util_ != nullptr);
     BOOST_ASSERT(justification_storage_policy_ != nullptr);
     BOOST_ASSERT(telemetry_ != nullptr);
@@ -545,24 +620,8 @@ namespace kagome::blockchain {
     }
     OUTCOME_TRY(block_hash, storage_->putBlockHeader(header));
 
-    consensus::EpochNumber epoch_number = 0;
-    auto babe_digests_res = consensus::getBabeDigests(header);
-    if (babe_digests_res.has_value()) {
-      epoch_number =
-          babe_util_->slotToEpoch(babe_digests_res.value().second.slot_number);
-    }
-
-    std::optional<consensus::EpochDigest> next_epoch;
-    if (auto digest = consensus::getNextEpochDigest(header);
-        digest.has_value()) {
-      next_epoch.emplace(std::move(digest.value()));
-    }
-
     // update local meta with the new block
-    auto new_node = std::make_shared<TreeNode>(
-        block_hash, header.number, parent, epoch_number, std::move(next_epoch));
-
-    tree_->updateMeta(new_node);
+    tree_->updateMeta(makeTreeNode(block_hash, header, parent));
 
     OUTCOME_TRY(reorganize());
 
@@ -591,27 +650,8 @@ namespace kagome::blockchain {
     // Save block
     OUTCOME_TRY(block_hash, storage_->putBlock(block));
 
-    consensus::EpochNumber epoch_number = 0;
-    auto babe_digests_res = consensus::getBabeDigests(block.header);
-    if (babe_digests_res.has_value()) {
-      auto babe_slot = babe_digests_res.value().second.slot_number;
-      epoch_number = babe_util_->slotToEpoch(babe_slot);
-    }
-
-    std::optional<consensus::EpochDigest> next_epoch;
-    if (auto digest = consensus::getNextEpochDigest(block.header);
-        digest.has_value()) {
-      next_epoch.emplace(std::move(digest.value()));
-    }
-
     // Update local meta with the block
-    auto new_node = std::make_shared<TreeNode>(block_hash,
-                                               block.header.number,
-                                               parent,
-                                               epoch_number,
-                                               std::move(next_epoch));
-
-    tree_->updateMeta(new_node);
+    tree_->updateMeta(makeTreeNode(block_hash, block.header, parent));
 
     OUTCOME_TRY(reorganize());
 
@@ -741,27 +781,8 @@ namespace kagome::blockchain {
                primitives::BlockInfo(block_header.number, block_hash));
     }
 
-    consensus::EpochNumber epoch_number = 0;
-    auto babe_digests_res = consensus::getBabeDigests(block_header);
-    if (babe_digests_res.has_value()) {
-      auto babe_slot = babe_digests_res.value().second.slot_number;
-      epoch_number = babe_util_->slotToEpoch(babe_slot);
-    }
-
-    std::optional<consensus::EpochDigest> next_epoch;
-    if (auto digest = consensus::getNextEpochDigest(block_header);
-        digest.has_value()) {
-      next_epoch.emplace(std::move(digest.value()));
-    }
-
     // Update local meta with the block
-    auto new_node = std::make_shared<TreeNode>(block_hash,
-                                               block_header.number,
-                                               parent,
-                                               epoch_number,
-                                               std::move(next_epoch));
-
-    tree_->updateMeta(new_node);
+    tree_->updateMeta(makeTreeNode(block_hash, block_header, parent));
 
     OUTCOME_TRY(reorganize());
 
@@ -776,6 +797,27 @@ namespace kagome::blockchain {
     return outcome::success();
   }
 
+  std::shared_ptr<TreeNode> BlockTreeImpl::makeTreeNode(
+      const primitives::BlockHash &hash,
+      const primitives::BlockHeader &header,
+      const std::shared_ptr<TreeNode> &parent) const {
+    consensus::EpochNumber epoch_number = 0;
+    auto babe_digests_res = consensus::getBabeDigests(header);
+    if (babe_digests_res.has_value()) {
+      auto babe_slot = babe_digests_res.value().second.slot_number;
+      epoch_number = babe_util_->slotToEpoch(babe_slot);
+    }
+
+    std::optional<consensus::EpochDigest> next_epoch;
+    if (auto digest = consensus::getNextEpochDigest(header);
+        digest.has_value()) {
+      next_epoch.emplace(std::move(digest.value()));
+    }
+
+    return std::make_shared<TreeNode>(
+        hash, header.number, parent, epoch_number, std::move(next_epoch));
+  }
+
   outcome::result<void> BlockTreeImpl::addBlockBody(
       primitives::BlockNumber block_number,
       const primitives::BlockHash &block_hash,
@@ -891,6 +933,40 @@ namespace kagome::blockchain {
     return outcome::success();
   }
 
+  outcome::result<void> BlockTreeImpl::resetToFinalized(
+      const primitives::BlockHeader &header,
+      const primitives::Justification &justification) {
+    OUTCOME_TRY(block_hash, storage_->putBlockHeader(header));
+    primitives::BlockInfo block(header.number, block_hash);
+    OUTCOME_TRY(storage_->putNumberToIndexKey(block));
+    OUTCOME_TRY(
+        storage_->putJustification(justification, block_hash, block.number));
+    OUTCOME_TRY(storage_->setBlockTreeLeaves({block_hash}));
+
+    auto epochs = loadRootEpochs(
+        *babe_api_, *babe_util_, *babe_configuration_, block, log_);
+    auto root = std::make_shared<TreeNode>(block_hash,
+                                           block.number,
+                                           std::move(epochs.current),
+                                           epochs.epoch_number,
+                                           std::move(epochs.next),
+                                           true);
+    auto meta = std::make_shared<TreeMeta>(root, justification);
+    tree_ = std::make_unique<CachedTree>(std::move(root), std::move(meta));
+
+    metric_known_chain_leaves_->set(1);
+    metric_best_block_height_->set(block.number);
+    metric_finalized_block_height_->set(block.number);
+
+    chain_events_engine_->notify(primitives::events::ChainEventType::kNewHeads,
+                                 header);
+    chain_events_engine_->notify(
+        primitives::events::ChainEventType::kFinalizedHeads, header);
+
+    SL_INFO(log_, "Block tree is reset to finalized block {}", block);
+    return outcome::success();
+  }
+
   outcome::result<bool> BlockTreeImpl::hasBlockHeader(
       const primitives::BlockId &block) const {
     return storage_->hasBlockHeader(block);
@@ -1316,6 +1392,110 @@ namespace kagome::blockchain {
     return primitives::BlockInfo{last->depth, last->block_hash};
   }
 
+  outcome::result<void> BlockTreeImpl::syncWithStorage() {
+    OUTCOME_TRY(leaves, storage_->getBlockTreeLeaves());
+
+    // Collect unknown blocks from each leaf down to the known ones
+    std::multimap<primitives::BlockInfo, primitives::BlockHeader> collected;
+    {
+      std::unordered_set<primitives::BlockHash> observed;
+      for (auto &leaf : leaves) {
+        for (auto hash = leaf;;) {
+          if (tree_->getRoot().findByHash(hash) != nullptr) {
+            break;
+          }
+
+          if (not observed.emplace(hash).second) {
+            break;
+          }
+
+          OUTCOME_TRY(header_opt, storage_->getBlockHeader(hash));
+          if (not header_opt.has_value()) {
+            SL_WARN(log_,
+                    "Can't get header of existing block {}: not found in block "
+                    "storage",
+                    hash);
+            break;
+          }
+
+          auto &header = header_opt.value();
+          if (header.number <= getLastFinalized().number) {
+            break;
+          }
+
+          auto parent_hash = header.parent_hash;
+          collected.emplace(primitives::BlockInfo(header.number, hash),
+                            std::move(header));
+          hash = parent_hash;
+        }
+      }
+    }
+
+    // Add them in ascending order, so parent is added before its children
+    for (auto &[block, header] : collected) {
+      auto parent = tree_->getRoot().findByHash(header.parent_hash);
+      if (parent == nullptr) {
+        SL_WARN(log_,
+                "Can't add block {} to block tree: parent is not found",
+                block);
+        continue;
+      }
+
+      tree_->updateMeta(makeTreeNode(block.hash, header, parent));
+
+      chain_events_engine_->notify(
+          primitives::events::ChainEventType::kNewHeads, header);
+    }
+
+    metric_known_chain_leaves_->set(tree_->getMetadata().leaves.size());
+    metric_best_block_height_->set(
+        tree_->getMetadata().deepest_leaf.lock()->depth);
+
+    OUTCOME_TRY(last_finalized, storage_->getLastFinalized());
+    if (last_finalized.number <= getLastFinalized().number) {
+      return outcome::success();
+    }
+
+    auto node = tree_->getRoot().findByHash(last_finalized.hash);
+    if (node == nullptr) {
+      return BlockTreeError::NON_FINALIZED_BLOCK_NOT_FOUND;
+    }
+
+    OUTCOME_TRY(header_opt, storage_->getBlockHeader(last_finalized.hash));
+    if (not header_opt.has_value()) {
+      return BlockTreeError::HEADER_NOT_FOUND;
+    }
+    OUTCOME_TRY(justification_opt,
+                storage_->getJustification(last_finalized.hash));
+
+    // Branches not containing finalized block are dropped with old root
+    node->finalized = true;
+    tree_->updateTreeRoot(
+        node, justification_opt.value_or(primitives::Justification{}));
+
+    chain_events_engine_->notify(
+        primitives::events::ChainEventType::kFinalizedHeads,
+        header_opt.value());
+
+    auto new_runtime_version = runtime_core_->version(last_finalized.hash);
+    if (new_runtime_version.has_value()) {
+      if (not actual_runtime_version_.has_value()
+          || actual_runtime_version_ != new_runtime_version.value()) {
+        actual_runtime_version_ = new_runtime_version.value();
+        chain_events_engine_->notify(
+            primitives::events::ChainEventType::kFinalizedRuntimeVersion,
+            new_runtime_version.value());
+      }
+    }
+
+    metric_known_chain_leaves_->set(tree_->getMetadata().leaves.size());
+    metric_best_block_height_->set(
+        tree_->getMetadata().deepest_leaf.lock()->depth);
+    metric_finalized_block_height_->set(last_finalized.number);
+
+    return outcome::success();
+  }
+
   outcome::result<consensus::EpochDigest> BlockTreeImpl::getEpochDigest(
       consensus::EpochNumber epoch_number,
       primitives::BlockHash block_hash) const {
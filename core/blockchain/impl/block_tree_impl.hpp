@@ -29,6 +29,7 @@
 #include "network/extrinsic_observer.hpp"
 #include "primitives/babe_configuration.hpp"
 #include "primitives/event_types.hpp"
+#include "runtime/runtime_api/babe_api.hpp"
 #include "runtime/runtime_api/core.hpp"
 #include "storage/trie/trie_storage.hpp"
 #include "subscription/extrinsic_event_key_repository.hpp"
@@ -62,6 +63,7 @@ namespace kagome::blockchain {
             extrinsic_event_key_repo,
         std::shared_ptr<runtime::Core> runtime_core,
         std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
+        std::shared_ptr<runtime::BabeApi> babe_api,
         std::shared_ptr<primitives::BabeConfiguration> babe_configuration,
         std::shared_ptr<consensus::BabeUtil> babe_util,
         std::shared_ptr<const class JustificationStoragePolicy>
@@ -111,6 +113,10 @@ namespace kagome::blockchain {
         const primitives::BlockHash &block_hash,
         const primitives::Justification &justification) override;
 
+    outcome::result<void> resetToFinalized(
+        const primitives::BlockHeader &header,
+        const primitives::Justification &justification) override;
+
     BlockHashVecRes getChainByBlock(
         const primitives::BlockHash &block) const override;
 
@@ -151,6 +157,14 @@ namespace kagome::blockchain {
 
     primitives::BlockInfo getLastFinalized() const override;
 
+    /**
+     * Loads blocks added and finalized since the last call by other process
+     * writing the same block storage. Storage is not modified, so it is
+     * suitable for read-only database. Notifies subscribers of chain events
+     * about new and finalized heads.
+     */
+    outcome::result<void> syncWithStorage();
+
     outcome::result<consensus::EpochDigest> getEpochDigest(
         consensus::EpochNumber epoch_number,
         primitives::BlockHash block_hash) const override;
@@ -173,6 +187,8 @@ namespace kagome::blockchain {
             extrinsic_event_key_repo,
         std::shared_ptr<runtime::Core> runtime_core,
         std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
+        std::shared_ptr<runtime::BabeApi> babe_api,
+        std::shared_ptr<primitives::BabeConfiguration> babe_configuration,
         std::shared_ptr<consensus::BabeUtil> babe_util,
         std::shared_ptr<const class JustificationStoragePolicy>
             justification_storage_policy);
@@ -204,6 +220,13 @@ namespace kagome::blockchain {
 
     outcome::result<void> reorganize();
 
+    /// Node of block {@param hash} with epoch and next epoch digest taken
+    /// from its {@param header}
+    std::shared_ptr<TreeNode> makeTreeNode(
+        const primitives::BlockHash &hash,
+        const primitives::BlockHeader &header,
+        const std::shared_ptr<TreeNode> &parent) const;
+
     std::shared_ptr<BlockHeaderRepository> header_repo_;
     std::shared_ptr<BlockStorage> storage_;
 
@@ -219,7 +242,9 @@ namespace kagome::blockchain {
     std::shared_ptr<runtime::Core> runtime_core_;
     std::shared_ptr<storage::changes_trie::ChangesTracker>
         trie_changes_tracker_;
-    std::shared_ptr<const consensus::BabeUtil> babe_util_;
+    std::shared_ptr<runtime::BabeApi> babe_api_;
+    std::shared_ptr<primitives::BabeConfiguration> babe_configuration_;
+    std::shared_ptr<consensus::BabeUtil> babe_util_;
     std::shared_ptr<const class JustificationStoragePolicy>
         justification_storage_policy_;
     std::shared_ptr<application::AppStateManager> app_state_manager_;
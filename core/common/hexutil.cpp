@@ -5,6 +5,9 @@
 
 #include "common/hexutil.hpp"
 
+#include <array>
+#include <cstring>
+
 #include <boost/algorithm/hex.hpp>
 #include <gsl/span>
 
@@ -49,9 +52,30 @@ namespace kagome::common {
     return res;
   }
 
+  namespace {
+    /// Pairs of lowercase hex digits of each byte value, so that a byte is
+    /// encoded by a single lookup and a two chars copy without branches
+    constexpr auto kHexLowerTable = [] {
+      constexpr char digits[] = "0123456789abcdef";
+      std::array<char, 512> table{};
+      for (size_t i = 0; i < 256; ++i) {
+        table[i * 2] = digits[i >> 4];
+        table[i * 2 + 1] = digits[i & 0xf];
+      }
+      return table;
+    }();
+  }  // namespace
+
+  void hex_lower_to(gsl::span<const uint8_t> bytes, char *out) noexcept {
+    for (auto byte : bytes) {
+      std::memcpy(out, &kHexLowerTable[byte * 2], 2);
+      out += 2;
+    }
+  }
+
   std::string hex_lower(const gsl::span<const uint8_t> bytes) noexcept {
     std::string res(bytes.size() * 2, '\x00');
-    boost::algorithm::hex_lower(bytes.begin(), bytes.end(), res.begin());
+    hex_lower_to(bytes, res.data());
     return res;
   }
 
@@ -62,8 +86,7 @@ namespace kagome::common {
     std::string res(bytes.size() * 2 + prefix_len, '\x00');
     res.replace(0, prefix_len, prefix, prefix_len);
 
-    boost::algorithm::hex_lower(
-        bytes.begin(), bytes.end(), res.begin() + prefix_len);
+    hex_lower_to(bytes, res.data() + prefix_len);
     return res;
   }
 
@@ -46,6 +46,13 @@ namespace kagome::common {
    */
   std::string hex_lower(gsl::span<const uint8_t> bytes) noexcept;
 
+  /**
+   * @brief Writes lowercase hex representation of bytes without allocations
+   * @param bytes to be converted
+   * @param out destination, must have room for 2 * bytes.size() chars
+   */
+  void hex_lower_to(gsl::span<const uint8_t> bytes, char *out) noexcept;
+
   /**
    * @brief Converts bytes to hex representation with prefix 0x
    * @param array bytes
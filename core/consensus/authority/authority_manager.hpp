@@ -134,6 +134,15 @@ namespace kagome::authority {
      * and won't be used anymore
      */
     virtual void prune(const primitives::BlockInfo &block) = 0;
+
+    /**
+     * @brief Makes {@param authorities} of finalized block {@param block},
+     * proven by warp sync, the root of scheduled changes. Changes scheduled
+     * before the block are not known and are dropped.
+     */
+    virtual outcome::result<void> warp(
+        const primitives::BlockInfo &block,
+        const primitives::AuthoritySet &authorities) = 0;
   };
 }  // namespace kagome::authority
 
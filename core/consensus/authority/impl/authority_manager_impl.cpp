@@ -78,8 +78,7 @@ namespace kagome::authority {
           break;
         }
 
-        // just obtained from block tree
-        auto header = block_tree.getBlockHeader(hash).value();
+        OUTCOME_TRY(header, block_tree.getBlockHeader(hash));
 
         // observe possible changes of authorities
         for (auto &digest_item : boost::adaptors::reverse(header.digest)) {
@@ -257,65 +256,100 @@ namespace kagome::authority {
 
   outcome::result<void> AuthorityManagerImpl::initializeAt(
       const primitives::BlockInfo &root_block) {
-    OUTCOME_TRY(collected_msgs,
-                collectMsgsFromNonFinalBlocks(*block_tree_, root_block.hash));
-
-    OUTCOME_TRY(graph_root_block,
-                collectConsensusMsgsUntilNearestSetChangeTo(
-                    collected_msgs, root_block, *block_tree_, log_));
-
-    OUTCOME_TRY(root_header,
-                block_tree_->getBlockHeader(graph_root_block.hash));
-
-    OUTCOME_TRY(set_id_from_runtime, readSetIdFromRuntime(root_header));
+    ScheduleTreeChange tree_change{*this};
 
     OUTCOME_TRY(opt_root, fetchScheduleGraphRoot(*persistent_storage_));
-    auto last_finalized_block = block_tree_->getLastFinalized();
-    if (opt_root
-        && opt_root.value()->current_block.number
-               <= last_finalized_block.number) {
-      // TODO(Harrm): #1334
-      // Correction to bypass the bug where after finishing syncing
-      // and restarting the node we get a set id off by one
-      if (opt_root.value()->current_authorities->id
-          == set_id_from_runtime - 1) {
-        auto &authority_list =
-            opt_root.value()->current_authorities->authorities;
-        opt_root.value()->current_authorities =
-            std::make_shared<primitives::AuthoritySet>(set_id_from_runtime,
-                                                       authority_list);
+
+    std::stack<ConsensusMessages> collected_msgs;
+    if (opt_root and isStoredRootUsable(*opt_root.value(), root_block)) {
+      // Stored root already contains all changes up to its block, so only
+      // messages of blocks above it have to be applied
+      auto &stored_root = opt_root.value();
+      auto msgs_res = collectMsgsFromNonFinalBlocks(
+          *block_tree_, stored_root->current_block.hash);
+      auto root_header_res =
+          block_tree_->getBlockHeader(stored_root->current_block.hash);
+      if (msgs_res.has_error() or root_header_res.has_error()) {
+        // Blocks above stored root can't be read, so recalculate the state
+        // up to the finalized block anew, like it is done on a cold start
+        SL_WARN(log_,
+                "Can't apply blocks above stored authority set graph root at "
+                "block {}: {}; recalculating the state",
+                stored_root->current_block,
+                (msgs_res.has_error() ? msgs_res.error()
+                                      : root_header_res.error())
+                    .message());
+        OUTCOME_TRY(recalculateStoredState(root_block.number));
+        OUTCOME_TRY(msgs,
+                    collectMsgsFromNonFinalBlocks(*block_tree_,
+                                                  root_block.hash));
+        collected_msgs = std::move(msgs);
+      } else {
+        collected_msgs = std::move(msgs_res.value());
+        auto &root_header = root_header_res.value();
+        // State of the root might be not synced yet, e.g. when it was set by
+        // warp sync; the set id is not corrected then
+        auto set_id_res = readSetIdFromRuntime(root_header);
+
+        // TODO(Harrm): #1334
+        // Correction to bypass the bug where after finishing syncing
+        // and restarting the node we get a set id off by one
+        if (set_id_res.has_value()
+            and stored_root->current_authorities->id
+                    == set_id_res.value() - 1) {
+          auto &authority_list = stored_root->current_authorities->authorities;
+          stored_root->current_authorities =
+              std::make_shared<primitives::AuthoritySet>(set_id_res.value(),
+                                                         authority_list);
+        }
+        root_ = std::move(stored_root);
+        SL_TRACE(log_,
+                 "Fetched authority set graph root from database with id {} "
+                 "at block {}",
+                 root_->current_authorities->id,
+                 root_->current_block);
       }
-      root_ = std::move(opt_root.value());
-      SL_TRACE(log_,
-               "Fetched authority set graph root from database with id {}",
-               root_->current_authorities->id);
-
-    } else if (last_finalized_block.number == 0) {
-      auto &genesis_hash = block_tree_->getGenesisBlockHash();
-      OUTCOME_TRY(initial_authorities, grandpa_api_->authorities(genesis_hash));
-      root_ = authority::ScheduleNode::createAsRoot(
-          std::make_shared<primitives::AuthoritySet>(
-              0, std::move(initial_authorities)),
-          {0, genesis_hash});
+
     } else {
-      SL_WARN(
-          log_,
-          "Storage does not contain valid info about the root authority set; "
-          "Fall back to obtaining it from the runtime storage (which may "
-          "fail after a forced authority change happened on chain)");
-      OUTCOME_TRY(authorities,
-                  grandpa_api_->authorities(graph_root_block.hash));
-
-      auto authority_set = std::make_shared<primitives::AuthoritySet>(
-          set_id_from_runtime, std::move(authorities));
-      root_ = authority::ScheduleNode::createAsRoot(authority_set,
-                                                    graph_root_block);
-
-      OUTCOME_TRY(storeScheduleGraphRoot(*persistent_storage_, *root_));
-      SL_TRACE(log_,
-               "Create authority set graph root with id {}, taken from runtime "
-               "storage",
-               root_->current_authorities->id);
+      OUTCOME_TRY(msgs,
+                  collectMsgsFromNonFinalBlocks(*block_tree_, root_block.hash));
+      collected_msgs = std::move(msgs);
+
+      OUTCOME_TRY(graph_root_block,
+                  collectConsensusMsgsUntilNearestSetChangeTo(
+                      collected_msgs, root_block, *block_tree_, log_));
+
+      if (root_block.number == 0) {
+        auto &genesis_hash = block_tree_->getGenesisBlockHash();
+        OUTCOME_TRY(initial_authorities,
+                    grandpa_api_->authorities(genesis_hash));
+        root_ = authority::ScheduleNode::createAsRoot(
+            std::make_shared<primitives::AuthoritySet>(
+                0, std::move(initial_authorities)),
+            {0, genesis_hash});
+      } else {
+        SL_WARN(log_,
+                "Storage does not contain valid info about the root authority "
+                "set; Fall back to obtaining it from the runtime storage "
+                "(which may fail after a forced authority change happened on "
+                "chain)");
+        OUTCOME_TRY(root_header,
+                    block_tree_->getBlockHeader(graph_root_block.hash));
+        OUTCOME_TRY(set_id_from_runtime, readSetIdFromRuntime(root_header));
+        OUTCOME_TRY(authorities,
+                    grandpa_api_->authorities(graph_root_block.hash));
+
+        auto authority_set = std::make_shared<primitives::AuthoritySet>(
+            set_id_from_runtime, std::move(authorities));
+        root_ = authority::ScheduleNode::createAsRoot(authority_set,
+                                                      graph_root_block);
+
+        OUTCOME_TRY(storeScheduleGraphRoot(*persistent_storage_, *root_));
+        SL_TRACE(log_,
+                 "Create authority set graph root with id {}, taken from "
+                 "runtime storage",
+                 root_->current_authorities->id);
+      }
     }
 
     while (not collected_msgs.empty()) {
@@ -344,6 +378,21 @@ namespace kagome::authority {
     return outcome::success();
   }
 
+  bool AuthorityManagerImpl::isStoredRootUsable(
+      const ScheduleNode &stored_root,
+      const primitives::BlockInfo &finalized_block) const {
+    const auto &root_block = stored_root.current_block;
+    if (root_block.number > finalized_block.number) {
+      return false;
+    }
+    if (root_block == finalized_block) {
+      return true;
+    }
+    // Stored root might be left on a block which is not finalized anymore,
+    // e.g. after the database was rolled back
+    return block_tree_->hasDirectChain(root_block.hash, finalized_block.hash);
+  }
+
   outcome::result<AuthoritySetId> AuthorityManagerImpl::readSetIdFromRuntime(
       primitives::BlockHeader const &header) const {
     AuthoritySetId set_id{};
@@ -362,6 +411,8 @@ namespace kagome::authority {
 
   outcome::result<void> AuthorityManagerImpl::recalculateStoredState(
       primitives::BlockNumber last_finalized_number) {
+    ScheduleTreeChange tree_change{*this};
+
     auto genesis_hash = block_tree_->getGenesisBlockHash();
 
     OUTCOME_TRY(initial_authorities, grandpa_api_->authorities(genesis_hash));
@@ -425,17 +476,68 @@ namespace kagome::authority {
   std::optional<std::shared_ptr<const primitives::AuthoritySet>>
   AuthorityManagerImpl::authorities(const primitives::BlockInfo &target_block,
                                     IsBlockFinalized finalized) const {
+    const auto last_finalized = block_tree_->getLastFinalized();
+
+    uint64_t generation = 0;
+    {
+      std::lock_guard lock(lookup_cache_mutex_);
+      generation = lookup_cache_generation_;
+      if (lookup_cache_finalized_ != last_finalized) {
+        lookup_cache_.clear();
+        lookup_cache_finalized_ = last_finalized;
+      }
+      if (auto it = lookup_cache_.find(target_block.hash);
+          it != lookup_cache_.end() and it->second.block == target_block) {
+        auto &cached =
+            finalized ? it->second.finalized : it->second.not_finalized;
+        if (cached != nullptr) {
+          return cached;
+        }
+      }
+    }
+
+    auto authorities =
+        calculateAuthorities(target_block, finalized, last_finalized);
+    if (authorities == nullptr) {
+      return std::nullopt;
+    }
+
+    // Unknown block might become a descendant of some scheduled change
+    // after import, so only authorities of known blocks are cached
+    auto has_header_res = block_tree_->hasBlockHeader(target_block.hash);
+    if (has_header_res.has_value() and has_header_res.value()) {
+      std::lock_guard lock(lookup_cache_mutex_);
+      if (lookup_cache_finalized_ == last_finalized
+          and lookup_cache_generation_ == generation) {
+        if (lookup_cache_.size() >= kLookupCacheCapacity) {
+          lookup_cache_.clear();
+        }
+        auto &entry = lookup_cache_[target_block.hash];
+        if (entry.block != target_block) {
+          entry = CachedLookup{target_block, nullptr, nullptr};
+        }
+        (finalized ? entry.finalized : entry.not_finalized) = authorities;
+      }
+    }
+
+    return authorities;
+  }
+
+  std::shared_ptr<const primitives::AuthoritySet>
+  AuthorityManagerImpl::calculateAuthorities(
+      const primitives::BlockInfo &target_block,
+      IsBlockFinalized finalized,
+      const primitives::BlockInfo &last_finalized) const {
     auto node = getAppropriateAncestor(target_block);
 
     if (node == nullptr) {
-      return std::nullopt;
+      return nullptr;
     }
 
     IsBlockFinalized node_in_finalized_chain =
         node->current_block == target_block
             ? (bool)finalized
-            : node->current_block.number
-                  <= block_tree_->getLastFinalized().number;
+            : node->current_block.number <= last_finalized.number;
 
     auto adjusted_node =
         node->makeDescendant(target_block, node_in_finalized_chain);
@@ -471,10 +573,50 @@ namespace kagome::authority {
     return authorities;
   }
 
+  AuthorityManagerImpl::ScheduleTreeChange::ScheduleTreeChange(
+      AuthorityManagerImpl &manager)
+      : manager_{manager} {
+    manager_.invalidateLookupCache();
+  }
+
+  AuthorityManagerImpl::ScheduleTreeChange::~ScheduleTreeChange() {
+    manager_.reindexScheduleTree();
+  }
+
+  void AuthorityManagerImpl::invalidateLookupCache() {
+    std::lock_guard lock(lookup_cache_mutex_);
+    lookup_cache_.clear();
+    node_index_.clear();
+    ++lookup_cache_generation_;
+  }
+
+  void AuthorityManagerImpl::reindexScheduleTree() {
+    std::unordered_map<primitives::BlockHash, std::shared_ptr<ScheduleNode>>
+        index;
+    if (root_ != nullptr) {
+      std::vector<std::shared_ptr<ScheduleNode>> pending{root_};
+      while (not pending.empty()) {
+        auto node = std::move(pending.back());
+        pending.pop_back();
+        pending.insert(
+            pending.end(), node->descendants.begin(), node->descendants.end());
+        auto hash = node->current_block.hash;
+        index.emplace(hash, std::move(node));
+      }
+    }
+
+    std::lock_guard lock(lookup_cache_mutex_);
+    lookup_cache_.clear();
+    ++lookup_cache_generation_;
+    node_index_ = std::move(index);
+  }
+
   outcome::result<void> AuthorityManagerImpl::applyScheduledChange(
       const primitives::BlockInfo &block,
       const primitives::AuthorityList &authorities,
       primitives::BlockNumber activate_at) {
+    ScheduleTreeChange tree_change{*this};
+
     SL_DEBUG(log_,
              "Applying scheduled change on block {} to activate at block {}",
              block,
@@ -556,6 +698,8 @@ namespace kagome::authority {
       const primitives::AuthorityList &authorities,
       primitives::BlockNumber delay_start,
       size_t delay) {
+    ScheduleTreeChange tree_change{*this};
+
     SL_DEBUG(log_,
              "Applying forced change (delay start: {}, delay: {}) on block {} "
              "to activate at block {}",
@@ -629,6 +773,8 @@ namespace kagome::authority {
 
   outcome::result<void> AuthorityManagerImpl::applyOnDisabled(
       const primitives::BlockInfo &block, uint64_t authority_index) {
+    ScheduleTreeChange tree_change{*this};
+
     if (!config_.on_disable_enabled) {
       SL_TRACE(log_, "Ignore 'on disabled' message due to config");
       return outcome::success();
@@ -698,6 +844,8 @@ namespace kagome::authority {
 
   outcome::result<void> AuthorityManagerImpl::applyPause(
       const primitives::BlockInfo &block, primitives::BlockNumber activate_at) {
+    ScheduleTreeChange tree_change{*this};
+
     SL_DEBUG(log_, "Applying pause on block {}", block);
 
     auto node = getAppropriateAncestor(block);
@@ -731,6 +879,8 @@ namespace kagome::authority {
 
   outcome::result<void> AuthorityManagerImpl::applyResume(
       const primitives::BlockInfo &block, primitives::BlockNumber activate_at) {
+    ScheduleTreeChange tree_change{*this};
+
     auto node = getAppropriateAncestor(block);
 
     if (not node) {
@@ -821,6 +971,8 @@ namespace kagome::authority {
       return;
     }
 
+    ScheduleTreeChange tree_change{*this};
+
     if (node->current_block == block) {
       // Rebase
       root_ = std::move(node);
@@ -842,10 +994,34 @@ namespace kagome::authority {
     SL_DEBUG(log_, "Prune authority manager upto block {}", block);
   }
 
+  outcome::result<void> AuthorityManagerImpl::warp(
+      const primitives::BlockInfo &block,
+      const primitives::AuthoritySet &authorities) {
+    ScheduleTreeChange tree_change{*this};
+
+    root_ = ScheduleNode::createAsRoot(
+        std::make_shared<primitives::AuthoritySet>(authorities), block);
+    OUTCOME_TRY(storeScheduleGraphRoot(*persistent_storage_, *root_));
+
+    SL_INFO(log_,
+            "Authority set #{} is set at block {} proven by warp sync",
+            authorities.id,
+            block);
+    return outcome::success();
+  }
+
   std::shared_ptr<ScheduleNode> AuthorityManagerImpl::getAppropriateAncestor(
       const primitives::BlockInfo &block) const {
     BOOST_ASSERT(root_ != nullptr);
 
+    {
+      std::lock_guard lock(lookup_cache_mutex_);
+      if (auto it = node_index_.find(block.hash);
+          it != node_index_.end() and it->second->current_block == block) {
+        return it->second;
+      }
+    }
+
     // Target block is not descendant of the current root
     if (root_->current_block.number > block.number
         || (root_->current_block != block
@@ -921,6 +1097,8 @@ namespace kagome::authority {
   }
 
   void AuthorityManagerImpl::cancel(const primitives::BlockInfo &block) {
+    ScheduleTreeChange tree_change{*this};
+
     auto ancestor = getAppropriateAncestor(block);
 
     if (ancestor == nullptr) {
@@ -9,6 +9,9 @@
 #include "consensus/authority/authority_manager.hpp"
 #include "consensus/authority/authority_update_observer.hpp"
 
+#include <mutex>
+#include <unordered_map>
+
 #include "crypto/hasher.hpp"
 #include "log/logger.hpp"
 #include "primitives/authority.hpp"
@@ -106,9 +109,70 @@ namespace kagome::authority {
 
     void prune(const primitives::BlockInfo &block) override;
 
+    outcome::result<void> warp(
+        const primitives::BlockInfo &block,
+        const primitives::AuthoritySet &authorities) override;
+
    private:
+    /// Max amount of blocks whose authorities are kept in lookup cache
+    static constexpr size_t kLookupCacheCapacity = 4096;
+
+    /// Authorities resolved for a block, valid while the schedule tree and
+    /// the last finalized block stay the same
+    struct CachedLookup {
+      primitives::BlockInfo block;
+      std::shared_ptr<const primitives::AuthoritySet> finalized;
+      std::shared_ptr<const primitives::AuthoritySet> not_finalized;
+    };
+
     outcome::result<void> initializeAt(const primitives::BlockInfo &root_block);
 
+    /**
+     * @brief Check if stored root of schedule graph can be used as is, so
+     * only changes of the blocks above it have to be applied
+     * @param stored_root - root fetched from persistent storage
+     * @param finalized_block - last finalized block
+     * @return true if stored root is on the chain of finalized block
+     */
+    bool isStoredRootUsable(const ScheduleNode &stored_root,
+                            const primitives::BlockInfo &finalized_block) const;
+
+    /**
+     * @brief Resolves authorities by walking the schedule tree
+     * @param target_block for which authorities are resolved
+     * @param finalized whether target block is finalized
+     * @param last_finalized - last finalized block of block tree
+     * @return authorities or nullptr if block is not descendant of the root
+     */
+    std::shared_ptr<const primitives::AuthoritySet> calculateAuthorities(
+        const primitives::BlockInfo &target_block,
+        IsBlockFinalized finalized,
+        const primitives::BlockInfo &last_finalized) const;
+
+    /**
+     * Marks a change of the schedule tree for its lifetime. Resolved
+     * authorities and indexed nodes are dropped before the change, and once
+     * it is done the cache is dropped again and the nodes are reindexed, so
+     * that lookups calculated during the change are not cached
+     */
+    class ScheduleTreeChange {
+     public:
+      explicit ScheduleTreeChange(AuthorityManagerImpl &manager);
+      ~ScheduleTreeChange();
+
+      ScheduleTreeChange(const ScheduleTreeChange &) = delete;
+      ScheduleTreeChange &operator=(const ScheduleTreeChange &) = delete;
+
+     private:
+      AuthorityManagerImpl &manager_;
+    };
+
+    /// Drops resolved authorities of all blocks and indexed nodes
+    void invalidateLookupCache();
+
+    /// Indexes nodes of the schedule tree by their blocks
+    void reindexScheduleTree();
+
     /**
      * @brief Find schedule_node according to the block
      * @param block for which to find the schedule node
@@ -141,6 +205,19 @@ namespace kagome::authority {
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
 
     std::shared_ptr<ScheduleNode> root_;
+
+    mutable std::mutex lookup_cache_mutex_;
+    mutable primitives::BlockInfo lookup_cache_finalized_;
+    /// Bumped on each invalidation, so lookups calculated concurrently with
+    /// a change of the schedule tree are not cached
+    mutable uint64_t lookup_cache_generation_ = 0;
+    mutable std::unordered_map<primitives::BlockHash, CachedLookup>
+        lookup_cache_;
+    /// Nodes of the schedule tree by their blocks; empty during a change of
+    /// the tree, when nodes are looked up by walking the tree
+    std::unordered_map<primitives::BlockHash, std::shared_ptr<ScheduleNode>>
+        node_index_;
+
     log::Logger log_;
   };
 }  // namespace kagome::authority
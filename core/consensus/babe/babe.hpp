@@ -25,6 +25,8 @@ namespace kagome::consensus::babe {
     enum class State {
       WAIT_REMOTE_STATUS,  // Node is just launched and waits status of remote
                            // peer to sync missing blocks
+      WARP_LOADING,        // Warp sync requested; phase of finality proof
+                           // downloading
       HEADERS_LOADING,     // Fast sync requested; phase of headers downloading
       HEADERS_LOADED,      // Fast sync requested; headers downloaded, ready to
                            // syncing of state
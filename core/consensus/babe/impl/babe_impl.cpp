@@ -162,6 +162,16 @@ namespace kagome::consensus::babe {
           current_state_ = State::HEADERS_LOADING;
         }
         break;
+
+      case SyncMethod::Warp:
+        if (synchronizer_->hasIncompleteRequestOfStateSync()) {
+          // Has incomplete downloading state; continue loading of state
+          current_state_ = State::STATE_LOADING;
+        } else {
+          // No incomplete downloading state; prove finality of target first
+          current_state_ = State::WARP_LOADING;
+        }
+        break;
     }
 
     return true;
@@ -295,6 +305,12 @@ namespace kagome::consensus::babe {
       return;
     }
 
+    // If finality proof is loading, just to ping of loading
+    if (current_state_ == Babe::State::WARP_LOADING) {
+      startWarpSyncing(peer_id);
+      return;
+    }
+
     const auto &last_finalized_block = block_tree_->getLastFinalized();
 
     auto current_best_block_res =
@@ -328,6 +344,12 @@ namespace kagome::consensus::babe {
       return;
     }
 
+    // If finality proof is loading, just to ping of loading
+    if (current_state_ == Babe::State::WARP_LOADING) {
+      startWarpSyncing(peer_id);
+      return;
+    }
+
     const auto &last_finalized_block = block_tree_->getLastFinalized();
 
     auto current_best_block_res =
@@ -503,6 +525,13 @@ namespace kagome::consensus::babe {
                       res.error().message());
               return;
             }
+            if (self->synchronizer_->hasIncompleteRequestOfStateSync()) {
+              SL_TRACE(self->log_,
+                       "No more state on block {} to be loaded from {}",
+                       block_at_state,
+                       peer_id);
+              return;
+            }
 
             SL_INFO(self->log_,
                     "State on block {} is synced successfully",
@@ -512,6 +541,34 @@ namespace kagome::consensus::babe {
         });
   }
 
+  void BabeImpl::startWarpSyncing(const libp2p::peer::PeerId &peer_id) {
+    BOOST_ASSERT(current_state_ == Babe::State::WARP_LOADING);
+
+    synchronizer_->syncWarp(
+        peer_id, [wp = weak_from_this(), peer_id](auto res) mutable {
+          if (auto self = wp.lock()) {
+            if (res.has_error()) {
+              SL_WARN(self->log_,
+                      "Warp syncing with {} is failed: {}",
+                      peer_id,
+                      res.error().message());
+              return;
+            }
+            if (self->current_state_ != Babe::State::WARP_LOADING) {
+              return;
+            }
+
+            // Proven block is the last finalized one now, so its state is
+            // synced straight away, without headers of its ancestry
+            SL_INFO(self->log_,
+                    "Finality of block {} is proven by warp sync",
+                    res.value());
+            self->current_state_ = Babe::State::HEADERS_LOADED;
+            self->startStateSyncing(peer_id);
+          }
+        });
+  }
+
   void BabeImpl::onSynchronized() {
     // won't start block production without keypair
     if (not keypair_) {
@@ -839,9 +896,12 @@ namespace kagome::consensus::babe {
     }
     const auto &babe_pre_digest = babe_pre_digest_res.value();
 
-    // create new block
-    auto pre_seal_block_res =
-        proposer_->propose(best_block_, inherent_data, {babe_pre_digest});
+    // create new block within the time budget tied to the slot
+    auto max_duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        babe_util_->remainToFinishOfSlot(current_slot_)
+        * kBlockProposalSlotPortion);
+    auto pre_seal_block_res = proposer_->propose(
+        best_block_, inherent_data, {babe_pre_digest}, max_duration);
     if (!pre_seal_block_res) {
       SL_ERROR(log_,
                "Cannot propose a block: {}",
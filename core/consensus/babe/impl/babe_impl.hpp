@@ -60,6 +60,10 @@ namespace kagome::consensus::babe {
   /// block production. This is an intentional relaxation of block dropping algo
   static constexpr auto kMaxBlockSlotsOvertime = 2;
 
+  /// Portion of the remaining slot time given to the proposer to build a
+  /// block, the rest is left for sealing, import and announcement
+  static constexpr double kBlockProposalSlotPortion = 2. / 3;
+
   class BabeImpl : public Babe, public std::enable_shared_from_this<BabeImpl> {
    public:
     /**
@@ -120,6 +124,8 @@ namespace kagome::consensus::babe {
 
     void startStateSyncing(const libp2p::peer::PeerId &peer_id);
 
+    void startWarpSyncing(const libp2p::peer::PeerId &peer_id);
+
     void runSlot();
 
     /**
@@ -600,7 +600,7 @@ namespace kagome::consensus::grandpa {
     tryExecuteNextRound(current_round_);
   }
 
-  void GrandpaImpl::onVoteMessage(const libp2p::peer::PeerId &peer_id,
+  bool GrandpaImpl::onVoteMessage(const libp2p::peer::PeerId &peer_id,
                                   const VoteMessage &msg) {
     // If a peer is at a given voter set, it is impolite to send messages from
     // an earlier voter set.
@@ -617,7 +617,7 @@ namespace kagome::consensus::grandpa {
           msg.round_number,
           peer_id,
           current_round_->voterSetId());
-      return;
+      return false;
     }
 
     // It is extremely impolite to send messages from a future voter set.
@@ -634,7 +634,7 @@ namespace kagome::consensus::grandpa {
               msg.round_number,
               peer_id,
               current_round_->voterSetId());
-      return;
+      return false;
     }
 
     // If the current peer is at round r, it is impolite to receive messages
@@ -652,7 +652,7 @@ namespace kagome::consensus::grandpa {
           msg.round_number,
           peer_id,
           current_round_->roundNumber());
-      return;
+      return false;
     }
 
     // If a peer is at round r, is extremely impolite to send messages about r+1
@@ -669,7 +669,7 @@ namespace kagome::consensus::grandpa {
               msg.round_number,
               peer_id,
               current_round_->roundNumber());
-      return;
+      return false;
     }
 
     std::optional<std::shared_ptr<VotingRound>> opt_target_round =
@@ -686,7 +686,7 @@ namespace kagome::consensus::grandpa {
           msg.counter,
           msg.round_number,
           peer_id);
-      return;
+      return false;
     }
     auto &target_round = opt_target_round.value();
 
@@ -741,9 +741,10 @@ namespace kagome::consensus::grandpa {
           ctx->vote.emplace(msg);
           loadMissingBlocks();
         }
+        return false;
       }
-      return;
     }
+    return true;
   }
 
   void GrandpaImpl::onCommitMessage(const libp2p::peer::PeerId &peer_id,
@@ -158,8 +158,9 @@ namespace kagome::consensus::grandpa {
      * @param peer_id id of remote peer
      * @param msg vote message that could be either primary propose, prevote, or
      * precommit message
+     * @return true if vote was processed by its round
      */
-    void onVoteMessage(const libp2p::peer::PeerId &peer_id,
+    bool onVoteMessage(const libp2p::peer::PeerId &peer_id,
                        const network::VoteMessage &msg) override;
 
     /**
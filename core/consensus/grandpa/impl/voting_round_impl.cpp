@@ -759,7 +759,7 @@ namespace kagome::consensus::grandpa {
       // Skip known equivocators
       if (auto index = voter_set_->voterIndex(signed_precommit.id);
           index.has_value()) {
-        if (precommit_equivocators_.at(index.value())) {
+        if (precommit_equivocators_.test(index.value())) {
           continue;
         }
       }
@@ -921,6 +921,15 @@ namespace kagome::consensus::grandpa {
 
   bool VotingRoundImpl::onPrevote(const SignedMessage &prevote,
                                   Propagation propagation) {
+    // Check voter before signature as much cheaper
+    if (not voter_set_->voterIndex(prevote.id).has_value()) {
+      SL_DEBUG(logger_,
+               "Round #{}: Prevote signed by {} was rejected: unknown voter",
+               round_number_,
+               prevote.id);
+      return false;
+    }
+
     bool isValid = vote_crypto_provider_->verifyPrevote(prevote);
     if (not isValid) {
       logger_->warn(
@@ -975,6 +984,15 @@ namespace kagome::consensus::grandpa {
 
   bool VotingRoundImpl::onPrecommit(const SignedMessage &precommit,
                                     Propagation propagation) {
+    // Check voter before signature as much cheaper
+    if (not voter_set_->voterIndex(precommit.id).has_value()) {
+      SL_DEBUG(logger_,
+               "Round #{}: Precommit signed by {} was rejected: unknown voter",
+               round_number_,
+               precommit.id);
+      return false;
+    }
+
     bool isValid = vote_crypto_provider_->verifyPrecommit(precommit);
     if (not isValid) {
       logger_->warn(
@@ -1097,7 +1115,7 @@ namespace kagome::consensus::grandpa {
     auto [type, type_str_, equivocators, tracker] =
         [&]() -> std::tuple<VoteType,
                             const char *const,
-                            std::vector<bool> &,
+                            VoterSet::Bitset &,
                             VoteTracker &> {
       if constexpr (std::is_same_v<T, Prevote>) {
         return {
@@ -1189,8 +1207,18 @@ namespace kagome::consensus::grandpa {
     };
 
     /// @see spec: Grandpa-Ghost
-    auto new_prevote_ghost =
-        graph_->findGhost(VoteType::Prevote, current_best, possible_to_prevote);
+    std::optional<BlockInfo> new_prevote_ghost;
+    auto prevotes_revision = graph_->revision(VoteType::Prevote);
+    if (prevote_ghost_cache_.has_value()
+        and prevote_ghost_cache_->current_best == current_best
+        and prevote_ghost_cache_->prevotes_revision == prevotes_revision) {
+      new_prevote_ghost = prevote_ghost_cache_->ghost;
+    } else {
+      new_prevote_ghost = graph_->findGhost(
+          VoteType::Prevote, current_best, possible_to_prevote);
+      prevote_ghost_cache_ = PrevoteGhostCache{
+          current_best, prevotes_revision, new_prevote_ghost};
+    }
 
     if (new_prevote_ghost.has_value()) {
       bool changed = new_prevote_ghost != prevote_ghost_;
@@ -1234,6 +1262,25 @@ namespace kagome::consensus::grandpa {
     }
     const auto &prevote_ghost = prevote_ghost_.value();
 
+    // Nothing to update if neither prevote ghost nor precommits were changed
+    auto precommits_revision = graph_->revision(VoteType::Precommit);
+    auto precommits_weight = precommits_->getTotalWeight();
+    if (estimate_cache_.has_value()
+        and estimate_cache_->prevote_ghost == prevote_ghost
+        and estimate_cache_->precommits_revision == precommits_revision
+        and estimate_cache_->precommits_weight == precommits_weight) {
+      SL_TRACE(logger_,
+               "Round #{}: updateEstimate->{} (inputs were not changed)",
+               round_number_,
+               estimate_cache_->result);
+      return estimate_cache_->result;
+    }
+    auto cache_result = [&](bool result) {
+      estimate_cache_ = EstimateCache{
+          prevote_ghost, precommits_revision, precommits_weight, result};
+      return result;
+    };
+
     // anything new finalized? finalized blocks are those which have both
     // 2/3+ prevote and precommit weight.
     if (precommits_->getTotalWeight() >= threshold_) {
@@ -1257,17 +1304,8 @@ namespace kagome::consensus::grandpa {
     const auto tolerated_equivocations = voter_set_->totalWeight() - threshold_;
 
     // get total weight of all equivocators
-    const auto current_equivocations = std::accumulate(
-        precommit_equivocators_.begin(),
-        precommit_equivocators_.end(),
-        0ul,
-        [this, index = 0ul](size_t sum, auto isEquivocator) mutable {
-          if (not isEquivocator) {
-            ++index;
-            return sum;
-          }
-          return sum + voter_set_->voterWeight(index++).value();
-        });
+    const auto current_equivocations =
+        voter_set_->weightOf(precommit_equivocators_);
 
     const auto additional_equivocations =
         tolerated_equivocations - current_equivocations;
@@ -1315,7 +1353,7 @@ namespace kagome::consensus::grandpa {
                "Round #{}: updateEstimate->false: pc weight not enough => "
                "estimate=pv_ghost",
                round_number_);
-      return false;
+      return cache_result(false);
     }
 
     estimate_ = graph_->findAncestor(
@@ -1368,7 +1406,7 @@ namespace kagome::consensus::grandpa {
       }
     }
 
-    return true;
+    return cache_result(true);
   }
 
   bool VotingRoundImpl::completable() const {
@@ -332,10 +332,10 @@ namespace kagome::consensus::grandpa {
     std::shared_ptr<VoteTracker> prevotes_;
     std::shared_ptr<VoteTracker> precommits_;
 
-    // equivocators arrays. Index in vector corresponds to the index of voter in
-    // voter set, value corresponds to the weight of the voter
-    std::vector<bool> prevote_equivocators_;
-    std::vector<bool> precommit_equivocators_;
+    // equivocators sets. Position of bit corresponds to the index of voter in
+    // voter set
+    VoterSet::Bitset prevote_equivocators_;
+    VoterSet::Bitset precommit_equivocators_;
 
     // Proposed primary vote.
     // It's best final candidate of previous round
@@ -361,6 +361,25 @@ namespace kagome::consensus::grandpa {
     std::optional<BlockInfo> estimate_;
     std::optional<BlockInfo> finalized_;
 
+    // Inputs and result of the last prevote ghost search. Search is repeated
+    // only if the base or prevotes in graph were changed since then.
+    struct PrevoteGhostCache {
+      BlockInfo current_best;
+      size_t prevotes_revision;
+      std::optional<BlockInfo> ghost;
+    };
+    std::optional<PrevoteGhostCache> prevote_ghost_cache_;
+
+    // Inputs and result of the last estimate update. Update is repeated only
+    // if prevote ghost or precommits in graph were changed since then.
+    struct EstimateCache {
+      BlockInfo prevote_ghost;
+      size_t precommits_revision;
+      size_t precommits_weight;
+      bool result;
+    };
+    std::optional<EstimateCache> estimate_cache_;
+
     libp2p::basic::Scheduler::Handle stage_timer_handle_;
     libp2p::basic::Scheduler::Handle pending_timer_handle_;
 
@@ -26,8 +26,10 @@ namespace kagome::consensus::grandpa {
      * Handler of grandpa vote messages
      * @param peer_id vote owner
      * @param msg vote message
+     * @return true if vote was processed by its round, false if it was
+     * dropped before that or postponed until missing blocks are loaded
      */
-    virtual void onVoteMessage(const libp2p::peer::PeerId &peer_id,
+    virtual bool onVoteMessage(const libp2p::peer::PeerId &peer_id,
                                const VoteMessage &msg) = 0;
 
     /**
@@ -79,6 +79,11 @@ namespace kagome::consensus::grandpa {
     /// Remove vote {@param vote_type} of {@param voter}
     virtual void remove(VoteType vote_type, const Id &voter) = 0;
 
+    /// Revision of votes of {@param vote_type}. It is changed each time when
+    /// weights of the votes might be changed, so results of searches made by
+    /// the same condition stay actual while revision is the same.
+    virtual size_t revision(VoteType vote_type) const = 0;
+
     /// Find the highest block which is either an ancestor of or equal to the
     /// given, which fulfills a condition.
     virtual std::optional<BlockInfo> findAncestor(
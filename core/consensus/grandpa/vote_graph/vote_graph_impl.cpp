@@ -110,10 +110,18 @@ namespace kagome::consensus::grandpa {
     // update cumulative vote data.
     // NOTE: below this point, there always exists a node with the given hash
     // and number.
+    // Cumulative vote of each node includes votes of all its descendants, so
+    // if vote is already counted by some node, it is counted by all its
+    // ancestors too, and there is nothing to update upper.
     BlockHash inspecting_hash = block.hash;
     while (true) {
       Entry &active_entry = entries_.at(inspecting_hash);
-      active_entry.cumulative_vote.set(vote_type, index, weight);
+      if (not active_entry.cumulative_vote.set(vote_type, index, weight)) {
+        break;
+      }
+      if (inspecting_hash == block.hash) {
+        bumpRevision(vote_type);
+      }
       auto parent_it = active_entry.ancestors.rbegin();
       if (parent_it != active_entry.ancestors.rend()) {
         inspecting_hash = *parent_it;
@@ -126,6 +134,10 @@ namespace kagome::consensus::grandpa {
   }
 
   void VoteGraphImpl::remove(VoteType vote_type, const Id &voter) {
+    // Removing is done for equivocators, whose weight is counted by the
+    // conditions anyway, so revision is changed even if no entry is affected
+    bumpRevision(vote_type);
+
     auto inw_res = voter_set_->indexAndWeight(voter);
     if (inw_res.has_value()) {
       const auto [index, weight] = inw_res.value();
@@ -135,6 +147,28 @@ namespace kagome::consensus::grandpa {
     }
   }
 
+  size_t VoteGraphImpl::revision(VoteType vote_type) const {
+    switch (vote_type) {
+      case VoteType::Prevote:
+        return prevotes_revision_;
+      case VoteType::Precommit:
+        return precommits_revision_;
+    }
+    BOOST_UNREACHABLE_RETURN({});
+  }
+
+  void VoteGraphImpl::bumpRevision(VoteType vote_type) {
+    switch (vote_type) {
+      case VoteType::Prevote:
+        ++prevotes_revision_;
+        return;
+      case VoteType::Precommit:
+        ++precommits_revision_;
+        return;
+    }
+    BOOST_UNREACHABLE_RETURN();
+  }
+
   outcome::result<void> VoteGraphImpl::append(const BlockInfo &block) {
     if (base_.hash == block.hash) {
       return outcome::success();
@@ -282,15 +316,17 @@ namespace kagome::consensus::grandpa {
       }
     }
 
-    Entry active_node = entries_.at(node_key);
-    if (not condition(active_node.cumulative_vote)) {
+    // Entries are not changed during search, so they are pointed instead of
+    // copying each time when better node is found
+    const Entry *active_node = &entries_.at(node_key);
+    if (not condition(active_node->cumulative_vote)) {
       return std::nullopt;
     }
 
     /// entries to be processed
     std::stack<std::reference_wrapper<const Entry>> nodes;
 
-    nodes.push(active_node);
+    nodes.push(*active_node);
     while (not nodes.empty()) {
       auto &node = nodes.top().get();
       nodes.pop();
@@ -308,12 +344,12 @@ namespace kagome::consensus::grandpa {
           continue;
         }
 
-        if (descendant.number > active_node.number
-            or (descendant.number == active_node.number
-                and active_node.cumulative_vote.sum(vote_type)
+        if (descendant.number > active_node->number
+            or (descendant.number == active_node->number
+                and active_node->cumulative_vote.sum(vote_type)
                         < descendant.cumulative_vote.sum(vote_type))) {
           node_key = descendant_hash;
-          active_node = descendant;
+          active_node = &descendant;
 
           nodes.push(descendant);
         }
@@ -326,7 +362,7 @@ namespace kagome::consensus::grandpa {
         force_constrain ? current_best : std::nullopt;
 
     Subchain subchain =
-        ghostFindMergePoint(vote_type, node_key, active_node, info, condition);
+        ghostFindMergePoint(vote_type, node_key, *active_node, info, condition);
     auto &hashes = subchain.hashes;
 
     if (hashes.empty()) {
@@ -435,6 +471,9 @@ namespace kagome::consensus::grandpa {
 
     entries_[new_hash] = std::move(new_entry);
     base_ = BlockInfo{new_number, new_hash};
+
+    bumpRevision(VoteType::Prevote);
+    bumpRevision(VoteType::Precommit);
   }
 
   std::optional<BlockInfo> VoteGraphImpl::findAncestor(
@@ -35,6 +35,8 @@ namespace kagome::consensus::grandpa {
     /// Remove vote {@param vote_type} of {@param voter}
     void remove(VoteType vote_type, const Id &voter) override;
 
+    size_t revision(VoteType vote_type) const override;
+
     /// Find the highest block which is either an ancestor of or equal to the
     /// given, which fulfills a condition.
     std::optional<BlockInfo> findAncestor(
@@ -106,12 +108,17 @@ namespace kagome::consensus::grandpa {
     }
 
    private:
+    void bumpRevision(VoteType vote_type);
+
     BlockInfo base_;
     std::shared_ptr<VoterSet> voter_set_;
     std::shared_ptr<Chain> chain_;
 
     std::unordered_map<BlockHash, Entry> entries_;
     std::unordered_set<BlockHash> heads_;
+
+    size_t prevotes_revision_ = 0;
+    size_t precommits_revision_ = 0;
   };
 
 }  // namespace kagome::consensus::grandpa
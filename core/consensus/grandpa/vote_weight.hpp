@@ -6,9 +6,9 @@
 #ifndef KAGOME_CORE_CONSENSUS_GRANDPA_VOTE_WEIGHT_HPP
 #define KAGOME_CORE_CONSENSUS_GRANDPA_VOTE_WEIGHT_HPP
 
+#include <algorithm>
 #include <numeric>
 
-#include <boost/dynamic_bitset.hpp>
 #include <boost/operators.hpp>
 #include "consensus/grandpa/structs.hpp"
 #include "consensus/grandpa/vote_types.hpp"
@@ -25,56 +25,69 @@ namespace kagome::consensus::grandpa {
    public:
     using Weight = size_t;
 
+    /**
+     * Weight of votes of one type. Voters are kept as bitset, so merging of
+     * weights is word-wise OR, and counting is popcount over the words
+     */
     struct OneTypeVoteWeight {
-      std::vector<bool> flags;
+      VoterSet::Bitset flags;
       Weight sum = 0;
 
-      void set(size_t index, size_t weight) {
+      /// @return true if weight has been changed
+      bool set(size_t index, size_t weight) {
         if (flags.size() <= index) {
-          flags.resize(index + 1, 0);
+          flags.resize(index + 1);
         }
-        if (flags[index]) {
-          return;
+        if (flags.test(index)) {
+          return false;
         }
-        flags[index] = true;
+        flags.set(index);
         sum += weight;
+        return true;
       }
 
-      void unset(size_t index, size_t weight) {
+      /// @return true if weight has been changed
+      bool unset(size_t index, size_t weight) {
         if (flags.size() <= index) {
-          return;
+          return false;
         }
-        if (not flags[index]) {
-          return;
+        if (not flags.test(index)) {
+          return false;
         }
-        flags[index] = false;
+        flags.reset(index);
         sum -= weight;
+        return true;
       }
 
-      Weight total(const std::vector<bool> &equivocators,
+      Weight total(const VoterSet::Bitset &equivocators,
                    const VoterSet &voter_set) const {
-        Weight result = sum;
-
-        for (size_t i = voter_set.size(); i > 0;) {
-          --i;
-
-          if ((flags.size() <= i or not flags[i]) and equivocators.size() > i
-              and equivocators[i]) {
-            result += voter_set.voterWeight(i).value();
-          }
+        if (equivocators.none()) {
+          return sum;
         }
 
-        return result;
+        // equivocators are counted as voted, even if their votes are absent
+        auto absent_equivocators = equivocators;
+        auto voted = flags;
+        voted.resize(absent_equivocators.size());
+        absent_equivocators -= voted;
+
+        return sum + voter_set.weightOf(absent_equivocators);
       }
 
       void merge(const OneTypeVoteWeight &other,
                  const std::shared_ptr<VoterSet> &voter_set) {
-        for (auto i = other.flags.size(); i > 0;) {
-          --i;
-          if (other.flags[i]) {
-            set(i, voter_set->voterWeight(i).value());
-          }
+        if (other.flags.none()) {
+          return;
         }
+
+        auto size = std::max(flags.size(), other.flags.size());
+        flags.resize(size);
+        auto added = other.flags;
+        added.resize(size);
+        added -= flags;
+
+        sum += voter_set->weightOf(added);
+        flags |= added;
       }
 
       bool operator==(const OneTypeVoteWeight &other) const {
@@ -92,28 +105,28 @@ namespace kagome::consensus::grandpa {
       BOOST_UNREACHABLE_RETURN({});
     }
 
-    void set(VoteType vote_type, size_t index, size_t weight) {
+    bool set(VoteType vote_type, size_t index, size_t weight) {
       switch (vote_type) {
         case VoteType::Prevote:
           return prevotes_weight.set(index, weight);
         case VoteType::Precommit:
           return precommits_weight.set(index, weight);
       }
-      BOOST_UNREACHABLE_RETURN();
+      BOOST_UNREACHABLE_RETURN(false);
     }
 
-    void unset(VoteType vote_type, size_t index, size_t weight) {
+    bool unset(VoteType vote_type, size_t index, size_t weight) {
       switch (vote_type) {
         case VoteType::Prevote:
           return prevotes_weight.unset(index, weight);
         case VoteType::Precommit:
           return precommits_weight.unset(index, weight);
       }
-      BOOST_UNREACHABLE_RETURN();
+      BOOST_UNREACHABLE_RETURN(false);
     }
 
     Weight total(VoteType vote_type,
-                 const std::vector<bool> &equivocators,
+                 const VoterSet::Bitset &equivocators,
                  const VoterSet &voter_set) const {
       switch (vote_type) {
         case VoteType::Prevote:
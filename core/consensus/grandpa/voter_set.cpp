@@ -29,18 +29,49 @@ namespace kagome::consensus::grandpa {
     // be queried it should be fine
     if (voter == Id{}) {
       list_.emplace_back(voter, weight);
-      total_weight_ += weight;
+      addWeight(weight);
       return outcome::success();
     }
     auto r = map_.emplace(voter, map_.size());
     if (r.second) {
       list_.emplace_back(r.first->first, weight);
-      total_weight_ += weight;
+      addWeight(weight);
       return outcome::success();
     }
     return Error::VOTER_ALREADY_EXISTS;
   }
 
+  void VoterSet::addWeight(Weight weight) {
+    if (not weights_.empty() and weights_.front() != weight) {
+      is_weight_uniform_ = false;
+    }
+    weights_.push_back(weight);
+    total_weight_ += weight;
+  }
+
+  VoterSet::Weight VoterSet::weightOf(const Bitset &voters) const {
+    if (is_weight_uniform_) {
+      if (weights_.empty()) {
+        return 0;
+      }
+      // bits beyond the voters are not counted, as in the general case
+      auto count = voters.count();
+      for (auto index = voters.find_next(weights_.size() - 1);
+           index != Bitset::npos;
+           index = voters.find_next(index)) {
+        --count;
+      }
+      return count * weights_.front();
+    }
+    Weight result = 0;
+    for (auto index = voters.find_first();
+         index != Bitset::npos and index < weights_.size();
+         index = voters.find_next(index)) {
+      result += weights_[index];
+    }
+    return result;
+  }
+
   outcome::result<Id> VoterSet::voterId(Index index) const {
     if (index >= list_.size()) {
       return Error::INDEX_OUTBOUND;
@@ -92,10 +123,9 @@ namespace kagome::consensus::grandpa {
   }
 
   outcome::result<VoterSet::Weight> VoterSet::voterWeight(Index index) const {
-    if (index >= list_.size()) {
+    if (index >= weights_.size()) {
       return Error::INDEX_OUTBOUND;
     }
-    auto weight = std::get<1>(list_.at(index));
-    return weight;
+    return weights_[index];
   }
 }  // namespace kagome::consensus::grandpa
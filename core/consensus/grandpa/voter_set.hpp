@@ -8,6 +8,8 @@
 
 #include <optional>
 
+#include <boost/dynamic_bitset.hpp>
+
 #include "common/outcome_throw.hpp"
 #include "consensus/grandpa/common.hpp"
 
@@ -28,6 +30,9 @@ namespace kagome::consensus::grandpa {
     using Index = size_t;
     using Weight = size_t;
 
+    /// Dense set of voters, where bit position corresponds to index of voter
+    using Bitset = boost::dynamic_bitset<uint64_t>;
+
     VoterSet() = default;  // for scale codec (in decode)
 
     explicit VoterSet(VoterSetId id_of_set);
@@ -79,12 +84,25 @@ namespace kagome::consensus::grandpa {
       return total_weight_;
     }
 
+    /**
+     * \return total weight of voters presented in \param voters
+     */
+    Weight weightOf(const Bitset &voters) const;
+
    private:
+    void addWeight(Weight weight);
+
     VoterSetId id_{};
     std::unordered_map<Id, Index> map_;
     std::vector<std::tuple<const Id &, Weight>> list_;
     size_t total_weight_{0};
 
+    // weights of voters by index, to sum them up without lookup
+    std::vector<Weight> weights_;
+    // all voters have the same weight, so weight of voters is proportional to
+    // their amount
+    bool is_weight_uniform_ = true;
+
     template <class Stream>
     friend Stream &operator<<(Stream &s, const VoterSet &voters);
     template <class Stream>
@@ -103,6 +121,8 @@ namespace kagome::consensus::grandpa {
     voters.list_.clear();
     voters.map_.clear();
     voters.total_weight_ = 0;
+    voters.weights_.clear();
+    voters.is_weight_uniform_ = true;
 
     std::vector<std::tuple<Id, VoterSet::Weight>> list;
     s >> list >> voters.id_;
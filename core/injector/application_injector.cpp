@@ -96,13 +96,17 @@
 #include "network/impl/extrinsic_observer_impl.hpp"
 #include "network/impl/grandpa_transmitter_impl.hpp"
 #include "network/impl/peer_manager_impl.hpp"
+#include "network/impl/peer_scoring_impl.hpp"
 #include "network/impl/rating_repository_impl.hpp"
 #include "network/impl/router_libp2p.hpp"
 #include "network/impl/state_protocol_observer_impl.hpp"
 #include "network/impl/sync_protocol_observer_impl.hpp"
+#include "network/impl/warp_protocol_observer_impl.hpp"
 #include "network/impl/synchronizer_impl.hpp"
 #include "network/impl/transactions_transmitter_impl.hpp"
+#include "network/impl/transactions_validation_queue.hpp"
 #include "network/sync_protocol_observer.hpp"
+#include "network/warp_protocol_observer.hpp"
 #include "offchain/impl/offchain_local_storage.hpp"
 #include "offchain/impl/offchain_persistent_storage.hpp"
 #include "offchain/impl/offchain_worker_factory_impl.hpp"
@@ -155,6 +159,7 @@
 #include "telemetry/impl/service_impl.hpp"
 #include "transaction_pool/impl/pool_moderator_impl.hpp"
 #include "transaction_pool/impl/transaction_pool_impl.hpp"
+#include "transaction_pool/impl/transaction_pool_revalidator.hpp"
 
 namespace {
   template <class T>
@@ -391,10 +396,12 @@ namespace {
     }
     options.max_open_files = soft_limit.value() / 2;
 
-    auto db_res =
-        storage::RocksDB::create(app_config.databasePath(chain_spec->id()),
-                                 options,
-                                 prevent_destruction);
+    auto db_path = app_config.databasePath(chain_spec->id());
+    auto db_res = app_config.dbSecondaryPath().has_value()
+                    ? storage::RocksDB::createSecondary(
+                        db_path, app_config.dbSecondaryPath().value(), options)
+                    : storage::RocksDB::create(
+                        db_path, options, prevent_destruction);
     if (!db_res) {
       auto log = log::createLogger("Injector", "injector");
       log->critical("Can't create RocksDB in {}: {}",
@@ -541,6 +548,8 @@ namespace {
     auto block_tree = injector.template create<sptr<blockchain::BlockTree>>();
     auto trie_storage =
         injector.template create<sptr<storage::trie::TrieStorage>>();
+    auto config =
+        injector.template create<const api::ApiServiceImpl::Configuration &>();
 
     auto api_service =
         std::make_shared<api::ApiServiceImpl>(asmgr,
@@ -553,7 +562,8 @@ namespace {
                                               ext_sub_engine,
                                               extrinsic_event_key_repo,
                                               block_tree,
-                                              trie_storage);
+                                              trie_storage,
+                                              config);
 
     auto child_state_api =
         injector.template create<std::shared_ptr<api::ChildStateApi>>();
@@ -604,6 +614,7 @@ namespace {
         injector.template create<std::shared_ptr<runtime::Core>>();
     auto changes_tracker = injector.template create<
         std::shared_ptr<storage::changes_trie::ChangesTracker>>();
+    auto babe_api = injector.template create<sptr<runtime::BabeApi>>();
     auto babe_configuration =
         injector
             .template create<std::shared_ptr<primitives::BabeConfiguration>>();
@@ -622,6 +633,7 @@ namespace {
         std::move(ext_events_key_repo),
         std::move(runtime_core),
         std::move(changes_tracker),
+        std::move(babe_api),
         std::move(babe_configuration),
         std::move(babe_util),
         std::move(justification_storage_policy));
@@ -671,7 +683,8 @@ namespace {
         injector.template create<sptr<network::Router>>(),
         injector.template create<sptr<storage::BufferStorage>>(),
         injector.template create<sptr<crypto::Hasher>>(),
-        injector.template create<sptr<network::PeerRatingRepository>>());
+        injector.template create<sptr<network::PeerRatingRepository>>(),
+        injector.template create<sptr<network::PeerScoring>>());
 
     auto protocol_factory =
         injector.template create<std::shared_ptr<network::ProtocolFactory>>();
@@ -994,12 +1007,26 @@ namespace {
     api::RpcThreadPool::Configuration rpc_thread_pool_config{};
     api::HttpSession::Configuration http_config{};
     api::WsSession::Configuration ws_config{};
+    api::JRpcServerImpl::Configuration jrpc_server_config{};
+    api::ApiServiceImpl::Configuration api_service_config{};
     transaction_pool::PoolModeratorImpl::Params pool_moderator_config{};
     transaction_pool::TransactionPool::Limits tp_pool_limits{};
+    transaction_pool::TransactionPoolRevalidator::Config
+        tp_revalidator_config{};
     libp2p::protocol::PingConfig ping_config{};
+    network::TransactionsValidationQueue::Config txs_validation_config{};
     host_api::OffchainExtensionConfig offchain_ext_config{
         config.isOffchainIndexingEnabled()};
 
+    jrpc_server_config.max_concurrent_calls = config.rpcMaxConcurrentCalls();
+    for (auto &[method, limit] : config.rpcMethodConcurrentCalls()) {
+      jrpc_server_config.method_concurrent_calls[method] = limit;
+    }
+    if (config.dbSecondaryPath().has_value()) {
+      // block tree is refreshed between calls
+      jrpc_server_config.calls_lock = std::make_shared<std::shared_mutex>();
+    }
+
     auto get_state_observer_impl = [](auto const &injector) {
       auto state_observer =
           std::make_shared<network::StateProtocolObserverImpl>(
@@ -1028,14 +1055,34 @@ namespace {
       return sync_observer;
     };
 
+    auto get_warp_observer_impl = [](auto const &injector) {
+      auto warp_observer = std::make_shared<network::WarpProtocolObserverImpl>(
+          injector.template create<sptr<application::AppStateManager>>(),
+          injector.template create<sptr<blockchain::BlockTree>>(),
+          injector.template create<sptr<blockchain::BlockHeaderRepository>>(),
+          injector.template create<
+              primitives::events::ChainSubscriptionEnginePtr>());
+
+      auto protocol_factory =
+          injector.template create<std::shared_ptr<network::ProtocolFactory>>();
+
+      protocol_factory->setWarpObserver(warp_observer);
+
+      return warp_observer;
+    };
+
     return di::make_injector(
         // bind configs
         useConfig(rpc_thread_pool_config),
         useConfig(http_config),
         useConfig(ws_config),
+        useConfig(jrpc_server_config),
+        useConfig(api_service_config),
         useConfig(pool_moderator_config),
         useConfig(tp_pool_limits),
+        useConfig(tp_revalidator_config),
         useConfig(ping_config),
+        useConfig(txs_validation_config),
         useConfig(offchain_ext_config),
 
         // inherit host injector
@@ -1085,6 +1132,22 @@ namespace {
         }),
         di::bind<api::ApiServiceImpl::ProcessorSpan>.to([](auto const
                                                                &injector) {
+          const application::AppConfiguration &config =
+              injector.template create<application::AppConfiguration const &>();
+          if (config.dbSecondaryPath().has_value()) {
+            // database is read-only, so only methods reading it are served
+            static std::vector<std::shared_ptr<api::JRpcProcessor>>
+                read_only_processors{
+                    injector.template create<std::shared_ptr<
+                        api::child_state::ChildStateJrpcProcessor>>(),
+                    injector.template create<
+                        std::shared_ptr<api::state::StateJrpcProcessor>>(),
+                    injector.template create<
+                        std::shared_ptr<api::chain::ChainJrpcProcessor>>(),
+                    injector.template create<
+                        std::shared_ptr<api::rpc::RpcJRpcProcessor>>()};
+            return api::ApiServiceImpl::ProcessorSpan{read_only_processors};
+          }
           static std::vector<std::shared_ptr<api::JRpcProcessor>> processors{
               injector.template create<
                   std::shared_ptr<api::child_state::ChildStateJrpcProcessor>>(),
@@ -1193,7 +1256,7 @@ namespace {
           auto babe_api = injector.template create<sptr<runtime::BabeApi>>();
           if (injector.template create<application::AppConfiguration const &>()
                   .syncMethod()
-              == application::AppConfiguration::SyncMethod::Fast) {
+              != application::AppConfiguration::SyncMethod::Full) {
             auto genesis_block_header =
                 injector
                     .template create<sptr<primitives::GenesisBlockHeader>>();
@@ -1212,6 +1275,7 @@ namespace {
         di::bind<crypto::VRFProvider>.template to<crypto::VRFProviderImpl>(),
         di::bind<network::StreamEngine>.template to<network::StreamEngine>(),
         di::bind<network::PeerRatingRepository>.template to<network::PeerRatingRepositoryImpl>(),
+        di::bind<network::PeerScoring>.template to<network::PeerScoringImpl>(),
         di::bind<crypto::Bip39Provider>.template to<crypto::Bip39ProviderImpl>(),
         di::bind<crypto::Pbkdf2Provider>.template to<crypto::Pbkdf2ProviderImpl>(),
         di::bind<crypto::Secp256k1Provider>.template to<crypto::Secp256k1ProviderImpl>(),
@@ -1232,6 +1296,7 @@ namespace {
         di::bind<storage::changes_trie::ChangesTracker>.template to<storage::changes_trie::StorageChangesTrackerImpl>(),
         bind_by_lambda<network::StateProtocolObserver>(get_state_observer_impl),
         bind_by_lambda<network::SyncProtocolObserver>(get_sync_observer_impl),
+        bind_by_lambda<network::WarpProtocolObserver>(get_warp_observer_impl),
         di::bind<parachain::AvailabilityStore>.template to<parachain::AvailabilityStoreImpl>(),
         di::bind<parachain::ParachainObserverImpl>.to([](auto const &injector) {
           return get_parachain_observer_impl(injector);
@@ -1601,6 +1666,11 @@ namespace kagome::injector {
     return pimpl_->injector_.create<sptr<network::SyncProtocolObserver>>();
   }
 
+  std::shared_ptr<network::WarpProtocolObserver>
+  KagomeNodeInjector::injectWarpObserver() {
+    return pimpl_->injector_.create<sptr<network::WarpProtocolObserver>>();
+  }
+
   std::shared_ptr<parachain::ParachainObserverImpl>
   KagomeNodeInjector::injectParachainObserver() {
     return pimpl_->injector_.create<sptr<parachain::ParachainObserverImpl>>();
@@ -1642,6 +1712,12 @@ namespace kagome::injector {
     return pimpl_->injector_.create<sptr<telemetry::TelemetryService>>();
   }
 
+  std::shared_ptr<transaction_pool::TransactionPoolRevalidator>
+  KagomeNodeInjector::injectTransactionPoolRevalidator() {
+    return pimpl_->injector_
+        .create<sptr<transaction_pool::TransactionPoolRevalidator>>();
+  }
+
   std::shared_ptr<application::mode::PrintChainInfoMode>
   KagomeNodeInjector::injectPrintChainInfoMode() {
     return pimpl_->injector_
@@ -1665,4 +1741,10 @@ namespace kagome::injector {
     return pimpl_->injector_.create<sptr<storage::BufferStorage>>();
   }
 
+  std::shared_ptr<std::shared_mutex> KagomeNodeInjector::injectRpcCallsLock() {
+    return pimpl_->injector_
+        .create<const api::JRpcServerImpl::Configuration &>()
+        .calls_lock;
+  }
+
 }  // namespace kagome::injector
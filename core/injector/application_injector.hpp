@@ -7,6 +7,7 @@
 #define KAGOME_CORE_INJECTOR_APPLICATION_INJECTOR_HPP
 
 #include <memory>
+#include <shared_mutex>
 
 #include <boost/asio/io_context.hpp>
 
@@ -39,6 +40,7 @@ namespace kagome {
     class PeerManager;
     class StateProtocolObserver;
     class SyncProtocolObserver;
+    class WarpProtocolObserver;
   }  // namespace network
 
   namespace parachain {
@@ -76,6 +78,10 @@ namespace kagome {
     class TelemetryService;
   }
 
+  namespace transaction_pool {
+    class TransactionPoolRevalidator;
+  }
+
 }  // namespace kagome
 
 namespace kagome::injector {
@@ -100,6 +106,7 @@ namespace kagome::injector {
     std::shared_ptr<consensus::babe::Babe> injectBabe();
     std::shared_ptr<network::StateProtocolObserver> injectStateObserver();
     std::shared_ptr<network::SyncProtocolObserver> injectSyncObserver();
+    std::shared_ptr<network::WarpProtocolObserver> injectWarpObserver();
     std::shared_ptr<parachain::ParachainObserverImpl> injectParachainObserver();
     std::shared_ptr<parachain::ParachainProcessorImpl>
     injectParachainProcessor();
@@ -108,9 +115,13 @@ namespace kagome::injector {
     std::shared_ptr<storage::trie::TrieStorage> injectTrieStorage();
     std::shared_ptr<metrics::MetricsWatcher> injectMetricsWatcher();
     std::shared_ptr<telemetry::TelemetryService> injectTelemetryService();
+    std::shared_ptr<transaction_pool::TransactionPoolRevalidator>
+    injectTransactionPoolRevalidator();
     std::shared_ptr<blockchain::BlockTree> injectBlockTree();
     std::shared_ptr<runtime::Executor> injectExecutor();
     std::shared_ptr<storage::BufferStorage> injectStorage();
+    /// Lock held shared by RPC calls in read-only RPC mode, nullptr otherwise
+    std::shared_ptr<std::shared_mutex> injectRpcCallsLock();
 
     std::shared_ptr<application::mode::PrintChainInfoMode>
     injectPrintChainInfoMode();
@@ -34,8 +34,7 @@ namespace kagome::network {
 
         if (src_block.body)
           for (const auto &ext_body : *src_block.body)
-            dst_block->add_body(
-                vector_to_string(scale::encode(ext_body).value()));
+            write_extrinsic(*dst_block->add_body(), ext_body);
 
         if (src_block.receipt)
           dst_block->set_receipt(src_block.receipt->toString());
@@ -127,6 +126,16 @@ namespace kagome::network {
       return AdaptersError::EMPTY_DATA;
     }
 
+    /// Writes SCALE encoding of extrinsic (i.e. its length and data) right
+    /// into the field, without intermediate encoded copy of data
+    static void write_extrinsic(std::string &dst,
+                                const primitives::Extrinsic &extrinsic) {
+      auto encoded = primitives::encodeExtrinsic(extrinsic);
+      dst.reserve(encoded.size());
+      dst.append(encoded.length.begin(), encoded.length.end());
+      dst.append(encoded.data.begin(), encoded.data.end());
+    }
+
     static std::string vector_to_string(std::vector<uint8_t> &&src) {
       return std::string(reinterpret_cast<char *>(src.data()),  // NOLINT
                          src.size());
@@ -16,6 +16,7 @@ namespace kagome::network {
 
   const libp2p::peer::Protocol kStateProtocol = "/{}/state/2";
   const libp2p::peer::Protocol kSyncProtocol = "/{}/sync/2";
+  const libp2p::peer::Protocol kWarpProtocol = "/{}/sync/warp";
   const libp2p::peer::Protocol kPropagateTransactionsProtocol =
       "/{}/transactions/1";
   const libp2p::peer::Protocol kBlockAnnouncesProtocol =
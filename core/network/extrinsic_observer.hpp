@@ -14,6 +14,7 @@ namespace kagome::api {
 }
 namespace kagome::primitives {
   struct Extrinsic;
+  struct Transaction;
 }
 
 namespace kagome::network {
@@ -24,6 +25,21 @@ namespace kagome::network {
 
     virtual outcome::result<common::Hash256> onTxMessage(
         const primitives::Extrinsic &extrinsic) = 0;
+
+    /**
+     * Validates extrinsic received from network without changing the pool,
+     * so may be called from any thread
+     * @return transaction to be submitted by {@see submitTx}
+     */
+    virtual outcome::result<primitives::Transaction> validateTx(
+        const primitives::Extrinsic &extrinsic) = 0;
+
+    /**
+     * Submits transaction returned by {@see validateTx} into the pool
+     * @return hash of submitted transaction
+     */
+    virtual outcome::result<common::Hash256> submitTx(
+        primitives::Transaction &&tx) = 0;
   };
 
 }  // namespace kagome::network
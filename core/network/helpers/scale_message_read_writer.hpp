@@ -10,6 +10,7 @@
 #include <memory>
 
 #include <libp2p/basic/message_read_writer_uvarint.hpp>
+#include <libp2p/multi/uvarint.hpp>
 #include <outcome/outcome.hpp>
 
 #include "scale/scale.hpp"
@@ -80,6 +81,29 @@ namespace kagome::network {
                           });
     }
 
+    /**
+     * SCALE-encode a message and prepend it with varint length, i.e. make the
+     * same bytes as write() puts into the channel
+     * @tparam MsgType - type of the message
+     * @param msg to be encoded
+     * @return immutable bytes, which can be written to any number of streams
+     * without encoding the message again
+     */
+    template <typename MsgType>
+    static outcome::result<std::shared_ptr<const std::vector<uint8_t>>>
+    encodeWithLength(const MsgType &msg) {
+      OUTCOME_TRY(encoded_msg, scale::encode(msg));
+      libp2p::multi::UVarint length{encoded_msg.size()};
+
+      std::vector<uint8_t> bytes;
+      bytes.reserve(length.size() + encoded_msg.size());
+      bytes.insert(bytes.end(),
+                   length.toVector().begin(),
+                   length.toVector().end());
+      bytes.insert(bytes.end(), encoded_msg.begin(), encoded_msg.end());
+      return std::make_shared<const std::vector<uint8_t>>(std::move(bytes));
+    }
+
    private:
     std::shared_ptr<libp2p::basic::MessageReadWriter> read_writer_;
   };
@@ -0,0 +1,254 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/block_download_scheduler.hpp"
+
+#include <algorithm>
+
+#include <boost/assert.hpp>
+
+namespace kagome::network {
+
+  BlockDownloadScheduler::BlockDownloadScheduler(
+      const primitives::BlockInfo &anchor,
+      primitives::BlockNumber target,
+      uint32_t segment_size,
+      size_t window,
+      ThroughputOf throughput_of)
+      : linked_{anchor},
+        target_{target},
+        segment_size_{segment_size},
+        window_{window},
+        throughput_of_{std::move(throughput_of)},
+        next_{anchor.number + 1} {
+    BOOST_ASSERT(segment_size_ > 0);
+    BOOST_ASSERT(window_ > 0);
+  }
+
+  void BlockDownloadScheduler::extend(primitives::BlockNumber target) {
+    target_ = std::max(target_, target);
+  }
+
+  void BlockDownloadScheduler::addPeer(const libp2p::peer::PeerId &peer_id,
+                                       primitives::BlockNumber best) {
+    auto &stats = peers_[peer_id];
+    stats.best = std::max(stats.best, best);
+  }
+
+  std::vector<libp2p::peer::PeerId> BlockDownloadScheduler::peers() const {
+    std::vector<libp2p::peer::PeerId> peers;
+    peers.reserve(peers_.size());
+    for (auto &[peer_id, stats] : peers_) {
+      if (stats.failures < kMaxPeerFailures) {
+        peers.emplace_back(peer_id);
+      }
+    }
+    return peers;
+  }
+
+  std::optional<BlockDownloadScheduler::Segment> BlockDownloadScheduler::assign(
+      const libp2p::peer::PeerId &peer_id, Clock::time_point now) {
+    auto peer_it = peers_.find(peer_id);
+    if (peer_it == peers_.end()
+        or peer_it->second.failures >= kMaxPeerFailures) {
+      return std::nullopt;
+    }
+    if (peer_it->second.requesting) {
+      return std::nullopt;
+    }
+    const auto best = peer_it->second.best;
+
+    fillWindow();
+
+    auto own_throughput = throughput(peer_id);
+
+    std::optional<primitives::BlockNumber> stuck;
+    std::optional<primitives::BlockNumber> free;
+    std::optional<primitives::BlockNumber> slower;
+    for (auto &[first, state] : segments_) {
+      if (first > best) {
+        break;
+      }
+      auto &assignment = state.assignment;
+      if (not assignment.has_value()) {
+        if (not free.has_value()) {
+          free = first;
+        }
+        continue;
+      }
+
+      // Take over the segment from stuck or much slower peer
+      if (now - assignment->since > kSlowRequestDuration) {
+        stuck = first;
+        break;
+      }
+      if (not slower.has_value() and own_throughput.has_value()) {
+        auto other_throughput = throughput(assignment->peer_id);
+        if (other_throughput.has_value()
+            and other_throughput.value() * kSlowPeerFactor
+                    < own_throughput.value()) {
+          slower = first;
+        }
+      }
+    }
+
+    auto candidate = stuck ? stuck : free ? free : slower;
+    if (not candidate.has_value()) {
+      return std::nullopt;
+    }
+
+    auto &state = segments_[candidate.value()];
+    state.assignment = Assignment{peer_id, now};
+    peer_it->second.requesting = true;
+    return Segment{candidate.value(),
+                   static_cast<uint32_t>(state.last - candidate.value() + 1)};
+  }
+
+  bool BlockDownloadScheduler::isAssigned(
+      const Segment &segment, const libp2p::peer::PeerId &peer_id) const {
+    auto it = segments_.find(segment.first);
+    if (it == segments_.end()) {
+      return false;
+    }
+    const auto &state = it->second;
+    return state.last + 1 == segment.first + segment.amount
+       and state.assignment.has_value()
+       and state.assignment->peer_id == peer_id;
+  }
+
+  bool BlockDownloadScheduler::onLoaded(
+      const Segment &segment,
+      const libp2p::peer::PeerId &peer_id,
+      std::vector<primitives::BlockData> blocks) {
+    BOOST_ASSERT(isAssigned(segment, peer_id));
+    auto it = segments_.find(segment.first);
+    auto &stats = peers_[peer_id];
+    stats.requesting = false;
+
+    // Count blocks of the segment, which make a chain
+    size_t count = 0;
+    for (; count < blocks.size() and count < segment.amount; ++count) {
+      const auto &block = blocks[count];
+      if (not block.header.has_value()
+          or block.header->number != segment.first + count
+          or (count != 0
+              and block.header->parent_hash != blocks[count - 1].hash)) {
+        count = 0;
+        break;
+      }
+    }
+    if (count == 0) {
+      ++stats.failures;
+      it->second.assignment.reset();
+      return false;
+    }
+
+    auto last = it->second.last;
+    segments_.erase(it);
+    if (segment.first + count <= last) {
+      segments_.emplace(segment.first + count,
+                        SegmentState{last, std::nullopt});
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      loaded_.emplace(segment.first + i,
+                      LoadedBlock{std::move(blocks[i]), peer_id});
+    }
+    return true;
+  }
+
+  void BlockDownloadScheduler::onFailed(const Segment &segment,
+                                        const libp2p::peer::PeerId &peer_id) {
+    auto &stats = peers_[peer_id];
+    ++stats.failures;
+    stats.requesting = false;
+    if (isAssigned(segment, peer_id)) {
+      segments_[segment.first].assignment.reset();
+    }
+  }
+
+  void BlockDownloadScheduler::onOutdated(const libp2p::peer::PeerId &peer_id) {
+    if (auto it = peers_.find(peer_id); it != peers_.end()) {
+      it->second.requesting = false;
+    }
+  }
+
+  std::vector<BlockDownloadScheduler::LoadedBlock>
+  BlockDownloadScheduler::takeLinked() {
+    std::vector<LoadedBlock> linked;
+    while (not loaded_.empty()) {
+      auto it = loaded_.begin();
+      if (it->first != linked_.number + 1) {
+        break;
+      }
+
+      auto &block = it->second;
+      auto repeated =
+          mismatch_.has_value() and mismatch_->number == it->first;
+      if (block.data.header->parent_hash != linked_.hash) {
+        // Chain of the peer doesn't match the linked one; load its blocks
+        // again from other peers to find out which chain is wrong
+        auto peer_id = block.peer_id;
+        if (not linked_peer_id_.has_value()
+            or (repeated and mismatch_->peer_id == peer_id)) {
+          // Anchor is known locally, or the peer insists on its chain alone
+          ++peers_[peer_id].failures;
+        } else if (repeated) {
+          // Other peer doesn't match the linked chain as well
+          ++peers_[linked_peer_id_.value()].failures;
+          mismatch_.reset();
+        } else {
+          mismatch_ = Mismatch{it->first, peer_id};
+        }
+        auto first = it->first;
+        auto next = first;
+        while (it != loaded_.end() and it->first == next
+               and it->second.peer_id == peer_id) {
+          it = loaded_.erase(it);
+          ++next;
+        }
+        segments_.emplace(first, SegmentState{next - 1, std::nullopt});
+        break;
+      }
+
+      if (repeated) {
+        // Reloaded block is linked, so dropped blocks were wrong
+        ++peers_[mismatch_->peer_id].failures;
+        mismatch_.reset();
+      }
+      linked_ = {it->first, block.data.hash};
+      linked_peer_id_ = block.peer_id;
+      linked.emplace_back(std::move(block));
+      loaded_.erase(it);
+    }
+    return linked;
+  }
+
+  std::optional<double> BlockDownloadScheduler::throughput(
+      const libp2p::peer::PeerId &peer_id) const {
+    if (not throughput_of_) {
+      return std::nullopt;
+    }
+    return throughput_of_(peer_id);
+  }
+
+  size_t BlockDownloadScheduler::failures(
+      const libp2p::peer::PeerId &peer_id) const {
+    auto it = peers_.find(peer_id);
+    return it == peers_.end() ? 0 : it->second.failures;
+  }
+
+  void BlockDownloadScheduler::fillWindow() {
+    auto limit = std::min<primitives::BlockNumber>(
+        target_, linked_.number + segment_size_ * window_);
+    while (next_ <= limit) {
+      auto last =
+          std::min<primitives::BlockNumber>(next_ + segment_size_ - 1, target_);
+      segments_.emplace(next_, SegmentState{last, std::nullopt});
+      next_ = last + 1;
+    }
+  }
+
+}  // namespace kagome::network
@@ -0,0 +1,202 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_BLOCKDOWNLOADSCHEDULER
+#define KAGOME_NETWORK_BLOCKDOWNLOADSCHEDULER
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <libp2p/peer/peer_id.hpp>
+
+#include "primitives/block_data.hpp"
+#include "primitives/common.hpp"
+
+namespace kagome::network {
+
+  /**
+   * Splits the range of blocks above the anchor (the best common block) up to
+   * the target into segments of fixed size, which are loaded concurrently
+   * from different peers. Keeps assignment of segments to peers; throughput
+   * of peers is not tracked here, but taken from peer scoring.
+   *
+   * Segments may be loaded in any order. Loaded blocks are handed out by
+   * takeLinked() strictly in order of numbers, once they are linked to the
+   * chain of already handed out ones.
+   */
+  class BlockDownloadScheduler {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Provides bytes per second loaded from the peer, if known
+    using ThroughputOf = std::function<std::optional<double>(
+        const libp2p::peer::PeerId &)>;
+
+    /// Max amount of failed requests, after which peer isn't used anymore
+    static constexpr size_t kMaxPeerFailures = 3;
+
+    /// Duration of request, after which its segment might be reassigned
+    static constexpr std::chrono::seconds kSlowRequestDuration{20};
+
+    /// Segment is reassigned to a peer if current one is slower in this times
+    static constexpr size_t kSlowPeerFactor = 4;
+
+    /// Blocks to be requested from a peer
+    struct Segment {
+      primitives::BlockNumber first;
+      uint32_t amount;
+
+      bool operator==(const Segment &other) const {
+        return first == other.first and amount == other.amount;
+      }
+    };
+
+    struct LoadedBlock {
+      primitives::BlockData data;
+      /// Peer the block was loaded from
+      libp2p::peer::PeerId peer_id;
+    };
+
+    /**
+     * @param anchor - block known locally, loading starts after it
+     * @param target - number of the last block to be loaded
+     * @param segment_size - max amount of blocks in a segment
+     * @param window - max amount of segments above the last linked block,
+     * which might be loaded simultaneously
+     * @param throughput_of - throughput of peers, to take segments over from
+     * much slower ones; none disables it
+     */
+    BlockDownloadScheduler(const primitives::BlockInfo &anchor,
+                           primitives::BlockNumber target,
+                           uint32_t segment_size,
+                           size_t window,
+                           ThroughputOf throughput_of = {});
+
+    /// Moves target further, if provided one is above the current
+    void extend(primitives::BlockNumber target);
+
+    /// Adds the peer having block {@param best} to the peers loading blocks
+    void addPeer(const libp2p::peer::PeerId &peer_id,
+                 primitives::BlockNumber best);
+
+    /// @return peers, which might be used for loading
+    std::vector<libp2p::peer::PeerId> peers() const;
+
+    /**
+     * Picks a segment to be loaded by the peer. Prefers segments of stuck
+     * requests, then not assigned ones with lowest numbers, then ones loaded
+     * by much slower peers. Peer whose segment is taken over stays busy until
+     * its request completes.
+     * @return segment to be requested or none if peer has to stay idle
+     */
+    std::optional<Segment> assign(const libp2p::peer::PeerId &peer_id,
+                                  Clock::time_point now);
+
+    /// @return true if the segment is still assigned to the peer, i.e. its
+    /// response has to be processed
+    bool isAssigned(const Segment &segment,
+                    const libp2p::peer::PeerId &peer_id) const;
+
+    /**
+     * Records blocks loaded for the segment. Blocks beyond the segment are
+     * ignored; not loaded rest of the segment becomes free for assignment.
+     * @return false if response is not a chain of blocks of the segment; it
+     * is counted as failure of the peer then
+     */
+    bool onLoaded(const Segment &segment,
+                  const libp2p::peer::PeerId &peer_id,
+                  std::vector<primitives::BlockData> blocks);
+
+    /// Releases the segment for reassignment after failed request
+    void onFailed(const Segment &segment, const libp2p::peer::PeerId &peer_id);
+
+    /// Releases the peer, whose response came after its segment was taken
+    /// over by another peer
+    void onOutdated(const libp2p::peer::PeerId &peer_id);
+
+    /**
+     * Hands out loaded blocks following the last linked block. If the next
+     * block is not a child of the last linked one, blocks loaded from the
+     * same peer are dropped to be loaded again from another peer. The blame
+     * is decided by the reloaded blocks: if they link, the peer of dropped
+     * blocks gets failure; if they don't link as well, the peer of the last
+     * linked block does.
+     * @return linked blocks in order of numbers
+     */
+    std::vector<LoadedBlock> takeLinked();
+
+    /// @return last handed out block (or anchor)
+    const primitives::BlockInfo &linked() const {
+      return linked_;
+    }
+
+    primitives::BlockNumber target() const {
+      return target_;
+    }
+
+    /// @return true if all blocks up to the target are handed out
+    bool complete() const {
+      return linked_.number >= target_;
+    }
+
+    /// @return amount of failures of the peer
+    size_t failures(const libp2p::peer::PeerId &peer_id) const;
+
+   private:
+    struct Assignment {
+      libp2p::peer::PeerId peer_id;
+      Clock::time_point since;
+    };
+
+    struct SegmentState {
+      /// Number of the last block of the segment
+      primitives::BlockNumber last;
+      std::optional<Assignment> assignment;
+    };
+
+    struct PeerStats {
+      primitives::BlockNumber best = 0;
+      size_t failures = 0;
+      /// Request of the peer is in flight, even if its segment is taken over
+      bool requesting = false;
+    };
+
+    /// Blocks dropped as not linked to the last linked block
+    struct Mismatch {
+      primitives::BlockNumber number;
+      libp2p::peer::PeerId peer_id;
+    };
+
+    /// Creates segments up to the target within the window
+    void fillWindow();
+
+    std::optional<double> throughput(const libp2p::peer::PeerId &peer_id) const;
+
+    primitives::BlockInfo linked_;
+    /// Peer the last linked block was loaded from, none for the anchor
+    std::optional<libp2p::peer::PeerId> linked_peer_id_;
+    /// Blocks following the last linked one, which have been dropped
+    std::optional<Mismatch> mismatch_;
+    primitives::BlockNumber target_;
+    const uint32_t segment_size_;
+    const size_t window_;
+    const ThroughputOf throughput_of_;
+
+    /// Not loaded segments by number of the first block
+    std::map<primitives::BlockNumber, SegmentState> segments_;
+    /// Number of the first block not covered by any segment yet
+    primitives::BlockNumber next_;
+    /// Loaded but not linked blocks by number
+    std::map<primitives::BlockNumber, LoadedBlock> loaded_;
+    std::unordered_map<libp2p::peer::PeerId, PeerStats> peers_;
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_BLOCKDOWNLOADSCHEDULER
@@ -22,4 +22,15 @@ namespace kagome::network {
                                   extrinsic);
   }
 
+  outcome::result<primitives::Transaction> ExtrinsicObserverImpl::validateTx(
+      const primitives::Extrinsic &extrinsic) {
+    return pool_->constructTransaction(primitives::TransactionSource::External,
+                                       extrinsic);
+  }
+
+  outcome::result<common::Hash256> ExtrinsicObserverImpl::submitTx(
+      primitives::Transaction &&tx) {
+    return pool_->submitTransaction(std::move(tx));
+  }
+
 }  // namespace kagome::network
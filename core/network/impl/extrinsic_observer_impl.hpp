@@ -24,6 +24,12 @@ namespace kagome::network {
     outcome::result<common::Hash256> onTxMessage(
         const primitives::Extrinsic &extrinsic) override;
 
+    outcome::result<primitives::Transaction> validateTx(
+        const primitives::Extrinsic &extrinsic) override;
+
+    outcome::result<common::Hash256> submitTx(
+        primitives::Transaction &&tx) override;
+
    private:
     std::shared_ptr<kagome::transaction_pool::TransactionPool> pool_;
     log::Logger logger_;
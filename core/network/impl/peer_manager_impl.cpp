@@ -45,7 +45,8 @@ namespace kagome::network {
       std::shared_ptr<network::Router> router,
       std::shared_ptr<storage::BufferStorage> storage,
       std::shared_ptr<crypto::Hasher> hasher,
-      std::shared_ptr<PeerRatingRepository> peer_rating_repository)
+      std::shared_ptr<PeerRatingRepository> peer_rating_repository,
+      std::shared_ptr<PeerScoring> peer_scoring)
       : app_state_manager_(std::move(app_state_manager)),
         host_(host),
         identify_(std::move(identify)),
@@ -60,6 +61,7 @@ namespace kagome::network {
         storage_{std::move(storage)},
         hasher_{std::move(hasher)},
         peer_rating_repository_{std::move(peer_rating_repository)},
+        peer_scoring_{std::move(peer_scoring)},
         log_(log::createLogger("PeerManager", "network")) {
     BOOST_ASSERT(app_state_manager_ != nullptr);
     BOOST_ASSERT(identify_ != nullptr);
@@ -70,6 +72,7 @@ namespace kagome::network {
     BOOST_ASSERT(storage_ != nullptr);
     BOOST_ASSERT(hasher_ != nullptr);
     BOOST_ASSERT(peer_rating_repository_ != nullptr);
+    BOOST_ASSERT(peer_scoring_ != nullptr);
 
     // Register metrics
     registry_->registerGaugeFamily(syncPeerMetricName,
@@ -270,9 +273,21 @@ namespace kagome::network {
       disconnectFromPeer(peer_id);
     }
 
-    // Soft limit is exceeded
-    if (active_peers_.size() > soft_limit) {
-      // Get oldest peer
+    // Hard limit is exceeded
+    if (active_peers_.size() > hard_limit) {
+      // Get peer with the lowest score
+      if (auto worst_peer_id = peer_scoring_->worstPeer();
+          worst_peer_id.has_value()) {
+        SL_DEBUG(log_,
+                 "Hard limit of active peers is exceeded; "
+                 "disconnecting from peer {} with the lowest score {:.3f}",
+                 worst_peer_id.value(),
+                 peer_scoring_->score(worst_peer_id.value()).value_or(0.));
+        disconnectFromPeer(worst_peer_id.value());
+      }
+
+    } else if (active_peers_.size() > soft_limit) {
+      // Soft limit is exceeded: get oldest peer
       auto it = std::min_element(active_peers_.begin(),
                                  active_peers_.end(),
                                  [](const auto &item1, const auto &item2) {
@@ -281,12 +296,7 @@ namespace kagome::network {
                                  });
       auto &[oldest_peer_id, oldest_descr] = *it;
 
-      if (active_peers_.size() > hard_limit) {
-        // Hard limit is exceeded
-        SL_DEBUG(log_, "Hard limit of of active peers is exceeded");
-        disconnectFromPeer(oldest_peer_id);
-
-      } else if (oldest_descr.time_point + peer_ttl < clock_->now()) {
+      if (oldest_descr.time_point + peer_ttl < clock_->now()) {
         // Peer is inactive long time
         auto &oldest_peer_id_ref = oldest_peer_id;
         SL_DEBUG(log_, "Found inactive peer: {}", oldest_peer_id_ref);
@@ -414,6 +424,7 @@ namespace kagome::network {
       SL_DEBUG(log_, "Disconnect from peer {}", peer_id);
       stream_engine_->del(peer_id);
       active_peers_.erase(it);
+      peer_scoring_->removePeer(peer_id);
       sync_peer_num_->set(active_peers_.size());
       SL_DEBUG(log_, "Remained {} active peers", active_peers_.size());
     }
@@ -518,6 +529,11 @@ namespace kagome::network {
     return it->second;
   }
 
+  std::optional<PeerStats> PeerManagerImpl::getPeerStats(
+      const PeerId &peer_id) const {
+    return peer_scoring_->stats(peer_id);
+  }
+
   void PeerManagerImpl::processDiscoveredPeer(const PeerId &peer_id) {
     // Ignore himself
     if (isSelfPeer(peer_id)) {
@@ -639,6 +655,7 @@ namespace kagome::network {
                     peer_id, PeerDescriptor{peer_type, self->clock_->now()});
                 added) {
               self->recently_active_peers_.insert(peer_id);
+              self->peer_scoring_->addPeer(peer_id);
 
               // And remove from queue
               if (auto piq_it = self->peers_in_queue_.find(peer_id);
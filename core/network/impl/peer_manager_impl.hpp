@@ -31,6 +31,7 @@
 #include "network/impl/protocols/propagate_transactions_protocol.hpp"
 #include "network/impl/protocols/protocol_factory.hpp"
 #include "network/impl/stream_engine.hpp"
+#include "network/peer_scoring.hpp"
 #include "network/protocols/sync_protocol.hpp"
 #include "network/rating_repository.hpp"
 #include "network/router.hpp"
@@ -70,7 +71,8 @@ namespace kagome::network {
         std::shared_ptr<network::Router> router,
         std::shared_ptr<storage::BufferStorage> storage,
         std::shared_ptr<crypto::Hasher> hasher,
-        std::shared_ptr<PeerRatingRepository> peer_rating_repository);
+        std::shared_ptr<PeerRatingRepository> peer_rating_repository,
+        std::shared_ptr<PeerScoring> peer_scoring);
 
     /** @see AppStateManager::takeControl */
     bool prepare();
@@ -139,6 +141,10 @@ namespace kagome::network {
     std::optional<std::reference_wrapper<PeerState>> getPeerState(
         const PeerId &peer_id) override;
 
+    /** @see PeerManager::getPeerStats */
+    std::optional<PeerStats> getPeerStats(
+        const PeerId &peer_id) const override;
+
    private:
     /// Right way to check self peer as it takes into account dev mode
     bool isSelfPeer(const PeerId &peer_id) const;
@@ -176,6 +182,7 @@ namespace kagome::network {
     std::shared_ptr<storage::BufferStorage> storage_;
     std::shared_ptr<crypto::Hasher> hasher_;
     std::shared_ptr<PeerRatingRepository> peer_rating_repository_;
+    std::shared_ptr<PeerScoring> peer_scoring_;
 
     libp2p::event::Handle add_peer_handle_;
     std::unordered_set<PeerId> peers_in_queue_;
@@ -0,0 +1,205 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/peer_scoring_impl.hpp"
+
+#include <algorithm>
+
+namespace {
+  constexpr const char *kResponseTime = "kagome_peer_response_time";
+  constexpr const char *kBestScore = "kagome_peer_score_best";
+  constexpr const char *kWorstScore = "kagome_peer_score_worst";
+}  // namespace
+
+namespace kagome::network {
+
+  PeerScoringImpl::PeerScoringImpl()
+      : log_(log::createLogger("PeerScoring", "network")) {
+    // Register metrics
+    registry_->registerHistogramFamily(
+        kResponseTime, "Time taken by peers to respond to requests");
+    metric_response_time_ = registry_->registerHistogramMetric(
+        kResponseTime, {0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10});
+    registry_->registerGaugeFamily(kBestScore, "The highest score of peers");
+    metric_best_score_ = registry_->registerGaugeMetric(kBestScore);
+    registry_->registerGaugeFamily(kWorstScore, "The lowest score of peers");
+    metric_worst_score_ = registry_->registerGaugeMetric(kWorstScore);
+    updateMetrics();
+  }
+
+  void PeerScoringImpl::addPeer(const PeerId &peer_id) {
+    std::lock_guard lock{mutex_};
+    auto [it, added] = peers_.emplace(peer_id, Entry{});
+    if (not added) {
+      return;
+    }
+    auto &entry = it->second;
+    entry.stats.score = kNeutralScore;
+    entry.position = by_score_.emplace(entry.stats.score, peer_id).first;
+    updateMetrics();
+  }
+
+  void PeerScoringImpl::removePeer(const PeerId &peer_id) {
+    std::lock_guard lock{mutex_};
+    auto it = peers_.find(peer_id);
+    if (it == peers_.end()) {
+      return;
+    }
+    by_score_.erase(it->second.position);
+    peers_.erase(it);
+    updateMetrics();
+  }
+
+  template <typename F>
+  void PeerScoringImpl::updateStats(const PeerId &peer_id,
+                                    const std::string &protocol,
+                                    F &&update) {
+    std::lock_guard lock{mutex_};
+    auto it = peers_.find(peer_id);
+    if (it == peers_.end()) {
+      SL_TRACE(log_, "Statistics of not scored peer {} is ignored", peer_id);
+      return;
+    }
+    auto &entry = it->second;
+    std::forward<F>(update)(entry.stats.protocols[protocol]);
+
+    auto score = calculateScore(entry.stats);
+    if (score != entry.stats.score) {
+      by_score_.erase(entry.position);
+      entry.stats.score = score;
+      entry.position = by_score_.emplace(score, peer_id).first;
+      updateMetrics();
+    }
+  }
+
+  void PeerScoringImpl::onResponse(const PeerId &peer_id,
+                                   const std::string &protocol,
+                                   std::chrono::milliseconds latency,
+                                   size_t bytes) {
+    metric_response_time_->observe(
+        std::chrono::duration<double>(latency).count());
+
+    updateStats(peer_id, protocol, [&](PeerProtocolStats &stats) {
+      auto throughput =
+          bytes / std::max(std::chrono::duration<double>(latency).count(),
+                           0.001);
+      if (stats.requests - stats.failures == 0) {
+        stats.latency = latency;
+        stats.throughput = throughput;
+      } else {
+        stats.latency = std::chrono::milliseconds(static_cast<int64_t>(
+            kSmoothingFactor * latency.count()
+            + (1 - kSmoothingFactor) * stats.latency.count()));
+        stats.throughput = kSmoothingFactor * throughput
+                         + (1 - kSmoothingFactor) * stats.throughput;
+      }
+      ++stats.requests;
+    });
+  }
+
+  void PeerScoringImpl::onRequestFailed(const PeerId &peer_id,
+                                        const std::string &protocol) {
+    updateStats(peer_id, protocol, [](PeerProtocolStats &stats) {
+      ++stats.requests;
+      ++stats.failures;
+    });
+  }
+
+  void PeerScoringImpl::onMessage(const PeerId &peer_id,
+                                  const std::string &protocol,
+                                  bool useful) {
+    updateStats(peer_id, protocol, [useful](PeerProtocolStats &stats) {
+      ++stats.messages;
+      if (useful) {
+        ++stats.useful_messages;
+      }
+    });
+  }
+
+  std::optional<double> PeerScoringImpl::score(const PeerId &peer_id) const {
+    std::lock_guard lock{mutex_};
+    auto it = peers_.find(peer_id);
+    if (it == peers_.end()) {
+      return std::nullopt;
+    }
+    return it->second.stats.score;
+  }
+
+  std::optional<double> PeerScoringImpl::throughput(
+      const PeerId &peer_id, const std::string &protocol) const {
+    std::lock_guard lock{mutex_};
+    auto it = peers_.find(peer_id);
+    if (it == peers_.end()) {
+      return std::nullopt;
+    }
+    auto &protocols = it->second.stats.protocols;
+    auto protocol_it = protocols.find(protocol);
+    if (protocol_it == protocols.end()
+        or protocol_it->second.requests == protocol_it->second.failures) {
+      return std::nullopt;
+    }
+    return protocol_it->second.throughput;
+  }
+
+  std::optional<PeerStats> PeerScoringImpl::stats(
+      const PeerId &peer_id) const {
+    std::lock_guard lock{mutex_};
+    auto it = peers_.find(peer_id);
+    if (it == peers_.end()) {
+      return std::nullopt;
+    }
+    return it->second.stats;
+  }
+
+  std::optional<PeerScoring::PeerId> PeerScoringImpl::worstPeer() const {
+    std::lock_guard lock{mutex_};
+    if (by_score_.empty()) {
+      return std::nullopt;
+    }
+    return by_score_.begin()->second;
+  }
+
+  double PeerScoringImpl::calculateScore(const PeerStats &stats) {
+    double score = 0.;
+    double weight = 0.;
+    for (auto &[_, protocol] : stats.protocols) {
+      if (protocol.requests > 0) {
+        // Smoothed by one virtual success and one virtual failure, so that
+        // the first requests don't turn the share to an extreme
+        auto success = (protocol.requests - protocol.failures + 1.)
+                     / (protocol.requests + 2.);
+        score += kSuccessWeight * success;
+        weight += kSuccessWeight;
+      }
+      if (protocol.requests > protocol.failures) {
+        auto latency = kReferenceLatency.count()
+                     / double(kReferenceLatency.count()
+                              + protocol.latency.count());
+        auto throughput =
+            protocol.throughput / (protocol.throughput + kReferenceThroughput);
+        score += kLatencyWeight * latency + kThroughputWeight * throughput;
+        weight += kLatencyWeight + kThroughputWeight;
+      }
+      if (protocol.messages > 0) {
+        auto usefulness = (protocol.useful_messages + 1.)
+                        / (protocol.messages + 2.);
+        score += kUsefulnessWeight * usefulness;
+        weight += kUsefulnessWeight;
+      }
+    }
+    return weight > 0 ? score / weight : kNeutralScore;
+  }
+
+  void PeerScoringImpl::updateMetrics() {
+    if (by_score_.empty()) {
+      metric_best_score_->set(0);
+      metric_worst_score_->set(0);
+      return;
+    }
+    metric_best_score_->set(by_score_.rbegin()->first);
+    metric_worst_score_->set(by_score_.begin()->first);
+  }
+
+}  // namespace kagome::network
@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_PEERSCORINGIMPL
+#define KAGOME_NETWORK_PEERSCORINGIMPL
+
+#include "network/peer_scoring.hpp"
+
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+
+namespace kagome::network {
+
+  class PeerScoringImpl : public PeerScoring {
+   public:
+    /// Weight of the last measurement in smoothed latency and throughput
+    static constexpr double kSmoothingFactor = 0.2;
+
+    /// Latency, which gives half of latency score
+    static constexpr std::chrono::milliseconds kReferenceLatency{500};
+
+    /// Throughput (B/s), which gives half of throughput score
+    static constexpr double kReferenceThroughput = 256. * 1024;
+
+    /// Score of peer without any statistics yet
+    static constexpr double kNeutralScore = 0.5;
+
+    /// Weights of components of score
+    static constexpr double kLatencyWeight = 3.;
+    static constexpr double kThroughputWeight = 3.;
+    static constexpr double kSuccessWeight = 2.;
+    static constexpr double kUsefulnessWeight = 2.;
+
+    PeerScoringImpl();
+
+    void addPeer(const PeerId &peer_id) override;
+
+    void removePeer(const PeerId &peer_id) override;
+
+    void onResponse(const PeerId &peer_id,
+                    const std::string &protocol,
+                    std::chrono::milliseconds latency,
+                    size_t bytes) override;
+
+    void onRequestFailed(const PeerId &peer_id,
+                         const std::string &protocol) override;
+
+    void onMessage(const PeerId &peer_id,
+                   const std::string &protocol,
+                   bool useful) override;
+
+    std::optional<double> score(const PeerId &peer_id) const override;
+
+    std::optional<double> throughput(
+        const PeerId &peer_id, const std::string &protocol) const override;
+
+    std::optional<PeerStats> stats(const PeerId &peer_id) const override;
+
+    std::optional<PeerId> worstPeer() const override;
+
+    /// @return score calculated by statistics of peer
+    static double calculateScore(const PeerStats &stats);
+
+   private:
+    using ScoreIndex = std::set<std::pair<double, PeerId>>;
+
+    struct Entry {
+      PeerStats stats;
+      ScoreIndex::iterator position;
+    };
+
+    using Entries = std::unordered_map<PeerId, Entry>;
+
+    /// Applies {@param update} to stats of the protocol of a scored peer and
+    /// moves the peer to its new place in the score index; called under lock
+    template <typename F>
+    void updateStats(const PeerId &peer_id,
+                     const std::string &protocol,
+                     F &&update);
+
+    void updateMetrics();
+
+    /// Guards peers and index, since statistics are read by RPC threads
+    mutable std::mutex mutex_;
+    Entries peers_;
+    ScoreIndex by_score_;
+
+    // metrics
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Histogram *metric_response_time_;
+    metrics::Gauge *metric_best_score_;
+    metrics::Gauge *metric_worst_score_;
+
+    log::Logger log_;
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_PEERSCORINGIMPL
@@ -15,11 +15,59 @@
 #include "network/types/grandpa_message.hpp"
 #include "network/types/roles.hpp"
 
+namespace {
+  constexpr const char *kDuplicateVotes = "kagome_grandpa_duplicate_votes";
+  constexpr const char *kDroppedVotes = "kagome_grandpa_dropped_votes";
+}  // namespace
+
 namespace kagome::network {
   using libp2p::connection::LoopbackStream;
 
   KAGOME_DEFINE_CACHE(GrandpaProtocol);
 
+  namespace detail {
+    SeenVotes::SeenVotes(std::size_t rounds_capacity,
+                         std::size_t votes_per_round_capacity)
+        : rounds_capacity_{rounds_capacity},
+          votes_per_round_capacity_{votes_per_round_capacity} {}
+
+    SeenVotes::VoteKey SeenVotes::voteKey(const GrandpaVote &vote) {
+      return {vote.vote.id,
+              vote.vote.signature,
+              vote.vote.message.which(),
+              vote.vote.getBlockInfo()};
+    }
+
+    bool SeenVotes::isSeen(const GrandpaVote &vote) const {
+      auto it = seen_.find(RoundKey{vote.counter, vote.round_number});
+      if (it == seen_.end()) {
+        return false;
+      }
+      return it->second.count(voteKey(vote)) != 0;
+    }
+
+    void SeenVotes::remember(const GrandpaVote &vote) {
+      RoundKey key{vote.counter, vote.round_number};
+
+      auto it = seen_.find(key);
+      if (it == seen_.end()) {
+        if (seen_.size() >= rounds_capacity_) {
+          // the vote is older than any tracked round
+          if (key < seen_.begin()->first) {
+            return;
+          }
+          seen_.erase(seen_.begin());
+        }
+        it = seen_.emplace(key, decltype(seen_)::mapped_type{}).first;
+      }
+
+      auto &votes = it->second;
+      if (votes.size() < votes_per_round_capacity_) {
+        votes.emplace(voteKey(vote));
+      }
+    }
+  }  // namespace detail
+
   GrandpaProtocol::GrandpaProtocol(
       libp2p::Host &host,
       std::shared_ptr<boost::asio::io_context> io_context,
@@ -28,6 +76,7 @@ namespace kagome::network {
       const OwnPeerInfo &own_info,
       std::shared_ptr<StreamEngine> stream_engine,
       std::shared_ptr<PeerManager> peer_manager,
+      std::shared_ptr<PeerScoring> peer_scoring,
       const primitives::BlockHash &genesis_hash,
       std::shared_ptr<libp2p::basic::Scheduler> scheduler)
       : base_(host,
@@ -40,7 +89,21 @@ namespace kagome::network {
         own_info_(own_info),
         stream_engine_(std::move(stream_engine)),
         peer_manager_(std::move(peer_manager)),
-        scheduler_(std::move(scheduler)) {}
+        peer_scoring_(std::move(peer_scoring)),
+        scheduler_(std::move(scheduler)),
+        seen_votes_(kSeenVotesRoundsCapacity, kSeenVotesPerRoundCapacity) {
+    // Register metrics
+    metrics_registry_->registerCounterFamily(
+        kDuplicateVotes,
+        "Number of received grandpa votes dropped as already seen");
+    metric_duplicate_votes_ =
+        metrics_registry_->registerCounterMetric(kDuplicateVotes);
+    metrics_registry_->registerCounterFamily(
+        kDroppedVotes,
+        "Number of received grandpa votes dropped as stale or from future");
+    metric_dropped_votes_ =
+        metrics_registry_->registerCounterMetric(kDroppedVotes);
+  }
 
   bool GrandpaProtocol::start() {
     auto stream = std::make_shared<LoopbackStream>(own_info_, io_context_);
@@ -312,7 +375,30 @@ namespace kagome::network {
             SL_VERBOSE(self->base_.logger(),
                        "VoteMessage has received from {}",
                        peer_id);
-            self->grandpa_observer_->onVoteMessage(peer_id, vote_message);
+            if (not self->isRelevantVote(peer_id, vote_message)) {
+              self->metric_dropped_votes_->inc();
+              return;
+            }
+            if (self->seen_votes_.isSeen(vote_message)) {
+              SL_TRACE(self->base_.logger(),
+                       "Vote signed by {} with set_id={} in round={} "
+                       "has received from {} and dropped as already seen",
+                       vote_message.id(),
+                       vote_message.counter,
+                       vote_message.round_number,
+                       peer_id);
+              self->metric_duplicate_votes_->inc();
+              self->peer_scoring_->onMessage(
+                  peer_id, self->protocolName(), false);
+              return;
+            }
+            self->peer_scoring_->onMessage(peer_id, self->protocolName(), true);
+            // Votes dropped by grandpa or waiting for missing blocks must
+            // not shadow copies received later
+            if (self->grandpa_observer_->onVoteMessage(peer_id,
+                                                       vote_message)) {
+              self->seen_votes_.remember(vote_message);
+            }
           },
           [&](const FullCommitMessage &commit_message) {
             SL_VERBOSE(self->base_.logger(),
@@ -345,6 +431,66 @@ namespace kagome::network {
     });
   }
 
+  bool GrandpaProtocol::isRelevantVote(const PeerId &peer_id,
+                                       const GrandpaVote &msg) const {
+    auto own_info_opt = peer_manager_->getPeerState(own_info_.id);
+    if (not own_info_opt.has_value()) {
+      return true;
+    }
+    const auto &own_info = own_info_opt.value().get();
+
+    // Own state is not known yet, so vote will be checked by observer
+    if (not own_info.set_id.has_value()
+        or not own_info.round_number.has_value()) {
+      return true;
+    }
+
+    // Votes from an earlier voter set are useless
+    if (msg.counter < own_info.set_id.value()) {
+      SL_DEBUG(base_.logger(),
+               "Vote signed by {} with set_id={} in round={} "
+               "has received from {} and dropped as stale: our set id is {}",
+               msg.id(),
+               msg.counter,
+               msg.round_number,
+               peer_id,
+               own_info.set_id.value());
+      return false;
+    }
+
+    if (msg.counter == own_info.set_id.value()) {
+      // Votes about round r-2 or earlier are useless on round r
+      if (msg.round_number + 2 < own_info.round_number.value()) {
+        SL_DEBUG(base_.logger(),
+                 "Vote signed by {} with set_id={} in round={} "
+                 "has received from {} and dropped as stale: our round is {}",
+                 msg.id(),
+                 msg.counter,
+                 msg.round_number,
+                 peer_id,
+                 own_info.round_number.value());
+        return false;
+      }
+
+      // Own state might lag by one round behind grandpa, so only votes about
+      // round r+2 or later are considered as from future
+      if (msg.round_number > own_info.round_number.value() + 1) {
+        SL_DEBUG(base_.logger(),
+                 "Vote signed by {} with set_id={} in round={} "
+                 "has received from {} and dropped as from future: "
+                 "our round is {}",
+                 msg.id(),
+                 msg.counter,
+                 msg.round_number,
+                 peer_id,
+                 own_info.round_number.value());
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   void GrandpaProtocol::vote(
       network::GrandpaVote &&vote_message,
       std::optional<const libp2p::peer::PeerId> peer_id) {
@@ -8,7 +8,9 @@
 
 #include "network/protocol_base.hpp"
 
+#include <map>
 #include <memory>
+#include <set>
 
 #include <libp2p/basic/scheduler.hpp>
 #include <libp2p/connection/stream.hpp>
@@ -18,9 +20,11 @@
 #include "consensus/grandpa/grandpa_observer.hpp"
 #include "containers/objects_cache.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "network/impl/protocols/protocol_base_impl.hpp"
 #include "network/impl/stream_engine.hpp"
 #include "network/peer_manager.hpp"
+#include "network/types/grandpa_message.hpp"
 #include "network/types/own_peer_info.hpp"
 #include "utils/non_copyable.hpp"
 
@@ -32,6 +36,64 @@ namespace kagome::network {
 
   KAGOME_DECLARE_CACHE(GrandpaProtocol, KAGOME_CACHE_UNIT(GrandpaMessage));
 
+  static constexpr auto kSeenVotesRoundsCapacity = 4;
+  static constexpr auto kSeenVotesPerRoundCapacity = 8192;
+
+  namespace detail {
+
+    /**
+     * Container to store the most recent vote messages processed by grandpa.
+     * The same vote is gossiped by many peers, so repeating copies must be
+     * dropped before they go to signature verification.
+     *
+     * Votes are identified by whole content (voter, signature and signed
+     * vote) within a round of a voter set, so a forged copy of a vote can't
+     * shadow the genuine one.
+     */
+    class SeenVotes {
+     public:
+      /**
+       * Initialize the container
+       * @param rounds_capacity - max amount of rounds tracked at once
+       * @param votes_per_round_capacity - max amount of votes tracked per
+       * round
+       */
+      SeenVotes(std::size_t rounds_capacity,
+                std::size_t votes_per_round_capacity);
+
+      /**
+       * @param vote - received vote message
+       * @return true if the same vote has been remembered before
+       */
+      bool isSeen(const GrandpaVote &vote) const;
+
+      /**
+       * Remembers the vote.
+       *
+       * When amount of tracked rounds exceeds capacity, the oldest round is
+       * forgotten. Votes of a round older than all tracked ones, as well as
+       * votes over per round capacity, are never remembered.
+       *
+       * @param vote - vote message processed by grandpa
+       */
+      void remember(const GrandpaVote &vote);
+
+     private:
+      using RoundKey = std::tuple<VoterSetId, RoundNumber>;
+      using VoteKey = std::tuple<consensus::grandpa::Id,
+                                 consensus::grandpa::Signature,
+                                 int,
+                                 primitives::BlockInfo>;
+
+      static VoteKey voteKey(const GrandpaVote &vote);
+
+      const std::size_t rounds_capacity_;
+      const std::size_t votes_per_round_capacity_;
+      std::map<RoundKey, std::set<VoteKey>> seen_;
+    };
+
+  }  // namespace detail
+
   class GrandpaProtocol final
       : public ProtocolBase,
         public std::enable_shared_from_this<GrandpaProtocol>,
@@ -49,6 +111,7 @@ namespace kagome::network {
         const OwnPeerInfo &own_info,
         std::shared_ptr<StreamEngine> stream_engine,
         std::shared_ptr<PeerManager> peer_manager,
+        std::shared_ptr<PeerScoring> peer_scoring,
         const primitives::BlockHash &genesis_hash,
         std::shared_ptr<libp2p::basic::Scheduler> scheduler);
 
@@ -63,6 +126,10 @@ namespace kagome::network {
       return kGrandpaProtocolName;
     }
 
+    OutboundPriority outboundPriority() const override {
+      return OutboundPriority::CONSENSUS;
+    }
+
     void onIncomingStream(std::shared_ptr<Stream> stream) override;
     void newOutgoingStream(
         const PeerInfo &peer_info,
@@ -92,6 +159,13 @@ namespace kagome::network {
 
     void read(std::shared_ptr<Stream> stream);
 
+    /**
+     * Cheap check of received vote against own grandpa state (set id and
+     * round number). Must be done before any heavy processing of the vote.
+     * @return false if vote is obviously stale or came from future
+     */
+    bool isRelevantVote(const PeerId &peer_id, const GrandpaVote &msg) const;
+
     void write(
         std::shared_ptr<Stream> stream,
         const int &msg,
@@ -110,6 +184,7 @@ namespace kagome::network {
     const OwnPeerInfo &own_info_;
     std::shared_ptr<StreamEngine> stream_engine_;
     std::shared_ptr<PeerManager> peer_manager_;
+    std::shared_ptr<PeerScoring> peer_scoring_;
     std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
 
     std::set<std::tuple<consensus::grandpa::RoundNumber,
@@ -117,6 +192,13 @@ namespace kagome::network {
         recent_catchup_requests_by_round_;
 
     std::set<libp2p::peer::PeerId> recent_catchup_requests_by_peer_;
+
+    detail::SeenVotes seen_votes_;
+
+    // Metrics
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Counter *metric_duplicate_votes_;
+    metrics::Counter *metric_dropped_votes_;
   };
 
 }  // namespace kagome::network
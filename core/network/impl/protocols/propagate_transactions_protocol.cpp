@@ -25,22 +25,28 @@ namespace kagome::network {
       const application::ChainSpec &chain_spec,
       std::shared_ptr<consensus::babe::Babe> babe,
       std::shared_ptr<ExtrinsicObserver> extrinsic_observer,
+      std::shared_ptr<crypto::Hasher> hasher,
       std::shared_ptr<StreamEngine> stream_engine,
       std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
           extrinsic_events_engine,
       std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
-          ext_event_key_repo)
+          ext_event_key_repo,
+      std::shared_ptr<boost::asio::io_context> main_context,
+      const TransactionsValidationQueue::Config &validation_config)
       : base_(host,
               {fmt::format(kPropagateTransactionsProtocol.data(),
                            chain_spec.protocolId())},
               "PropagateTransactionsProtocol"),
         app_config_(app_config),
         babe_(std::move(babe)),
-        extrinsic_observer_(std::move(extrinsic_observer)),
+        validation_queue_(std::make_shared<TransactionsValidationQueue>(
+            std::move(extrinsic_observer),
+            std::move(hasher),
+            std::move(main_context),
+            validation_config)),
         stream_engine_(std::move(stream_engine)),
         extrinsic_events_engine_{std::move(extrinsic_events_engine)},
         ext_event_key_repo_{std::move(ext_event_key_repo)} {
-    BOOST_ASSERT(extrinsic_observer_ != nullptr);
     BOOST_ASSERT(stream_engine_ != nullptr);
     BOOST_ASSERT(extrinsic_events_engine_ != nullptr);
     BOOST_ASSERT(ext_event_key_repo_ != nullptr);
@@ -54,10 +60,12 @@ namespace kagome::network {
   }
 
   bool PropagateTransactionsProtocol::start() {
+    validation_queue_->start();
     return base_.start(weak_from_this());
   }
 
   bool PropagateTransactionsProtocol::stop() {
+    validation_queue_->stop();
     return base_.stop();
   }
 
@@ -295,15 +303,9 @@ namespace kagome::network {
                  peer_id);
 
       if (self->babe_->wasSynchronized()) {
+        // Validation is done by workers of the queue, not on network thread
         for (auto &ext : message.extrinsics) {
-          auto result = self->extrinsic_observer_->onTxMessage(ext);
-          if (result) {
-            SL_DEBUG(self->base_.logger(), "  Received tx {}", result.value());
-          } else {
-            SL_DEBUG(self->base_.logger(),
-                     "  Rejected tx: {}",
-                     result.error().message());
-          }
+          self->validation_queue_->push(peer_id, std::move(ext));
         }
       } else {
         SL_TRACE(self->base_.logger(),
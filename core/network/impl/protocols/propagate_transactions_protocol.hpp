@@ -22,6 +22,7 @@
 #include "network/extrinsic_observer.hpp"
 #include "network/impl/protocols/protocol_base_impl.hpp"
 #include "network/impl/stream_engine.hpp"
+#include "network/impl/transactions_validation_queue.hpp"
 #include "network/types/propagate_transactions.hpp"
 #include "primitives/event_types.hpp"
 #include "subscription/extrinsic_event_key_repository.hpp"
@@ -49,11 +50,14 @@ namespace kagome::network {
         const application::ChainSpec &chain_spec,
         std::shared_ptr<consensus::babe::Babe> babe,
         std::shared_ptr<ExtrinsicObserver> extrinsic_observer,
+        std::shared_ptr<crypto::Hasher> hasher,
         std::shared_ptr<StreamEngine> stream_engine,
         std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
             extrinsic_events_engine,
         std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
-            ext_event_key_repo);
+            ext_event_key_repo,
+        std::shared_ptr<boost::asio::io_context> main_context,
+        const TransactionsValidationQueue::Config &validation_config);
 
     bool start() override;
     bool stop() override;
@@ -62,6 +66,10 @@ namespace kagome::network {
       return kPropogateTransacionsProtocolName;
     }
 
+    OutboundPriority outboundPriority() const override {
+      return OutboundPriority::TRANSACTIONS;
+    }
+
     void onIncomingStream(std::shared_ptr<Stream> stream) override;
     void newOutgoingStream(
         const PeerInfo &peer_info,
@@ -87,7 +95,7 @@ namespace kagome::network {
     ProtocolBaseImpl base_;
     const application::AppConfiguration &app_config_;
     std::shared_ptr<consensus::babe::Babe> babe_;
-    std::shared_ptr<ExtrinsicObserver> extrinsic_observer_;
+    std::shared_ptr<TransactionsValidationQueue> validation_queue_;
     std::shared_ptr<StreamEngine> stream_engine_;
     std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
         extrinsic_events_engine_;
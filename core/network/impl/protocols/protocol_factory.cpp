@@ -21,7 +21,9 @@ namespace kagome::network {
       std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
           ext_event_key_repo,
       std::shared_ptr<PeerRatingRepository> peer_rating_repository,
-      std::shared_ptr<libp2p::basic::Scheduler> scheduler)
+      std::shared_ptr<PeerScoring> peer_scoring,
+      std::shared_ptr<libp2p::basic::Scheduler> scheduler,
+      const TransactionsValidationQueue::Config &txs_validation_config)
       : host_(host),
         app_config_(app_config),
         chain_spec_(chain_spec),
@@ -32,13 +34,16 @@ namespace kagome::network {
         extrinsic_events_engine_{std::move(extrinsic_events_engine)},
         ext_event_key_repo_{std::move(ext_event_key_repo)},
         peer_rating_repository_{std::move(peer_rating_repository)},
-        scheduler_{std::move(scheduler)} {
+        peer_scoring_{std::move(peer_scoring)},
+        scheduler_{std::move(scheduler)},
+        txs_validation_config_{txs_validation_config} {
     BOOST_ASSERT(io_context_ != nullptr);
     BOOST_ASSERT(hasher_ != nullptr);
     BOOST_ASSERT(stream_engine_ != nullptr);
     BOOST_ASSERT(extrinsic_events_engine_ != nullptr);
     BOOST_ASSERT(ext_event_key_repo_ != nullptr);
     BOOST_ASSERT(peer_rating_repository_ != nullptr);
+    BOOST_ASSERT(peer_scoring_ != nullptr);
     BOOST_ASSERT(scheduler_ != nullptr);
   }
 
@@ -66,6 +71,7 @@ namespace kagome::network {
                                              own_info_,
                                              stream_engine_,
                                              peer_manager_.lock(),
+                                             peer_scoring_,
                                              genesisBlockHash,
                                              scheduler_);
   }
@@ -90,9 +96,12 @@ namespace kagome::network {
         chain_spec_,
         babe_.lock(),
         extrinsic_observer_.lock(),
+        hasher_,
         stream_engine_,
         extrinsic_events_engine_,
-        ext_event_key_repo_);
+        ext_event_key_repo_,
+        io_context_,
+        txs_validation_config_);
   }
 
   std::shared_ptr<StateProtocol> ProtocolFactory::makeStateProtocol() const {
@@ -105,4 +114,9 @@ namespace kagome::network {
         host_, chain_spec_, sync_observer_.lock(), peer_rating_repository_);
   }
 
+  std::shared_ptr<WarpProtocol> ProtocolFactory::makeWarpProtocol() const {
+    return std::make_shared<WarpProtocolImpl>(
+        host_, chain_spec_, warp_observer_.lock());
+  }
+
 }  // namespace kagome::network
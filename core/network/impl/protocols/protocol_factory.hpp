@@ -17,7 +17,9 @@
 #include "network/impl/protocols/protocol_req_collation.hpp"
 #include "network/impl/protocols/request_response_protocol.hpp"
 #include "network/impl/protocols/sync_protocol_impl.hpp"
+#include "network/impl/protocols/warp_protocol_impl.hpp"
 #include "network/impl/stream_engine.hpp"
+#include "network/peer_scoring.hpp"
 #include "network/rating_repository.hpp"
 #include "primitives/event_types.hpp"
 
@@ -40,7 +42,9 @@ namespace kagome::network {
         std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
             ext_event_key_repo,
         std::shared_ptr<PeerRatingRepository> peer_rating_repository,
-        std::shared_ptr<libp2p::basic::Scheduler> scheduler);
+        std::shared_ptr<PeerScoring> peer_scoring,
+        std::shared_ptr<libp2p::basic::Scheduler> scheduler,
+        const TransactionsValidationQueue::Config &txs_validation_config);
 
     void setBlockTree(
         const std::shared_ptr<blockchain::BlockTree> &block_tree) {
@@ -82,6 +86,11 @@ namespace kagome::network {
       sync_observer_ = sync_observer;
     }
 
+    void setWarpObserver(
+        const std::shared_ptr<WarpProtocolObserver> &warp_observer) {
+      warp_observer_ = warp_observer;
+    }
+
     void setPeerManager(const std::shared_ptr<PeerManager> &peer_manager) {
       peer_manager_ = peer_manager;
     }
@@ -95,6 +104,7 @@ namespace kagome::network {
 
     std::shared_ptr<StateProtocol> makeStateProtocol() const;
     std::shared_ptr<SyncProtocol> makeSyncProtocol() const;
+    std::shared_ptr<WarpProtocol> makeWarpProtocol() const;
 
     std::shared_ptr<CollationProtocol> makeCollationProtocol() const;
     std::shared_ptr<ReqCollationProtocol> makeReqCollationProtocol() const;
@@ -112,7 +122,9 @@ namespace kagome::network {
     std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
         ext_event_key_repo_;
     std::shared_ptr<PeerRatingRepository> peer_rating_repository_;
+    std::shared_ptr<PeerScoring> peer_scoring_;
     std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
+    const TransactionsValidationQueue::Config txs_validation_config_;
 
     std::weak_ptr<blockchain::BlockTree> block_tree_;
     std::weak_ptr<consensus::babe::Babe> babe_;
@@ -120,6 +132,7 @@ namespace kagome::network {
     std::weak_ptr<ExtrinsicObserver> extrinsic_observer_;
     std::weak_ptr<StateProtocolObserver> state_observer_;
     std::weak_ptr<SyncProtocolObserver> sync_observer_;
+    std::weak_ptr<WarpProtocolObserver> warp_observer_;
     std::weak_ptr<PeerManager> peer_manager_;
     std::weak_ptr<CollationObserver> collation_observer_;
     std::weak_ptr<ReqCollationObserver> req_collation_observer_;
@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/protocols/warp_protocol_impl.hpp"
+
+#include "network/common.hpp"
+#include "network/helpers/scale_message_read_writer.hpp"
+#include "network/impl/protocols/request_response_protocol.hpp"
+
+namespace kagome::network {
+
+  struct WarpRequestResponseProtocol
+      : RequestResponseProtocol<WarpRequest,
+                                WarpSyncProof,
+                                ScaleMessageReadWriter>,
+        NonCopyable,
+        NonMovable {
+    WarpRequestResponseProtocol(libp2p::Host &host,
+                                const application::ChainSpec &chain_spec,
+                                std::shared_ptr<WarpProtocolObserver> observer)
+        : RequestResponseProtocol<
+            WarpRequest,
+            WarpSyncProof,
+            ScaleMessageReadWriter>{host,
+                                    fmt::format(kWarpProtocol.data(),
+                                                chain_spec.protocolId()),
+                                    "WarpProtocol"},
+          observer_{std::move(observer)} {}
+
+   protected:
+    outcome::result<WarpSyncProof> onRxRequest(
+        WarpRequest request, std::shared_ptr<Stream> /*stream*/) override {
+      BOOST_ASSERT(observer_);
+      return observer_->onWarpRequest(request);
+    }
+
+    void onTxRequest(const WarpRequest &request) override {
+      SL_DEBUG(base().logger(), "Requesting warp proof from {}", request.begin);
+    }
+
+   private:
+    std::shared_ptr<WarpProtocolObserver> observer_;
+  };
+
+  WarpProtocolImpl::WarpProtocolImpl(
+      libp2p::Host &host,
+      const application::ChainSpec &chain_spec,
+      std::shared_ptr<WarpProtocolObserver> observer)
+      : impl_{std::make_shared<WarpRequestResponseProtocol>(
+          host, chain_spec, std::move(observer))} {}
+
+  const Protocol &WarpProtocolImpl::protocolName() const {
+    BOOST_ASSERT(impl_ && !!"WarpRequestResponseProtocol must be initialized!");
+    return impl_->protocolName();
+  }
+
+  bool WarpProtocolImpl::start() {
+    BOOST_ASSERT(impl_ && !!"WarpRequestResponseProtocol must be initialized!");
+    return impl_->start();
+  }
+
+  bool WarpProtocolImpl::stop() {
+    BOOST_ASSERT(impl_ && !!"WarpRequestResponseProtocol must be initialized!");
+    return impl_->stop();
+  }
+
+  void WarpProtocolImpl::onIncomingStream(std::shared_ptr<Stream> stream) {
+    BOOST_ASSERT(!"Must not be called!");
+  }
+
+  void WarpProtocolImpl::newOutgoingStream(
+      const PeerInfo &peer_info,
+      std::function<void(outcome::result<std::shared_ptr<Stream>>)> &&cb) {
+    BOOST_ASSERT(!"Must not be called!");
+  }
+
+  void WarpProtocolImpl::request(
+      const PeerId &peer_id,
+      WarpRequest request,
+      std::function<void(outcome::result<WarpSyncProof>)>
+          &&response_handler) {
+    BOOST_ASSERT(impl_ && !!"WarpRequestResponseProtocol must be initialized!");
+    return impl_->doRequest(
+        peer_id, std::move(request), std::move(response_handler));
+  }
+
+}  // namespace kagome::network
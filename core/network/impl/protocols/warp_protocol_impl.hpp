@@ -0,0 +1,57 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_WARPPROTOCOLIMPL
+#define KAGOME_NETWORK_WARPPROTOCOLIMPL
+
+#include "network/protocols/warp_protocol.hpp"
+
+#include <memory>
+
+#include <libp2p/connection/stream.hpp>
+#include <libp2p/host/host.hpp>
+
+#include "application/chain_spec.hpp"
+#include "network/warp_protocol_observer.hpp"
+#include "utils/non_copyable.hpp"
+
+namespace kagome::network {
+
+  struct WarpRequestResponseProtocol;
+
+  class WarpProtocolImpl final : public WarpProtocol,
+                                 NonCopyable,
+                                 NonMovable {
+   public:
+    WarpProtocolImpl() = delete;
+    ~WarpProtocolImpl() override = default;
+
+    WarpProtocolImpl(libp2p::Host &host,
+                     const application::ChainSpec &chain_spec,
+                     std::shared_ptr<WarpProtocolObserver> observer);
+
+    const Protocol &protocolName() const override;
+
+    bool start() override;
+    bool stop() override;
+
+    void onIncomingStream(std::shared_ptr<Stream> stream) override;
+    void newOutgoingStream(
+        const PeerInfo &peer_info,
+        std::function<void(outcome::result<std::shared_ptr<Stream>>)> &&cb)
+        override;
+
+    void request(const PeerId &peer_id,
+                 WarpRequest request,
+                 std::function<void(outcome::result<WarpSyncProof>)>
+                     &&response_handler) override;
+
+   private:
+    std::shared_ptr<WarpRequestResponseProtocol> impl_;
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_WARPPROTOCOLIMPL
@@ -94,11 +94,17 @@ namespace kagome::network {
       return false;
     }
 
+    warp_protocol_ = protocol_factory_->makeWarpProtocol();
+    if (not warp_protocol_) {
+      return false;
+    }
+
     block_announce_protocol_->start();
     grandpa_protocol_->start();
     propagate_transaction_protocol_->start();
     state_protocol_->start();
     sync_protocol_->start();
+    warp_protocol_->start();
     collation_protocol_->start();
     req_collation_protocol_->start();
 
@@ -184,6 +190,10 @@ namespace kagome::network {
     return sync_protocol_;
   }
 
+  std::shared_ptr<WarpProtocol> RouterLibp2p::getWarpProtocol() const {
+    return warp_protocol_;
+  }
+
   std::shared_ptr<GrandpaProtocol> RouterLibp2p::getGrandpaProtocol() const {
     return grandpa_protocol_;
   }
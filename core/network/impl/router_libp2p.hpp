@@ -57,6 +57,7 @@ namespace kagome::network {
     getPropagateTransactionsProtocol() const override;
     std::shared_ptr<StateProtocol> getStateProtocol() const override;
     std::shared_ptr<SyncProtocol> getSyncProtocol() const override;
+    std::shared_ptr<WarpProtocol> getWarpProtocol() const override;
     std::shared_ptr<GrandpaProtocol> getGrandpaProtocol() const override;
     std::shared_ptr<CollationProtocol> getCollationProtocol() const override;
     std::shared_ptr<ReqCollationProtocol> getReqCollationProtocol()
@@ -89,6 +90,7 @@ namespace kagome::network {
         propagate_transaction_protocol_;
     std::shared_ptr<StateProtocol> state_protocol_;
     std::shared_ptr<SyncProtocol> sync_protocol_;
+    std::shared_ptr<WarpProtocol> warp_protocol_;
     std::shared_ptr<CollationProtocol> collation_protocol_;
     std::shared_ptr<ReqCollationProtocol> req_collation_protocol_;
   };
@@ -16,6 +16,10 @@
 
 constexpr unsigned MAX_RESPONSE_BYTES = 2 * 1024 * 1024;
 
+/// Estimation of bytes taken by protobuf encoding of a state entry besides its
+/// key and value, so encoded response doesn't exceed the limit
+constexpr size_t kEntryEncodingOverhead = 8;
+
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::network,
                             StateProtocolObserverImpl::Error,
                             e) {
@@ -41,37 +45,48 @@ namespace kagome::network {
     BOOST_ASSERT(storage_);
   }
 
+  outcome::result<std::shared_ptr<storage::trie::EphemeralTrieBatch>>
+  StateProtocolObserverImpl::getChildBatch(const storage::trie::RootHash &hash,
+                                           ChildBatches &child_batches) const {
+    if (auto it = child_batches.find(hash); it != child_batches.end()) {
+      return it->second;
+    }
+    OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(hash));
+    std::shared_ptr<storage::trie::EphemeralTrieBatch> shared_batch =
+        std::move(batch);
+    child_batches.emplace(hash, shared_batch);
+    return shared_batch;
+  }
+
   outcome::result<std::pair<KeyValueStateEntry, size_t>>
   StateProtocolObserverImpl::getEntry(const storage::trie::RootHash &hash,
                                       const common::Buffer &key,
-                                      size_t limit) const {
-    OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(hash));
+                                      size_t limit,
+                                      ChildBatches &child_batches) const {
+    OUTCOME_TRY(batch, getChildBatch(hash, child_batches));
 
     auto cursor = batch->trieCursor();
 
     KeyValueStateEntry entry;
     entry.state_root = hash;
 
-    auto res = key.empty() ? cursor->next() : cursor->seekUpperBound(key);
+    if (key.empty()) {
+      OUTCOME_TRY(cursor->next());
+    } else {
+      OUTCOME_TRY(cursor->seekUpperBound(key));
+    }
+
     size_t size = 0;
-    if (res.has_value()) {
-      while (cursor->key().has_value() && size < limit) {
-        if (auto value_res = batch->tryGet(cursor->key().value());
-            value_res.has_value()) {
-          const auto &value_opt = value_res.value();
-          if (value_opt.has_value()) {
-            entry.entries.emplace_back(
-                StateEntry{cursor->key().value(), value_opt.value()});
-            size += entry.entries.back().key.size()
-                    + entry.entries.back().value.size();
-          }
-        }
-        res = cursor->next();
+    while (cursor->isValid() and size < limit) {
+      if (auto value = cursor->value(); value.has_value()) {
+        auto &state_entry = entry.entries.emplace_back(
+            StateEntry{cursor->key().value(), value.value().get()});
+        size += kEntryEncodingOverhead + state_entry.key.size()
+              + state_entry.value.size();
       }
-      entry.complete = not cursor->key().has_value();
-    } else {
-      return res.as_failure();
+      OUTCOME_TRY(cursor->next());
     }
+    entry.complete = not cursor->isValid();
 
     return {entry, size};
   }
@@ -81,12 +96,15 @@ namespace kagome::network {
     OUTCOME_TRY(header, blocks_headers_->getBlockHeader(request.hash));
     OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(header.state_root));
 
+    // Child tries might share the same root; their batches are reused
+    ChildBatches child_batches;
+
     auto cursor = batch->trieCursor();
     // if key is not empty continue iteration from place where left
     auto res = (request.start.empty() || request.start[0].empty()
                     ? cursor->next()
                     : cursor->seekUpperBound(request.start[0]));
-    unsigned size = 0;
+    size_t size = 0;
     KeyValueStateEntry entry;
     // main state storage hash is marked with zeros in response
     entry.state_root =
@@ -109,9 +127,11 @@ namespace kagome::network {
         OUTCOME_TRY(
             hash,
             storage::trie::RootHash::fromSpan(value_res.value().value().get()));
-        OUTCOME_TRY(
-            entry_res,
-            this->getEntry(hash, request.start[1], MAX_RESPONSE_BYTES - size));
+        OUTCOME_TRY(entry_res,
+                    getEntry(hash,
+                             request.start[1],
+                             MAX_RESPONSE_BYTES - size,
+                             child_batches));
         response.entries.emplace_back(std::move(entry_res.first));
         size += entry_res.second;
       } else {
@@ -124,37 +144,39 @@ namespace kagome::network {
     }
 
     const auto &child_prefix = storage::kChildStorageDefaultPrefix;
-    while (cursor->key().has_value() && size < MAX_RESPONSE_BYTES) {
-      if (auto value_res = batch->tryGet(cursor->key().value());
-          value_res.has_value()) {
-        const auto &value = value_res.value();
-        auto &entry = response.entries.front();
-        entry.entries.emplace_back(
-            StateEntry{cursor->key().value(), value.value()});
-        size +=
-            entry.entries.back().key.size() + entry.entries.back().value.size();
+    while (cursor->isValid() && size < MAX_RESPONSE_BYTES) {
+      // Key and value are taken from the cursor's current node, so the trie
+      // is not traversed again for each key
+      auto value = cursor->value();
+      if (value.has_value()) {
+        auto &state_entry = response.entries.front().entries.emplace_back(
+            StateEntry{cursor->key().value(), value.value().get()});
+        size += kEntryEncodingOverhead + state_entry.key.size()
+              + state_entry.value.size();
         // if key is child state storage hash iterate child storage keys
-        if (cursor->key().value().size() > child_prefix.size()
-            && cursor->key().value().subbuffer(0, child_prefix.size())
+        if (state_entry.key.size() > child_prefix.size()
+            && state_entry.key.subbuffer(0, child_prefix.size())
                    == child_prefix) {
           OUTCOME_TRY(hash,
-                      storage::trie::RootHash::fromSpan(
-                          value_res.value().value().get()));
-          OUTCOME_TRY(entry_res,
-                      this->getEntry(
-                          hash, common::Buffer(), MAX_RESPONSE_BYTES - size));
+                      storage::trie::RootHash::fromSpan(state_entry.value));
+          // size might already exceed the limit after the entry is added
+          auto limit =
+              size < MAX_RESPONSE_BYTES ? MAX_RESPONSE_BYTES - size : 0;
+          OUTCOME_TRY(
+              entry_res,
+              getEntry(hash, common::Buffer(), limit, child_batches));
           response.entries.emplace_back(std::move(entry_res.first));
           size += entry_res.second;
           // not complete means response bytes limit exceeded
           // finish response formation
-          if (not entry_res.first.complete) {
+          if (not response.entries.back().complete) {
             break;
           }
         }
       }
-      res = cursor->next();
+      OUTCOME_TRY(cursor->next());
     }
-    response.entries.front().complete = not cursor->key().has_value();
+    response.entries.front().complete = not cursor->isValid();
 
     return response;
   }
@@ -9,6 +9,8 @@
 #include "blockchain/block_header_repository.hpp"
 #include "network/state_protocol_observer.hpp"
 
+#include <unordered_map>
+
 #include "log/logger.hpp"
 #include "network/types/state_response.hpp"
 #include "storage/trie/types.hpp"
@@ -18,6 +20,7 @@ namespace kagome {
     class BlockHeaderRepository;
   }
   namespace storage::trie {
+    class EphemeralTrieBatch;
     class TrieStorage;
   }
 }  // namespace kagome
@@ -40,10 +43,21 @@ namespace kagome::network {
         const StateRequest &request) const override;
 
    private:
+    using ChildBatches =
+        std::unordered_map<storage::trie::RootHash,
+                           std::shared_ptr<storage::trie::EphemeralTrieBatch>>;
+
+    /// Returns batch of child trie {@param hash}, creating it only if it is
+    /// not in {@param child_batches} yet
+    outcome::result<std::shared_ptr<storage::trie::EphemeralTrieBatch>>
+    getChildBatch(const storage::trie::RootHash &hash,
+                  ChildBatches &child_batches) const;
+
     outcome::result<std::pair<KeyValueStateEntry, size_t>> getEntry(
         const storage::trie::RootHash &hash,
         const common::Buffer &key,
-        size_t limit) const;
+        size_t limit,
+        ChildBatches &child_batches) const;
 
     std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers_;
     std::shared_ptr<storage::trie::TrieStorage> storage_;
@@ -0,0 +1,162 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/state_sync_ranges.hpp"
+
+#include <algorithm>
+
+#include <boost/assert.hpp>
+
+namespace kagome::network {
+
+  bool StateSyncRanges::Range::contains(const common::Buffer &key) const {
+    if (not after.empty() and not(after < key)) {
+      return false;
+    }
+    return not last.has_value() or not(last.value() < key);
+  }
+
+  StateSyncRanges::StateSyncRanges(size_t ranges_number,
+                                   ThroughputOf throughput_of)
+      : throughput_of_{std::move(throughput_of)} {
+    BOOST_ASSERT(ranges_number > 0 and ranges_number <= 256);
+
+    ranges_.reserve(ranges_number);
+    for (size_t i = 0; i < ranges_number; ++i) {
+      Range range;
+      if (i != 0) {
+        range.after.putUint8(i * 256 / ranges_number);
+      }
+      if (i + 1 != ranges_number) {
+        range.last.emplace().putUint8((i + 1) * 256 / ranges_number);
+      }
+      range.start.emplace_back(range.after);
+      ranges_.emplace_back(std::move(range));
+    }
+    assignments_.resize(ranges_.size());
+  }
+
+  StateSyncRanges::StateSyncRanges(std::vector<Range> ranges,
+                                   ThroughputOf throughput_of)
+      : ranges_(std::move(ranges)), throughput_of_{std::move(throughput_of)} {
+    BOOST_ASSERT(not ranges_.empty());
+    assignments_.resize(ranges_.size());
+  }
+
+  std::optional<StateSyncRanges::RangeIndex> StateSyncRanges::assign(
+      const libp2p::peer::PeerId &peer_id, Clock::time_point now) {
+    if (auto it = peers_.find(peer_id);
+        it != peers_.end() and it->second.failures >= kMaxPeerFailures) {
+      return std::nullopt;
+    }
+    if (isBusy(peer_id)) {
+      return std::nullopt;
+    }
+
+    auto own_throughput = throughput(peer_id);
+
+    std::optional<RangeIndex> candidate;
+    for (RangeIndex i = 0; i < ranges_.size(); ++i) {
+      if (ranges_[i].complete) {
+        continue;
+      }
+      auto &assignment = assignments_[i];
+      if (not assignment.has_value()) {
+        candidate = i;
+        break;
+      }
+      if (candidate.has_value()) {
+        continue;
+      }
+
+      // Take over the range from stuck or much slower peer
+      if (now - assignment->since > kSlowRequestDuration) {
+        candidate = i;
+        continue;
+      }
+      if (own_throughput.has_value()) {
+        auto other_throughput = throughput(assignment->peer_id);
+        if (other_throughput.has_value()
+            and other_throughput.value() * kSlowPeerFactor
+                    < own_throughput.value()) {
+          candidate = i;
+        }
+      }
+    }
+
+    if (candidate.has_value()) {
+      assignments_[candidate.value()] =
+          Assignment{peer_id, now, ++last_request_};
+    }
+    return candidate;
+  }
+
+  bool StateSyncRanges::isAssigned(RangeIndex index,
+                                   const libp2p::peer::PeerId &peer_id) const {
+    const auto &assignment = assignments_.at(index);
+    return assignment.has_value() and assignment->peer_id == peer_id;
+  }
+
+  StateSyncRanges::RequestId StateSyncRanges::request(RangeIndex index) const {
+    const auto &assignment = assignments_.at(index);
+    BOOST_ASSERT(assignment.has_value());
+    return assignment->request;
+  }
+
+  bool StateSyncRanges::isCurrent(RangeIndex index, RequestId request) const {
+    const auto &assignment = assignments_.at(index);
+    return assignment.has_value() and assignment->request == request;
+  }
+
+  void StateSyncRanges::onLoaded(RangeIndex index,
+                                 const libp2p::peer::PeerId &peer_id,
+                                 std::vector<common::Buffer> start,
+                                 bool complete,
+                                 Clock::time_point now) {
+    BOOST_ASSERT(isAssigned(index, peer_id));
+    auto &assignment = assignments_[index];
+
+    auto &range = ranges_[index];
+    range.start = std::move(start);
+    range.complete = complete;
+
+    if (complete) {
+      assignment.reset();
+    } else {
+      assignment->since = now;
+      assignment->request = ++last_request_;
+    }
+  }
+
+  void StateSyncRanges::onFailed(RangeIndex index,
+                                 const libp2p::peer::PeerId &peer_id) {
+    ++peers_[peer_id].failures;
+    if (isAssigned(index, peer_id)) {
+      assignments_[index].reset();
+    }
+  }
+
+  bool StateSyncRanges::complete() const {
+    return std::all_of(ranges_.begin(), ranges_.end(), [](const auto &range) {
+      return range.complete;
+    });
+  }
+
+  std::optional<double> StateSyncRanges::throughput(
+      const libp2p::peer::PeerId &peer_id) const {
+    if (not throughput_of_) {
+      return std::nullopt;
+    }
+    return throughput_of_(peer_id);
+  }
+
+  bool StateSyncRanges::isBusy(const libp2p::peer::PeerId &peer_id) const {
+    return std::any_of(
+        assignments_.begin(), assignments_.end(), [&](const auto &assignment) {
+          return assignment.has_value() and assignment->peer_id == peer_id;
+        });
+  }
+
+}  // namespace kagome::network
@@ -0,0 +1,154 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_STATESYNCRANGES
+#define KAGOME_NETWORK_STATESYNCRANGES
+
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <libp2p/peer/peer_id.hpp>
+
+#include "common/buffer.hpp"
+#include "scale/tie.hpp"
+
+namespace kagome::network {
+
+  /**
+   * Splits key space of the main state into ranges, which are loaded
+   * concurrently from different peers. Keeps progress of each range and
+   * assignment of ranges to peers; throughput of peers is not tracked here,
+   * but taken from peer scoring.
+   *
+   * Range has no end key in state request, so peer might return keys of the
+   * next ranges. Caller must cut such keys off using Range::contains() and
+   * consider range complete then.
+   */
+  class StateSyncRanges {
+   public:
+    using Clock = std::chrono::steady_clock;
+    using RangeIndex = size_t;
+    /// Unique id of a request for a range; tells apart responses to requests
+    /// made before the range was reassigned, even to the same peer
+    using RequestId = uint64_t;
+    /// Provides bytes per second loaded from the peer, if known
+    using ThroughputOf = std::function<std::optional<double>(
+        const libp2p::peer::PeerId &)>;
+
+    /// Max amount of failed requests, after which peer isn't used anymore
+    static constexpr size_t kMaxPeerFailures = 3;
+
+    /// Duration of request, after which its range might be reassigned
+    static constexpr std::chrono::seconds kSlowRequestDuration{20};
+
+    /// Range is reassigned to a peer if current one is slower in this times
+    static constexpr size_t kSlowPeerFactor = 4;
+
+    struct Range {
+      SCALE_TIE(4);
+
+      /// Keys of the range are greater than this one; empty means the range
+      /// begins from the first key
+      common::Buffer after;
+      /// Keys of the range are not greater than this one; none means the
+      /// range lasts up to the last key
+      std::optional<common::Buffer> last;
+      /// Keys to continue loading from, as in StateRequest::start
+      std::vector<common::Buffer> start;
+      /// True if all keys of the range are loaded
+      bool complete = false;
+
+      /// @return true if the main state key belongs to the range
+      bool contains(const common::Buffer &key) const;
+    };
+
+    /**
+     * Splits whole key space by first byte of key into ranges of equal width
+     * @param ranges_number - amount of ranges, 1..256
+     * @param throughput_of - throughput of peers, to take ranges over from
+     * much slower ones; none disables it
+     */
+    explicit StateSyncRanges(size_t ranges_number,
+                             ThroughputOf throughput_of = {});
+
+    /// Restores previously saved progress
+    explicit StateSyncRanges(std::vector<Range> ranges,
+                             ThroughputOf throughput_of = {});
+
+    /**
+     * Picks a range to be loaded by the peer. Prefers not assigned ones;
+     * if all of them are assigned, takes the range over from a peer whose
+     * request lasts too long or who is much slower than this one.
+     * @return index of the assigned range or none if peer has to stay idle
+     */
+    std::optional<RangeIndex> assign(const libp2p::peer::PeerId &peer_id,
+                                     Clock::time_point now);
+
+    /// @return true if the range is still assigned to the peer
+    bool isAssigned(RangeIndex index,
+                    const libp2p::peer::PeerId &peer_id) const;
+
+    /// @return id of the request to be sent for the assigned range; it
+    /// changes on every assignment and loaded portion of the range
+    RequestId request(RangeIndex index) const;
+
+    /// @return true if the request is the latest one for the range, i.e. its
+    /// response has to be processed
+    bool isCurrent(RangeIndex index, RequestId request) const;
+
+    /**
+     * Records loaded portion of the range. The range stays assigned to the
+     * peer, unless it is complete.
+     * @param start - position to continue loading from
+     * @param complete - true if the range has no more keys to load
+     */
+    void onLoaded(RangeIndex index,
+                  const libp2p::peer::PeerId &peer_id,
+                  std::vector<common::Buffer> start,
+                  bool complete,
+                  Clock::time_point now);
+
+    /// Releases the range for reassignment after failed request
+    void onFailed(RangeIndex index, const libp2p::peer::PeerId &peer_id);
+
+    const Range &range(RangeIndex index) const {
+      return ranges_.at(index);
+    }
+
+    const std::vector<Range> &ranges() const {
+      return ranges_;
+    }
+
+    /// @return true if all ranges are complete
+    bool complete() const;
+
+   private:
+    struct Assignment {
+      libp2p::peer::PeerId peer_id;
+      Clock::time_point since;
+      RequestId request;
+    };
+
+    struct PeerStats {
+      size_t failures = 0;
+    };
+
+    bool isBusy(const libp2p::peer::PeerId &peer_id) const;
+
+    std::optional<double> throughput(const libp2p::peer::PeerId &peer_id) const;
+
+    std::vector<Range> ranges_;
+    std::vector<std::optional<Assignment>> assignments_;
+    std::unordered_map<libp2p::peer::PeerId, PeerStats> peers_;
+    RequestId last_request_ = 0;
+    ThroughputOf throughput_of_;
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_STATESYNCRANGES
@@ -6,6 +6,8 @@
 #ifndef KAGOME_STREAM_ENGINE_HPP
 #define KAGOME_STREAM_ENGINE_HPP
 
+#include <algorithm>
+#include <array>
 #include <deque>
 #include <numeric>
 #include <optional>
@@ -18,6 +20,7 @@
 #include "libp2p/peer/peer_info.hpp"
 #include "libp2p/peer/protocol.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "network/helpers/peer_id_formatter.hpp"
 #include "network/helpers/scale_message_read_writer.hpp"
 #include "network/protocol_base.hpp"
@@ -47,6 +50,18 @@ namespace kagome::network {
     static constexpr auto kDownVoteByDisconnectionExpirationTimeout =
         std::chrono::seconds(30);
 
+    static constexpr size_t kOutboundPriorities = 3;
+
+    /// Max amount of queued outgoing messages per peer and protocol, indexed
+    /// by OutboundPriority. On overflow the oldest queued announce or
+    /// transaction is dropped, while consensus messages are never dropped:
+    /// a peer not keeping up with them is disconnected instead.
+    static constexpr std::array<size_t, kOutboundPriorities>
+        kOutboundQueueCapacity{8192, 256, 64};
+
+    /// SCALE-encoded message with its length prefix, shared between streams
+    using EncodedMessage = std::shared_ptr<const std::vector<uint8_t>>;
+
     enum class Direction : uint8_t {
       INCOMING = 1,
       OUTGOING = 2,
@@ -87,8 +102,10 @@ namespace kagome::network {
         bool reserved = false;
       } outgoing;
 
-      std::deque<std::function<void(std::shared_ptr<Stream>)>>
-          deferred_messages;
+      /// Messages waiting for the outgoing stream to be written to
+      std::deque<EncodedMessage> queue;
+      /// True while a message is being written to the outgoing stream
+      bool writing = false;
 
      public:
       explicit ProtocolDescr(std::shared_ptr<ProtocolBase> proto)
@@ -139,6 +156,13 @@ namespace kagome::network {
     using ProtocolMap = std::map<std::shared_ptr<ProtocolBase>, ProtocolDescr>;
     using PeerMap = std::map<PeerId, ProtocolMap>;
 
+    struct PendingWrite {
+      PeerId peer_id;
+      std::shared_ptr<ProtocolBase> protocol;
+      std::shared_ptr<Stream> stream;
+      EncodedMessage message;
+    };
+
    public:
     StreamEngine(const StreamEngine &) = delete;
     StreamEngine &operator=(const StreamEngine &) = delete;
@@ -149,7 +173,35 @@ namespace kagome::network {
     ~StreamEngine() = default;
     StreamEngine(std::shared_ptr<PeerRatingRepository> peer_rating_repository)
         : peer_rating_repository_(std::move(peer_rating_repository)),
-          logger_{log::createLogger("StreamEngine", "network")} {}
+          logger_{log::createLogger("StreamEngine", "network")} {
+      metrics_registry_->registerGaugeFamily(
+          kOutboundQueueSize, "Number of outgoing messages waiting in queues");
+      metrics_registry_->registerCounterFamily(
+          kOutboundDropped,
+          "Number of outgoing messages dropped because of full queue");
+      metrics_registry_->registerCounterFamily(
+          kOutboundCoalesced,
+          "Number of outgoing messages coalesced with equal queued ones");
+      metrics_registry_->registerCounterFamily(
+          kOutboundDisconnected,
+          "Number of peers disconnected for not keeping up with consensus "
+          "messages");
+      metric_disconnected_ =
+          metrics_registry_->registerCounterMetric(kOutboundDisconnected);
+      for (auto priority : {OutboundPriority::CONSENSUS,
+                            OutboundPriority::ANNOUNCES,
+                            OutboundPriority::TRANSACTIONS}) {
+        auto labels = std::map<std::string, std::string>{
+            {"priority", priorityName(priority)}};
+        metric_queue_size_[index(priority)] =
+            metrics_registry_->registerGaugeMetric(kOutboundQueueSize, labels);
+        metric_dropped_[index(priority)] =
+            metrics_registry_->registerCounterMetric(kOutboundDropped, labels);
+        metric_coalesced_[index(priority)] =
+            metrics_registry_->registerCounterMetric(kOutboundCoalesced,
+                                                     labels);
+      }
+    }
 
     template <typename... Args>
     static StreamEnginePtr create(Args &&...args) {
@@ -243,6 +295,7 @@ namespace kagome::network {
         if (auto it = streams.find(peer_id); it != streams.end()) {
           for (auto &protocol_it : it->second) {
             auto &descr = protocol_it.second;
+            clearQueue(descr);
             if (descr.incoming.stream) {
               descr.incoming.stream->reset();
             }
@@ -300,20 +353,29 @@ namespace kagome::network {
       BOOST_ASSERT(msg != nullptr);
       BOOST_ASSERT(protocol != nullptr);
 
-      bool was_sent = false;
-      streams_.sharedAccess([&](auto const &streams) {
+      auto encoded = encode(protocol, *msg);
+      if (not encoded) {
+        return;
+      }
+
+      std::vector<PendingWrite> writes;
+      bool overflown = false;
+      streams_.exclusiveAccess([&](auto &streams) {
         forSubscriber(
-            peer_id, streams, protocol, [&](auto type, auto const &descr) {
-              if (descr.hasActiveOutgoing()) {
-                send(peer_id, protocol, descr.outgoing.stream, msg);
-                was_sent = true;
+            peer_id, streams, protocol, [&](auto &proto_map, auto &descr) {
+              if (not enqueue(descr, std::move(encoded.value()))) {
+                overflown = true;
+              } else if (descr.hasActiveOutgoing()) {
+                collectWrites(peer_id, proto_map, writes);
+              } else {
+                updateStream(peer_id, protocol, descr);
               }
             });
       });
-
-      if (not was_sent) {
-        updateStream(peer_id, protocol, msg);
+      if (overflown) {
+        dropSlowPeer(peer_id, protocol);
       }
+      write(writes);
     }
 
     template <typename T>
@@ -324,17 +386,31 @@ namespace kagome::network {
       BOOST_ASSERT(msg != nullptr);
       BOOST_ASSERT(protocol != nullptr);
 
+      // Message is encoded once and the same bytes are written to all streams
+      auto encoded = encode(protocol, *msg);
+      if (not encoded) {
+        return;
+      }
+
+      std::vector<PendingWrite> writes;
+      std::vector<PeerId> overflown;
       forEachPeer([&](const auto &peer_id, auto &proto_map) {
         if (predicate(peer_id)) {
           forProtocol(proto_map, protocol, [&](auto &descr) {
-            if (descr.hasActiveOutgoing()) {
-              send(peer_id, protocol, descr.outgoing.stream, msg);
-            } else {
+            if (not descr.hasActiveOutgoing()) {
               updateStream(peer_id, protocol, descr);
+            } else if (not enqueue(descr, encoded.value())) {
+              overflown.emplace_back(peer_id);
+            } else {
+              collectWrites(peer_id, proto_map, writes);
             }
           });
         }
       });
+      for (auto &peer_id : overflown) {
+        dropSlowPeer(peer_id, protocol);
+      }
+      write(writes);
     }
 
     template <typename T>
@@ -435,33 +511,184 @@ namespace kagome::network {
                replaced ? "replaced" : "stored");
     }
 
+    static size_t index(OutboundPriority priority) {
+      return static_cast<size_t>(priority);
+    }
+
+    static std::string priorityName(OutboundPriority priority) {
+      switch (priority) {
+        case OutboundPriority::CONSENSUS:
+          return "consensus";
+        case OutboundPriority::ANNOUNCES:
+          return "announces";
+        case OutboundPriority::TRANSACTIONS:
+          return "transactions";
+      }
+      return "unknown";
+    }
+
     template <typename T>
-    void send(PeerId const &peer_id,
-              std::shared_ptr<ProtocolBase> const &protocol,
-              std::shared_ptr<Stream> stream,
-              std::shared_ptr<T> const &msg) {
-      BOOST_ASSERT(stream != nullptr);
+    std::optional<EncodedMessage> encode(
+        std::shared_ptr<ProtocolBase> const &protocol, const T &msg) {
+      auto encoded_res = ScaleMessageReadWriter::encodeWithLength(msg);
+      if (encoded_res.has_error()) {
+        SL_ERROR(logger_,
+                 "Could not encode message for {}: {}",
+                 protocol->protocolName(),
+                 encoded_res.error().message());
+        return std::nullopt;
+      }
+      return std::move(encoded_res.value());
+    }
 
-      auto read_writer = std::make_shared<ScaleMessageReadWriter>(stream);
-      read_writer->write(
-          *msg,
-          [wp(weak_from_this()), peer_id, protocol, msg, stream](auto &&res) {
-            if (auto self = wp.lock()) {
-              if (res.has_value()) {
-                SL_TRACE(self->logger_,
-                         "Message sent to {} stream with {}",
-                         protocol->protocolName(),
-                         peer_id);
-              } else {
-                SL_ERROR(self->logger_,
-                         "Could not send message to {} stream with {}: {}",
-                         protocol->protocolName(),
-                         peer_id,
-                         res.error().message());
-                stream->reset();
+    /**
+     * Puts the message into the queue of the protocol descriptor, so a slow
+     * peer can't make pending messages pile up. Announces and transactions
+     * equal to an already queued message are coalesced with it, and the
+     * oldest of them is dropped if the queue is full. Consensus messages are
+     * never dropped.
+     * @return false if the queue of consensus messages is full, then the
+     * message is not queued and the peer has to be disconnected
+     */
+    [[nodiscard]] bool enqueue(ProtocolDescr &descr, EncodedMessage message) {
+      auto priority = descr.protocol->outboundPriority();
+      auto i = index(priority);
+      if (priority != OutboundPriority::CONSENSUS) {
+        auto it = std::find_if(
+            descr.queue.begin(),
+            descr.queue.end(),
+            [&](const EncodedMessage &queued) {
+              return queued == message or *queued == *message;
+            });
+        if (it != descr.queue.end()) {
+          metric_coalesced_[i]->inc();
+          return true;
+        }
+      }
+      if (descr.queue.size() >= kOutboundQueueCapacity[i]) {
+        if (priority == OutboundPriority::CONSENSUS) {
+          return false;
+        }
+        SL_TRACE(logger_,
+                 "Outgoing queue of {} is full, the oldest message is dropped",
+                 descr.protocol->protocolName());
+        descr.queue.pop_front();
+        metric_queue_size_[i]->dec();
+        metric_dropped_[i]->inc();
+      }
+      descr.queue.emplace_back(std::move(message));
+      metric_queue_size_[i]->inc();
+      return true;
+    }
+
+    /**
+     * Disconnects peer, which doesn't keep up with consensus messages. Must
+     * be called when streams are unlocked.
+     */
+    void dropSlowPeer(const PeerId &peer_id,
+                      const std::shared_ptr<ProtocolBase> &protocol) {
+      SL_WARN(logger_,
+              "Peer {} doesn't keep up with {} messages, disconnecting",
+              peer_id,
+              protocol->protocolName());
+      metric_disconnected_->inc();
+      del(peer_id);
+    }
+
+    void clearQueue(ProtocolDescr &descr) {
+      auto priority = index(descr.protocol->outboundPriority());
+      metric_queue_size_[priority]->dec(descr.queue.size());
+      descr.queue.clear();
+    }
+
+    /**
+     * Takes messages to be written to the peer out of queues. Only one message
+     * per stream is written at once. Protocols of lower priority wait while
+     * the peer has messages of higher priority being written or queued.
+     * @param writes - collected messages, to be written when streams are
+     * unlocked
+     */
+    void collectWrites(PeerId const &peer_id,
+                       ProtocolMap &proto_map,
+                       std::vector<PendingWrite> &writes) {
+      std::optional<OutboundPriority> top;
+      for (auto &[protocol, descr] : proto_map) {
+        if (descr.writing
+            or (not descr.queue.empty() and descr.hasActiveOutgoing())) {
+          auto priority = protocol->outboundPriority();
+          if (not top.has_value() or priority < top.value()) {
+            top = priority;
+          }
+        }
+      }
+      if (not top.has_value()) {
+        return;
+      }
+
+      for (auto &[protocol, descr] : proto_map) {
+        if (descr.writing or descr.queue.empty()
+            or not descr.hasActiveOutgoing()
+            or protocol->outboundPriority() != top.value()) {
+          continue;
+        }
+        descr.writing = true;
+        writes.emplace_back(PendingWrite{peer_id,
+                                         protocol,
+                                         descr.outgoing.stream,
+                                         std::move(descr.queue.front())});
+        descr.queue.pop_front();
+        metric_queue_size_[index(top.value())]->dec();
+      }
+    }
+
+    /**
+     * Writes collected messages. Must be called when streams are unlocked,
+     * because write callback might be called immediately.
+     */
+    void write(const std::vector<PendingWrite> &writes) {
+      for (auto &pending : writes) {
+        BOOST_ASSERT(pending.stream != nullptr);
+        BOOST_ASSERT(pending.message != nullptr);
+
+        pending.stream->write(
+            *pending.message,
+            pending.message->size(),
+            [wp(weak_from_this()),
+             peer_id{pending.peer_id},
+             protocol{pending.protocol},
+             message{pending.message},
+             stream{pending.stream}](auto &&res) {
+              if (auto self = wp.lock()) {
+                if (res.has_value()) {
+                  SL_TRACE(self->logger_,
+                           "Message sent to {} stream with {}",
+                           protocol->protocolName(),
+                           peer_id);
+                } else {
+                  SL_ERROR(self->logger_,
+                           "Could not send message to {} stream with {}: {}",
+                           protocol->protocolName(),
+                           peer_id,
+                           res.error().message());
+                  stream->reset();
+                }
+                self->onWritten(peer_id, protocol);
               }
-            }
-          });
+            });
+      }
+    }
+
+    void onWritten(PeerId const &peer_id,
+                   std::shared_ptr<ProtocolBase> const &protocol) {
+      std::vector<PendingWrite> writes;
+      streams_.exclusiveAccess([&](auto &streams) {
+        forSubscriber(
+            peer_id, streams, protocol, [&](auto &proto_map, auto &descr) {
+              descr.writing = false;
+              collectWrites(peer_id, proto_map, writes);
+            });
+      });
+      write(writes);
     }
 
     template <typename PM, typename F>
@@ -497,7 +724,7 @@ namespace kagome::network {
             logger_->debug("DUMP:       I={} O={}   Messages:{}",
                            descr.incoming.stream,
                            descr.outgoing.stream,
-                           descr.deferred_messages.size());
+                           descr.queue.size());
           }
         });
         logger_->debug("DUMP: ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^");
@@ -537,7 +764,7 @@ namespace kagome::network {
                 self->streams_.exclusiveAccess([&](auto &streams) {
                   self->forSubscriber(
                       peer_id, streams, protocol, [&](auto, auto &descr) {
-                        descr.deferred_messages.clear();
+                        self->clearQueue(descr);
                         descr.dropReserved();
                       });
                 });
@@ -546,51 +773,48 @@ namespace kagome::network {
               }
 
               auto &stream = stream_res.value();
+              std::vector<PendingWrite> writes;
               self->streams_.exclusiveAccess([&](auto &streams) {
                 [[maybe_unused]] bool existing = false;
                 self->forSubscriber(
-                    peer_id, streams, protocol, [&](auto, auto &descr) {
+                    peer_id,
+                    streams,
+                    protocol,
+                    [&](auto &proto_map, auto &descr) {
                       existing = true;
                       self->uploadStream(descr.outgoing.stream,
                                          stream,
                                          protocol,
                                          Direction::OUTGOING);
                       descr.dropReserved();
-
-                      while (!descr.deferred_messages.empty()) {
-                        auto &msg = descr.deferred_messages.front();
-                        msg(stream);
-                        descr.deferred_messages.pop_front();
-                      }
+                      self->collectWrites(peer_id, proto_map, writes);
                     });
                 BOOST_ASSERT(existing);
               });
+              self->write(writes);
             });
       }
     }
 
-    template <typename T>
-    void updateStream(const PeerId &peer_id,
-                      const std::shared_ptr<ProtocolBase> &protocol,
-                      std::shared_ptr<T> msg) {
-      streams_.exclusiveAccess([&](auto &streams) {
-        forSubscriber(peer_id, streams, protocol, [&](auto, auto &descr) {
-          descr.deferred_messages.push_back(
-              [wp(weak_from_this()), peer_id, protocol, msg(std::move(msg))](
-                  std::shared_ptr<Stream> stream) {
-                if (auto self = wp.lock()) {
-                  self->send(peer_id, protocol, stream, msg);
-                }
-              });
-          updateStream(peer_id, protocol, descr);
-        });
-      });
-    }
-
     std::shared_ptr<PeerRatingRepository> peer_rating_repository_;
     log::Logger logger_;
 
     SafeObject<PeerMap> streams_;
+
+    // Metrics
+    static constexpr auto kOutboundQueueSize =
+        "kagome_network_outbound_queue_size";
+    static constexpr auto kOutboundDropped =
+        "kagome_network_outbound_dropped";
+    static constexpr auto kOutboundCoalesced =
+        "kagome_network_outbound_coalesced";
+    static constexpr auto kOutboundDisconnected =
+        "kagome_network_outbound_slow_peers_disconnected";
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    std::array<metrics::Gauge *, kOutboundPriorities> metric_queue_size_{};
+    std::array<metrics::Counter *, kOutboundPriorities> metric_dropped_{};
+    std::array<metrics::Counter *, kOutboundPriorities> metric_coalesced_{};
+    metrics::Counter *metric_disconnected_ = nullptr;
   };
 
 }  // namespace kagome::network
@@ -23,13 +23,91 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::network,
   return "unknown error";
 }
 
+namespace {
+  bool sameRequest(const kagome::network::BlocksRequest &lhs,
+                   const kagome::network::BlocksRequest &rhs) {
+    return lhs.fields == rhs.fields and lhs.from == rhs.from
+       and lhs.to == rhs.to and lhs.direction == rhs.direction
+       and lhs.max == rhs.max;
+  }
+
+  /// @return max amount of blocks to be returned in response to the request
+  uint32_t requestedCount(const kagome::network::BlocksRequest &request) {
+    using kagome::application::AppConfiguration;
+    if (request.max.has_value()) {
+      return std::clamp(request.max.value(),
+                        AppConfiguration::kAbsolutMinBlocksInResponse,
+                        AppConfiguration::kAbsolutMaxBlocksInResponse);
+    }
+    return AppConfiguration::kAbsolutMaxBlocksInResponse;
+  }
+}  // namespace
+
 namespace kagome::network {
 
+  namespace detail {
+
+    RecentBlocksResponses::RecentBlocksResponses(size_t capacity)
+        : capacity_{capacity} {}
+
+    const BlocksResponse *RecentBlocksResponses::find(
+        const BlocksRequest &request) {
+      auto it = index_.find(request.fingerprint());
+      if (it == index_.end() or not sameRequest(it->second->request, request)) {
+        return nullptr;
+      }
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return &entries_.front().response;
+    }
+
+    void RecentBlocksResponses::put(const BlocksRequest &request,
+                                    const BlocksResponse &response) {
+      auto size = sizeOf(response);
+      if (size > capacity_) {
+        return;
+      }
+      auto fingerprint = request.fingerprint();
+      if (auto it = index_.find(fingerprint); it != index_.end()) {
+        erase(it->second);
+      }
+      entries_.emplace_front(Entry{request, response, size});
+      index_.emplace(fingerprint, entries_.begin());
+      size_ += size;
+      while (size_ > capacity_) {
+        erase(std::prev(entries_.end()));
+      }
+    }
+
+    size_t RecentBlocksResponses::sizeOf(const BlocksResponse &response) {
+      size_t size = 0;
+      for (const auto &block : response.blocks) {
+        size += sizeof(block);
+        if (block.body.has_value()) {
+          for (const auto &extrinsic : block.body.value()) {
+            size += sizeof(extrinsic) + extrinsic.data.size();
+          }
+        }
+        if (block.justification.has_value()) {
+          size += block.justification->data.size();
+        }
+      }
+      return size;
+    }
+
+    void RecentBlocksResponses::erase(std::list<Entry>::iterator it) {
+      size_ -= it->size;
+      index_.erase(it->request.fingerprint());
+      entries_.erase(it);
+    }
+
+  }  // namespace detail
+
   SyncProtocolObserverImpl::SyncProtocolObserverImpl(
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers)
       : block_tree_{std::move(block_tree)},
         blocks_headers_{std::move(blocks_headers)},
+        responses_cache_{kResponsesCacheSize},
         log_(log::createLogger("SyncProtocolObserver", "network")) {
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(blocks_headers_);
@@ -43,6 +121,15 @@ namespace kagome::network {
       return Error::DUPLICATE_REQUEST_ID;
     }
 
+    if (auto cached = responses_cache_.find(request)) {
+      SL_DEBUG(log_,
+               "Return cached response id={}: count {}",
+               request_id,
+               cached->blocks.size());
+      requested_ids_.erase(request_id);
+      return *cached;
+    }
+
     BlocksResponse response;
 
     // firstly, check if we have both "from" & "to" blocks (if set)
@@ -66,6 +153,9 @@ namespace kagome::network {
 
     // thirdly, fill the resulting response with data, which we were asked for
     fillBlocksResponse(request, response, chain_hash);
+    if (isComplete(request, response) and isFinalized(response)) {
+      responses_cache_.put(request, response);
+    }
     if (response.blocks.empty()) {
       SL_DEBUG(log_, "Return response id={}: no blocks", request_id);
     } else if (response.blocks.size() == 1) {
@@ -115,14 +205,7 @@ namespace kagome::network {
                          : blockchain::BlockTree::GetChainDirection::DESCEND;
     blockchain::BlockTree::BlockHashVecRes chain_hash_res{{}};
 
-    uint32_t request_count =
-        application::AppConfiguration::kAbsolutMaxBlocksInResponse;
-    if (request.max.has_value()) {
-      request_count = std::clamp(
-          request.max.value(),
-          application::AppConfiguration::kAbsolutMinBlocksInResponse,
-          application::AppConfiguration::kAbsolutMaxBlocksInResponse);
-    }
+    auto request_count = requestedCount(request);
 
     // Note: request.to is not used in substrate
 
@@ -184,4 +267,49 @@ namespace kagome::network {
       }
     }
   }
+
+  bool SyncProtocolObserverImpl::isComplete(
+      const BlocksRequest &request, const BlocksResponse &response) const {
+    if (response.blocks.size() >= requestedCount(request)) {
+      return true;
+    }
+    if (response.blocks.empty()) {
+      return false;
+    }
+    if (request.to.has_value()
+        and (response.blocks.front().hash == request.to.value()
+             or response.blocks.back().hash == request.to.value())) {
+      return true;
+    }
+    // Nothing precedes genesis, so descending chain can't become longer
+    return request.direction == Direction::DESCENDING
+       and response.blocks.back().hash == block_tree_->getGenesisBlockHash();
+  }
+
+  bool SyncProtocolObserverImpl::isFinalized(
+      const BlocksResponse &response) const {
+    if (response.blocks.empty()) {
+      return false;
+    }
+    const auto last_finalized = block_tree_->getLastFinalized();
+
+    // The highest block is either the first or the last one in the response
+    for (const auto *block :
+         {&response.blocks.front(), &response.blocks.back()}) {
+      primitives::BlockNumber number;
+      if (block->header.has_value()) {
+        number = block->header->number;
+      } else {
+        auto number_res = blocks_headers_->getNumberByHash(block->hash);
+        if (not number_res.has_value()) {
+          return false;
+        }
+        number = number_res.value();
+      }
+      if (number > last_finalized.number) {
+        return false;
+      }
+    }
+    return true;
+  }
 }  // namespace kagome::network
@@ -8,6 +8,9 @@
 
 #include "network/sync_protocol_observer.hpp"
 
+#include <list>
+#include <unordered_map>
+
 #include <libp2p/host/host.hpp>
 #include <libp2p/peer/peer_info.hpp>
 
@@ -19,12 +22,55 @@
 
 namespace kagome::network {
 
+  namespace detail {
+
+    /**
+     * LRU cache of recently built responses. Many syncing peers ask for the
+     * same ranges of blocks, so such requests are served without reading and
+     * decoding the blocks again.
+     */
+    class RecentBlocksResponses {
+     public:
+      /// @param capacity - max total size of blocks data of cached responses
+      explicit RecentBlocksResponses(size_t capacity);
+
+      /// @return cached response to the same request, if any
+      const BlocksResponse *find(const BlocksRequest &request);
+
+      /// Caches response; the least recently used ones are evicted to fit
+      void put(const BlocksRequest &request, const BlocksResponse &response);
+
+     private:
+      struct Entry {
+        BlocksRequest request;
+        BlocksResponse response;
+        size_t size;
+      };
+
+      /// @return approximate size of blocks data of the response
+      static size_t sizeOf(const BlocksResponse &response);
+
+      void erase(std::list<Entry>::iterator it);
+
+      const size_t capacity_;
+      size_t size_ = 0;
+      /// Most recently used first
+      std::list<Entry> entries_;
+      std::unordered_map<BlocksRequest::Fingerprint, std::list<Entry>::iterator>
+          index_;
+    };
+
+  }  // namespace detail
+
   class SyncProtocolObserverImpl
       : public SyncProtocolObserver,
         public std::enable_shared_from_this<SyncProtocolObserverImpl> {
    public:
     enum class Error { DUPLICATE_REQUEST_ID = 1 };
 
+    /// Max total size of blocks data of cached responses
+    static constexpr size_t kResponsesCacheSize = 64 * 1024 * 1024;
+
     SyncProtocolObserverImpl(
         std::shared_ptr<blockchain::BlockTree> block_tree,
         std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers);
@@ -44,10 +90,21 @@ namespace kagome::network {
         network::BlocksResponse &response,
         const std::vector<primitives::BlockHash> &hash_chain) const;
 
+    /// @return true if response has as many blocks as requested or reaches
+    /// the requested end, so later the same request can't get more blocks.
+    /// Short response at the tip of the chain grows as blocks are imported
+    bool isComplete(const network::BlocksRequest &request,
+                    const network::BlocksResponse &response) const;
+
+    /// @return true if all blocks of the response are finalized, so it
+    /// never changes and might be cached
+    bool isFinalized(const network::BlocksResponse &response) const;
+
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers_;
 
     mutable std::unordered_set<BlocksRequest::Fingerprint> requested_ids_;
+    mutable detail::RecentBlocksResponses responses_cache_;
 
     log::Logger log_;
   };
@@ -5,7 +5,9 @@
 
 #include "network/impl/synchronizer_impl.hpp"
 
+#include <algorithm>
 #include <random>
+#include <unordered_set>
 
 #include "application/app_configuration.hpp"
 #include "blockchain/block_tree_error.hpp"
@@ -43,6 +45,10 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::network, SynchronizerImpl::Error, e) {
       return "Block is arrived too early. Try to process it late";
     case E::DUPLICATE_REQUEST:
       return "Duplicate of recent request has been detected";
+    case E::NO_SUITABLE_PEER:
+      return "No suitable peer to load blocks from";
+    case E::NO_AUTHORITIES:
+      return "Authority set of genesis block is unknown";
   }
   return "unknown error";
 }
@@ -60,6 +66,9 @@ namespace {
       case SM::Fast:
         return kagome::network::BlockAttribute::HEADER
                | kagome::network::BlockAttribute::JUSTIFICATION;
+      case SM::Warp:
+        // Finality of target block is proven by warp proof
+        return kagome::network::BlockAttribute::HEADER;
     }
     return kagome::network::BlocksRequest::kBasicAttributes;
   }
@@ -79,7 +88,11 @@ namespace kagome::network {
       std::shared_ptr<network::Router> router,
       std::shared_ptr<libp2p::basic::Scheduler> scheduler,
       std::shared_ptr<crypto::Hasher> hasher,
-      std::shared_ptr<storage::BufferStorage> buffer_storage)
+      std::shared_ptr<storage::BufferStorage> buffer_storage,
+      std::shared_ptr<PeerRatingRepository> peer_rating_repository,
+      std::shared_ptr<PeerScoring> peer_scoring,
+      std::shared_ptr<authority::AuthorityManager> authority_manager,
+      std::shared_ptr<crypto::Ed25519Provider> ed25519_provider)
       : app_state_manager_(std::move(app_state_manager)),
         block_tree_(std::move(block_tree)),
         trie_changes_tracker_(std::move(changes_tracker)),
@@ -90,7 +103,11 @@ namespace kagome::network {
         router_(std::move(router)),
         scheduler_(std::move(scheduler)),
         hasher_(std::move(hasher)),
-        buffer_storage_(std::move(buffer_storage)) {
+        buffer_storage_(std::move(buffer_storage)),
+        peer_rating_repository_(std::move(peer_rating_repository)),
+        peer_scoring_(std::move(peer_scoring)),
+        authority_manager_(std::move(authority_manager)),
+        ed25519_provider_(std::move(ed25519_provider)) {
     BOOST_ASSERT(app_state_manager_);
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(trie_changes_tracker_);
@@ -101,6 +118,10 @@ namespace kagome::network {
     BOOST_ASSERT(scheduler_);
     BOOST_ASSERT(hasher_);
     BOOST_ASSERT(buffer_storage_);
+    BOOST_ASSERT(peer_rating_repository_);
+    BOOST_ASSERT(peer_scoring_);
+    BOOST_ASSERT(authority_manager_);
+    BOOST_ASSERT(ed25519_provider_);
 
     sync_method_ = app_config.syncMethod();
 
@@ -124,22 +145,22 @@ namespace kagome::network {
       return false;
     }
     if (opt_res.value().has_value()) {
-      auto &encoded_block = opt_res.value().value();
-      auto block_res =
-          scale::decode<decltype(state_sync_on_block_)::value_type>(
-              std::move(encoded_block));
-      if (block_res.has_error()) {
-        SL_ERROR(log_,
-                 "Can't decode data of incomplete state sync: {}",
-                 block_res.error());
-        return false;
+      auto &encoded_progress = opt_res.value().value();
+      auto progress_res =
+          scale::decode<StateSyncProgress>(std::move(encoded_progress));
+      if (progress_res.has_error()) {
+        SL_WARN(log_,
+                "Can't decode data of incomplete state sync: {}; "
+                "State sync will be restarted",
+                progress_res.error());
+        return true;
       }
-      auto &block = block_res.value();
+      auto &progress = progress_res.value();
       SL_WARN(log_,
               "Found incomplete state sync on block {}; "
-              "State sync will be restarted",
-              block);
-      state_sync_on_block_.emplace(std::move(block));
+              "State sync will be continued",
+              progress.block);
+      state_sync_progress_.emplace(std::move(progress));
     }
     return true;
   }
@@ -225,6 +246,13 @@ namespace kagome::network {
       return false;
     }
 
+    // Parallel download of blocks is running, so peer just takes part in it
+    if (block_download_.has_value()
+        and block_download_->scheduler.linked().number < block_info.number) {
+      joinBlockDownload(peer_id, block_info, std::move(handler));
+      return true;
+    }
+
     // We are communicating with one peer only for one issue.
     // If peer is already in use, don't start an additional issue.
     auto peer_is_busy = not busy_peers_.emplace(peer_id).second;
@@ -272,7 +300,10 @@ namespace kagome::network {
 
     // Callback what will be called at the end of finding the best common block
     auto find_handler =
-        [wp = weak_from_this(), peer_id, handler = std::move(handler)](
+        [wp = weak_from_this(),
+         peer_id,
+         target = block_info,
+         handler = std::move(handler)](
             outcome::result<primitives::BlockInfo> res) mutable {
           if (auto self = wp.lock()) {
             // Remove peer from list of busy peers
@@ -296,6 +327,14 @@ namespace kagome::network {
               return;
             }
 
+            // Load far blocks from several peers in parallel
+            if (target.number
+                > block_info.number + kBlockDownloadSegmentSize) {
+              self->startBlockDownload(
+                  peer_id, block_info, target, std::move(handler));
+              return;
+            }
+
             // Start to load blocks since found
             SL_DEBUG(self->log_,
                      "Start to load blocks from {} since block {}",
@@ -805,6 +844,308 @@ namespace kagome::network {
     protocol->request(peer_id, std::move(request), std::move(response_handler));
   }
 
+  void SynchronizerImpl::startBlockDownload(
+      const libp2p::peer::PeerId &peer_id,
+      const primitives::BlockInfo &common,
+      const primitives::BlockInfo &target,
+      SyncResultHandler &&handler) {
+    if (not block_download_.has_value()) {
+      SL_INFO(log_,
+              "Start parallel download of blocks since {} up to {}",
+              common,
+              target);
+      auto throughput_of = [router{router_}, peer_scoring{peer_scoring_}](
+                               const libp2p::peer::PeerId &peer_id) {
+        return peer_scoring->throughput(
+            peer_id, router->getSyncProtocol()->protocolName());
+      };
+      block_download_.emplace(
+          BlockDownload{BlockDownloadScheduler{common,
+                                               target.number,
+                                               kBlockDownloadSegmentSize,
+                                               kBlockDownloadWindow,
+                                               std::move(throughput_of)},
+                        {}});
+    }
+    joinBlockDownload(peer_id, target, std::move(handler));
+  }
+
+  void SynchronizerImpl::joinBlockDownload(
+      const libp2p::peer::PeerId &peer_id,
+      const primitives::BlockInfo &target,
+      SyncResultHandler &&handler) {
+    BOOST_ASSERT(block_download_.has_value());
+    auto &download = block_download_.value();
+
+    SL_DEBUG(log_,
+             "Peer {} takes part in parallel download of blocks up to {}",
+             peer_id,
+             target);
+    download.scheduler.addPeer(peer_id, target.number);
+    download.scheduler.extend(target.number);
+
+    // Previous handler of the peer just gets the progress
+    auto &peer_handler = download.handlers[peer_id];
+    if (peer_handler) {
+      peer_handler(download.scheduler.linked());
+    }
+    peer_handler = std::move(handler);
+
+    requestBlockSegments();
+  }
+
+  void SynchronizerImpl::requestBlockSegments() {
+    if (not block_download_.has_value() or node_is_shutting_down_) {
+      return;
+    }
+    auto &scheduler = block_download_->scheduler;
+
+    auto peers = scheduler.peers();
+    if (peers.empty()) {
+      SL_WARN(log_,
+              "Parallel download of blocks is interrupted on block {}: "
+              "no suitable peer",
+              scheduler.linked());
+      finishBlockDownload(Error::NO_SUITABLE_PEER);
+      return;
+    }
+
+    if (known_blocks_.size()
+        >= kBlockDownloadSegmentSize * kBlockDownloadWindow) {
+      SL_TRACE(log_,
+               "{} blocks in queue: postpone download of blocks",
+               known_blocks_.size());
+      return;
+    }
+
+    const auto &protocol_name = router_->getSyncProtocol()->protocolName();
+
+    struct Candidate {
+      libp2p::peer::PeerId peer_id;
+      double throughput;
+      double score;
+    };
+    std::vector<Candidate> candidates;
+    candidates.reserve(peers.size());
+    for (auto &peer_id : peers) {
+      if (busy_peers_.find(peer_id) != busy_peers_.end()) {
+        continue;
+      }
+      // Reputation only excludes misbehaving peers, it doesn't rank them
+      if (peer_rating_repository_->rating(peer_id) < 0) {
+        continue;
+      }
+      candidates.emplace_back(Candidate{
+          peer_id,
+          peer_scoring_->throughput(peer_id, protocol_name).value_or(0.),
+          peer_scoring_->score(peer_id).value_or(0.)});
+    }
+
+    // Peers are ranked by peer scoring alone: the fastest ones get the lowest
+    // (i.e. the most urgent) segments; peers without responses over sync
+    // protocol yet are ordered by their score
+    std::sort(candidates.begin(),
+              candidates.end(),
+              [](const Candidate &lhs, const Candidate &rhs) {
+                return std::tie(lhs.throughput, lhs.score)
+                     > std::tie(rhs.throughput, rhs.score);
+              });
+
+    auto now = BlockDownloadScheduler::Clock::now();
+    for (auto &candidate : candidates) {
+      auto segment = scheduler.assign(candidate.peer_id, now);
+      if (segment.has_value()) {
+        requestBlockSegment(candidate.peer_id, segment.value());
+      }
+    }
+  }
+
+  void SynchronizerImpl::requestBlockSegment(
+      const libp2p::peer::PeerId &peer_id,
+      const BlockDownloadScheduler::Segment &segment) {
+    busy_peers_.emplace(peer_id);
+    SL_TRACE(log_, "Peer {} marked as busy", peer_id);
+
+    SL_DEBUG(log_,
+             "Request blocks #{}..#{} from {}",
+             segment.first,
+             segment.first + segment.amount - 1,
+             peer_id);
+
+    network::BlocksRequest request{attributesForSync(sync_method_),
+                                   segment.first,
+                                   std::nullopt,
+                                   network::Direction::ASCENDING,
+                                   segment.amount};
+
+    auto response_handler =
+        [wp = weak_from_this(),
+         peer_id,
+         segment,
+         requested = BlockDownloadScheduler::Clock::now()](
+            auto &&response_res) mutable {
+          if (auto self = wp.lock()) {
+            self->onBlockSegment(
+                peer_id, segment, requested, std::move(response_res));
+          }
+        };
+
+    auto protocol = router_->getSyncProtocol();
+    BOOST_ASSERT_MSG(protocol, "Router did not provide sync protocol");
+    protocol->request(peer_id, std::move(request), std::move(response_handler));
+  }
+
+  void SynchronizerImpl::onBlockSegment(
+      const libp2p::peer::PeerId &peer_id,
+      const BlockDownloadScheduler::Segment &segment,
+      BlockDownloadScheduler::Clock::time_point requested,
+      outcome::result<BlocksResponse> response_res) {
+    if (busy_peers_.erase(peer_id) > 0) {
+      SL_TRACE(log_, "Peer {} unmarked as busy", peer_id);
+    }
+    if (not block_download_.has_value()) {
+      return;
+    }
+    auto &scheduler = block_download_->scheduler;
+
+    // Segment was taken over by another peer
+    if (not scheduler.isAssigned(segment, peer_id)) {
+      SL_TRACE(log_,
+               "Blocks #{}..#{} from {} are ignored: segment is reassigned",
+               segment.first,
+               segment.first + segment.amount - 1,
+               peer_id);
+      scheduler.onOutdated(peer_id);
+      requestBlockSegments();
+      return;
+    }
+
+    const auto &protocol_name = router_->getSyncProtocol()->protocolName();
+
+    auto on_failure = [&](const std::error_code &error) {
+      SL_DEBUG(log_,
+               "Can't load blocks #{}..#{} from {}: {}",
+               segment.first,
+               segment.first + segment.amount - 1,
+               peer_id,
+               error.message());
+      scheduler.onFailed(segment, peer_id);
+      peer_rating_repository_->downvote(peer_id);
+      peer_scoring_->onRequestFailed(peer_id, protocol_name);
+      requestBlockSegments();
+    };
+
+    if (response_res.has_error()) {
+      on_failure(response_res.error());
+      return;
+    }
+    auto &blocks = response_res.value().blocks;
+    if (blocks.empty()) {
+      on_failure(Error::EMPTY_RESPONSE);
+      return;
+    }
+
+    size_t bytes = 0;
+    for (auto &block : blocks) {
+      if (not block.header.has_value()) {
+        on_failure(Error::RESPONSE_WITHOUT_BLOCK_HEADER);
+        return;
+      }
+      if (sync_method_ == application::AppConfiguration::SyncMethod::Full
+          and not block.body.has_value()) {
+        on_failure(Error::RESPONSE_WITHOUT_BLOCK_BODY);
+        return;
+      }
+      auto encoded_header = scale::encode(block.header.value()).value();
+      if (block.hash != hasher_->blake2b_256(encoded_header)) {
+        on_failure(Error::INVALID_HASH);
+        return;
+      }
+      bytes += encoded_header.size();
+      if (block.body.has_value()) {
+        for (auto &extrinsic : block.body.value()) {
+          bytes += extrinsic.data.size();
+        }
+      }
+    }
+
+    auto now = BlockDownloadScheduler::Clock::now();
+    if (not scheduler.onLoaded(segment, peer_id, std::move(blocks))) {
+      SL_DEBUG(log_,
+               "Can't load blocks #{}..#{} from {}: "
+               "Received blocks are not a chain of requested ones",
+               segment.first,
+               segment.first + segment.amount - 1,
+               peer_id);
+      peer_rating_repository_->downvote(peer_id);
+      peer_scoring_->onRequestFailed(peer_id, protocol_name);
+      requestBlockSegments();
+      return;
+    }
+    peer_scoring_->onResponse(
+        peer_id,
+        protocol_name,
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - requested),
+        bytes);
+
+    // Enqueue blocks linked to already enqueued ones
+    bool some_blocks_added = false;
+    const auto &last_finalized_block = block_tree_->getLastFinalized();
+    for (auto &[block, block_peer_id] : scheduler.takeLinked()) {
+      const auto &header = block.header.value();
+      if (header.number <= last_finalized_block.number) {
+        continue;
+      }
+      if (auto it = known_blocks_.find(block.hash); it != known_blocks_.end()) {
+        it->second.peers.emplace(block_peer_id);
+        continue;
+      }
+
+      SL_TRACE(log_,
+               "Enqueue block {} received from {}",
+               BlockInfo(header.number, block.hash),
+               block_peer_id);
+
+      generations_.emplace(header.number, block.hash);
+      ancestry_.emplace(header.parent_hash, block.hash);
+      auto hash = block.hash;
+      known_blocks_.emplace(hash,
+                            KnownBlock{std::move(block), {block_peer_id}});
+      some_blocks_added = true;
+    }
+    metric_import_queue_length_->set(known_blocks_.size());
+
+    if (some_blocks_added) {
+      SL_TRACE(log_, "Enqueued some new blocks: schedule applying");
+      scheduler_->schedule([wp = weak_from_this()] {
+        if (auto self = wp.lock()) {
+          self->applyNextBlock();
+        }
+      });
+    }
+
+    if (scheduler.complete()) {
+      auto last_loaded_block = scheduler.linked();
+      SL_INFO(log_,
+              "Parallel download of blocks is finished on block {}",
+              last_loaded_block);
+      finishBlockDownload(last_loaded_block);
+      return;
+    }
+
+    requestBlockSegments();
+  }
+
+  void SynchronizerImpl::finishBlockDownload(
+      outcome::result<primitives::BlockInfo> res) {
+    BOOST_ASSERT(block_download_.has_value());
+    auto handlers = std::move(block_download_->handlers);
+    block_download_.reset();
+    for (auto &[peer_id, handler] : handlers) {
+      if (handler) handler(res);
+    }
+  }
+
   void SynchronizerImpl::loadJustifications(const libp2p::peer::PeerId &peer_id,
                                             primitives::BlockInfo target_block,
                                             std::optional<uint32_t> limit,
@@ -924,8 +1265,7 @@ namespace kagome::network {
   void SynchronizerImpl::syncState(const libp2p::peer::PeerId &peer_id,
                                    const primitives::BlockInfo &block,
                                    SyncResultHandler &&handler) {
-    if (state_sync_request_.has_value()
-        and state_sync_request_->hash != block.hash) {
+    if (state_sync_.has_value() and state_sync_->block != block) {
       SL_WARN(log_,
               "SyncState was not requested to {}: "
               "state sync for other block is not completed yet",
@@ -933,183 +1273,540 @@ namespace kagome::network {
       return;
     }
 
-    bool bool_val = false;
-    if (not state_sync_request_in_progress_.compare_exchange_strong(bool_val,
-                                                                    true)) {
+    if (not state_sync_.has_value()) {
+      auto res = startStateSync(block);
+      if (res.has_error()) {
+        SL_WARN(log_,
+                "State sync on block {} can't be started: {}",
+                block,
+                res.error().message());
+        if (handler) handler(res.as_failure());
+        return;
+      }
+    }
+
+    auto index =
+        state_sync_->ranges.assign(peer_id, StateSyncRanges::Clock::now());
+    if (not index.has_value()) {
       SL_TRACE(log_,
                "State sync request was not sent to {} for block {}: "
-               "previous request in progress",
+               "no range to be loaded by this peer",
                peer_id,
                block);
+      // Peer is idle now; sync goes on with other peers, and it is known to
+      // be finished, when there is no incomplete request of state sync
+      if (handler) handler(block);
       return;
     }
 
-    if (not state_sync_request_.has_value()) {
+    requestStateRange(peer_id, index.value(), std::move(handler));
+  }
+
+  outcome::result<void> SynchronizerImpl::startStateSync(
+      const primitives::BlockInfo &block) {
+    auto state_root = serializer_->getEmptyRootHash();
+    std::optional<StateSyncRanges> ranges;
+    auto throughput_of = [router{router_}, peer_scoring{peer_scoring_}](
+                             const libp2p::peer::PeerId &peer_id) {
+      return peer_scoring->throughput(
+          peer_id, router->getStateProtocol()->protocolName());
+    };
+
+    if (state_sync_progress_.has_value()
+        and state_sync_progress_->block == block) {
+      state_root = state_sync_progress_->state_root;
+      // Loaded part of child states is not saved, so they are loaded again
+      for (auto &range : state_sync_progress_->ranges) {
+        if (range.start.size() == 2) {
+          range.start.back().clear();
+        }
+      }
+      ranges.emplace(std::move(state_sync_progress_->ranges),
+                     std::move(throughput_of));
+      SL_INFO(log_, "Sync of state for block {} has continued", block);
+    } else {
+      ranges.emplace(kStateSyncRangesNumber, std::move(throughput_of));
       SL_INFO(log_, "Sync of state for block {} has started", block);
     }
+    state_sync_progress_.reset();
+
+    // Changes are not tracked, since the tracker would keep whole state in
+    // memory until the end of sync
+    OUTCOME_TRY(batch, storage_->getUntrackedPersistentBatchAt(state_root));
+    state_sync_.emplace(
+        StateSync{block, std::move(ranges.value()), {std::move(batch)}, {}, 0});
+    return outcome::success();
+  }
+
+  void SynchronizerImpl::requestStateRange(const libp2p::peer::PeerId &peer_id,
+                                           StateSyncRanges::RangeIndex index,
+                                           SyncResultHandler &&handler) {
+    BOOST_ASSERT(state_sync_.has_value());
+    const auto &block = state_sync_->block;
 
-    SL_TRACE(
-        log_, "State sync request has sent to {} for block {}", peer_id, block);
+    SL_TRACE(log_,
+             "State sync request has sent to {} for block {} (range #{})",
+             peer_id,
+             block,
+             index);
 
-    auto request = state_sync_request_.value_or(
-        network::StateRequest{block.hash, {{}}, true});
+    network::StateRequest request{
+        block.hash, state_sync_->ranges.range(index).start, true};
 
     auto protocol = router_->getStateProtocol();
     BOOST_ASSERT_MSG(protocol, "Router did not provide state protocol");
 
-    auto response_handler =
-        [wp = weak_from_this(), block, peer_id, handler = std::move(handler)](
-            auto &&response_res) mutable {
-          auto self = wp.lock();
-          if (not self) {
-            return;
-          }
+    auto response_handler = [wp = weak_from_this(),
+                             peer_id,
+                             index,
+                             request_id = state_sync_->ranges.request(index),
+                             request_start = request.start,
+                             requested = StateSyncRanges::Clock::now(),
+                             handler = std::move(handler)](
+                                auto &&response_res) mutable {
+      if (auto self = wp.lock()) {
+        self->onStateResponse(peer_id,
+                              index,
+                              request_id,
+                              request_start,
+                              requested,
+                              std::move(response_res),
+                              std::move(handler));
+      }
+    };
 
-          // Request failed
-          if (response_res.has_error()) {
-            self->state_sync_request_in_progress_ = false;
+    protocol->request(peer_id, std::move(request), std::move(response_handler));
+  }
 
-            SL_WARN(self->log_,
-                    "State syncing failed with error: {}",
-                    response_res.error().message());
-            if (handler) handler(response_res.as_failure());
-            return;
-          }
+  void SynchronizerImpl::onStateResponse(
+      const libp2p::peer::PeerId &peer_id,
+      StateSyncRanges::RangeIndex index,
+      StateSyncRanges::RequestId request_id,
+      const std::vector<common::Buffer> &request_start,
+      StateSyncRanges::Clock::time_point requested,
+      outcome::result<StateResponse> response_res,
+      SyncResultHandler &&handler) {
+    if (not state_sync_.has_value()
+        or not state_sync_->ranges.isCurrent(index, request_id)) {
+      SL_TRACE(log_,
+               "Obsolete state response from {} (range #{}) is ignored",
+               peer_id,
+               index);
+      return;
+    }
+    auto &state_sync = state_sync_.value();
+    const auto block = state_sync.block;
 
-          // Processing of response
-          for (unsigned i = 0; i < response_res.value().entries.size(); ++i) {
-            const auto &state_entry = response_res.value().entries[i];
-
-            // get or create batch
-            auto it = self->batches_store_.find(state_entry.state_root);
-            auto batch = (it != self->batches_store_.end())
-                             ? std::get<2>(it->second)
-                             : self->storage_
-                                   ->getPersistentBatchAt(
-                                       self->serializer_->getEmptyRootHash())
-                                   .value();
-
-            // main storage entries size empty at child storage state syncing
-            if (state_entry.entries.size()) {
-              SL_TRACE(self->log_,
-                       "Syncing {}th item. Current key {}. Keys received {}.",
-                       i,
-                       state_entry.entries[0].key.toHex(),
-                       state_entry.entries.size());
-              for (const auto &entry : state_entry.entries) {
-                std::ignore = batch->put(entry.key, entry.value);
-              }
-
-              // store batch to continue at next state_entry
-              if (!state_entry.complete) {
-                self->batches_store_[state_entry.state_root] = {
-                    state_entry.entries.back().key, i, batch};
-              } else {
-                self->batches_store_.erase(state_entry.state_root);
-              }
-            }
+    if (response_res.has_value() and response_res.value().entries.empty()) {
+      response_res = Error::EMPTY_RESPONSE;
+    }
 
-            // Handle completion of syncing
-            if (state_entry.complete) {
-              auto res = batch->commit();
-              if (res.has_value()) {
-                const auto &expected = [&] {
-                  if (i != 0) {  // Child state
-                    return state_entry.state_root;
-                  } else {  // Main state
-                    auto header_res =
-                        self->block_tree_->getBlockHeader(block.hash);
-                    BOOST_ASSERT_MSG(header_res.has_value(),
-                                     "It is state of existing block; head "
-                                     "must be existing");
-                    const auto &header = header_res.value();
-                    return header.state_root;
-                  }
-                }();
-                const auto &actual = res.value();
-
-                if (actual == expected) {
-                  SL_INFO(self->log_,
-                          "Syncing of {}state on block {} has finished. "
-                          "Root hashes match: {}",
-                          i != 0 ? "child " : "",
-                          block,
-                          actual);
-                } else {
-                  SL_WARN(self->log_,
-                          "Syncing of {}state on block {} has finished. "
-                          "Root hashes mismatch: expected={}, actual={}",
-                          i != 0 ? "child " : "",
-                          block,
-                          expected,
-                          actual);
-                }
-              }
+    const auto &protocol_name = router_->getStateProtocol()->protocolName();
 
-              self->trie_changes_tracker_->onBlockAdded(block.hash);
-            }
+    // Request failed
+    if (response_res.has_error()) {
+      state_sync.ranges.onFailed(index, peer_id);
+      peer_scoring_->onRequestFailed(peer_id, protocol_name);
 
-            // just calculate state entries in main storage for trace log
-            if (!i) {
-              self->entries_ += state_entry.entries.size();
-            }
-          }
+      SL_WARN(log_,
+              "State syncing with {} failed with error: {}",
+              peer_id,
+              response_res.error().message());
+      if (handler) handler(response_res.as_failure());
+      return;
+    }
+    auto &response = response_res.value();
+    const auto &range = state_sync.ranges.range(index);
 
-          // not well-formed way to place 0th batch key to front
-          std::map<unsigned, common::Buffer> keymap;
-          for (const auto &[_, val] : self->batches_store_) {
-            unsigned i = std::get<1>(val);
-            keymap[i] = std::get<0>(val);
-            SL_TRACE(self->log_, "Index: {}, Key: {}", i, keymap[i]);
-          }
+    // Peer doesn't know about ranges; keys of next ranges are cut off
+    bool out_of_range = false;
+    size_t bytes = 0;
+    std::unordered_set<storage::trie::RootHash> child_roots;
 
-          std::vector<common::Buffer> keys;
-          for (const auto &[_, val] : keymap) {
-            keys.push_back(val);
-          }
+    // Position of loading in main state
+    auto parent_key = request_start.front();
 
-          if (not response_res.value().entries[0].complete) {
-            SL_TRACE(self->log_,
-                     "State syncing continues. {} entries loaded",
-                     self->entries_);
-            // Save data of incomplete state sync once
-            if (not self->state_sync_on_block_.has_value()) {
-              auto res = self->buffer_storage_->put(
-                  storage::kBlockOfIncompleteSyncStateLookupKey,
-                  common::Buffer(scale::encode(block).value()));
-              if (res.has_error()) {
-                SL_WARN(self->log_,
-                        "Can't save data of incomplete state sync: {}",
-                        res.error());
-              }
-              self->state_sync_on_block_.emplace(block);
-            }
-            self->state_sync_request_ =
-                StateRequest{block.hash, std::move(keys), true};
-            self->state_sync_request_in_progress_ = false;
-            self->syncState(peer_id, block, std::move(handler));
+    const auto &main_state = response.entries.front();
+    for (const auto &entry : main_state.entries) {
+      if (not range.contains(entry.key)) {
+        out_of_range = true;
+        break;
+      }
+      std::ignore = state_sync.main_batch.batch->put(entry.key, entry.value);
+      state_sync.main_batch.unflushed_bytes +=
+          entry.key.size() + entry.value.size();
+      bytes += entry.key.size() + entry.value.size();
+      ++entries_;
+
+      const auto &child_prefix = storage::kChildStorageDefaultPrefix;
+      if (entry.key.size() > child_prefix.size()
+          and entry.key.subbuffer(0, child_prefix.size()) == child_prefix) {
+        if (auto root_res = storage::trie::RootHash::fromSpan(entry.value);
+            root_res.has_value()) {
+          child_roots.emplace(root_res.value());
+        }
+      }
+      parent_key = entry.key;
+    }
+
+    // Position of loading in child state, if it is not loaded completely
+    std::optional<common::Buffer> child_key;
+
+    for (size_t i = 1; i < response.entries.size(); ++i) {
+      const auto &child_state = response.entries[i];
+
+      // Child state of the requested position goes first, other ones follow
+      // main state keys they belong to
+      bool is_continuation = i == 1 and request_start.size() == 2;
+      if (not is_continuation
+          and child_roots.count(child_state.state_root) == 0) {
+        continue;
+      }
+
+      auto &child_batch = state_sync.child_batches[child_state.state_root];
+      if (child_batch.batch == nullptr) {
+        child_batch.batch = storage_
+                                ->getUntrackedPersistentBatchAt(
+                                    serializer_->getEmptyRootHash())
+                                .value();
+      }
+      for (const auto &entry : child_state.entries) {
+        std::ignore = child_batch.batch->put(entry.key, entry.value);
+        child_batch.unflushed_bytes += entry.key.size() + entry.value.size();
+        bytes += entry.key.size() + entry.value.size();
+      }
+
+      if (not child_state.complete) {
+        // Peer stops forming response at incomplete child state
+        if (not child_state.entries.empty()) {
+          child_key = child_state.entries.back().key;
+        } else {
+          child_key =
+              is_continuation ? request_start.back() : common::Buffer{};
+        }
+        if (child_batch.unflushed_bytes >= kStateSyncFlushThreshold) {
+          if (auto res = flushStateSyncBatch(child_batch); res.has_error()) {
+            failStateSync(res.error(), std::move(handler));
             return;
           }
+        }
+        break;
+      }
 
-          // State syncing has completed; Switch to the full syncing
-          self->sync_method_ = application::AppConfiguration::SyncMethod::Full;
-          // Forget saved data of incomplete state sync
-          auto res = self->buffer_storage_->remove(
-              storage::kBlockOfIncompleteSyncStateLookupKey);
-          if (res.has_error()) {
-            SL_WARN(self->log_,
-                    "Can't remove data of incomplete state sync: {}",
-                    res.error());
-          }
-          self->state_sync_request_.reset();
-          self->state_sync_on_block_.reset();
-          self->state_sync_request_in_progress_ = false;
-          if (handler) {
-            handler(block);
+      auto res = flushStateSyncBatch(child_batch);
+      if (res.has_error()) {
+        failStateSync(res.error(), std::move(handler));
+        return;
+      }
+      const auto &actual = res.value();
+      if (actual == child_state.state_root) {
+        SL_DEBUG(log_,
+                 "Syncing of child state on block {} has finished. "
+                 "Root hashes match: {}",
+                 block,
+                 actual);
+      } else {
+        SL_WARN(log_,
+                "Syncing of child state on block {} has finished. "
+                "Root hashes mismatch: expected={}, actual={}",
+                block,
+                child_state.state_root,
+                actual);
+      }
+      state_sync.child_batches.erase(child_state.state_root);
+    }
+
+    if (state_sync.main_batch.unflushed_bytes >= kStateSyncFlushThreshold) {
+      if (auto res = flushStateSyncBatch(state_sync.main_batch);
+          res.has_error()) {
+        failStateSync(res.error(), std::move(handler));
+        return;
+      }
+    }
+
+    bool range_complete =
+        out_of_range or (main_state.complete and not child_key.has_value());
+    if (bytes == 0 and not range_complete) {
+      state_sync.ranges.onFailed(index, peer_id);
+      peer_scoring_->onRequestFailed(peer_id, protocol_name);
+      SL_WARN(log_, "State syncing with {} makes no progress", peer_id);
+      if (handler) handler(Error::EMPTY_RESPONSE);
+      return;
+    }
+
+    std::vector<common::Buffer> start{std::move(parent_key)};
+    if (child_key.has_value()) {
+      start.emplace_back(std::move(child_key.value()));
+    }
+    auto now = StateSyncRanges::Clock::now();
+    state_sync.ranges.onLoaded(
+        index, peer_id, std::move(start), range_complete, now);
+    peer_scoring_->onResponse(
+        peer_id,
+        protocol_name,
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - requested),
+        bytes);
+
+    if (state_sync.ranges.complete()) {
+      finishStateSync(std::move(handler));
+      return;
+    }
+
+    SL_TRACE(log_,
+             "State syncing continues. {} entries loaded; "
+             "throughput of {} is {:.0f} B/s",
+             entries_,
+             peer_id,
+             peer_scoring_->throughput(peer_id, protocol_name).value_or(0.));
+
+    if (++state_sync.responses_since_saving >= kStateSyncSaveInterval) {
+      if (auto res = saveStateSyncProgress(); res.has_error()) {
+        failStateSync(res.error(), std::move(handler));
+        return;
+      }
+    }
+
+    if (range_complete) {
+      // Take next range
+      syncState(peer_id, block, std::move(handler));
+    } else {
+      requestStateRange(peer_id, index, std::move(handler));
+    }
+  }
+
+  outcome::result<storage::trie::RootHash>
+  SynchronizerImpl::flushStateSyncBatch(StateSyncBatch &sync_batch) {
+    auto res = sync_batch.batch->commit();
+    if (res.has_error()) {
+      SL_WARN(log_,
+              "Can't flush trie batch of state sync: {}",
+              res.error().message());
+      return res.as_failure();
+    }
+    sync_batch.unflushed_bytes = 0;
+    return res;
+  }
+
+  void SynchronizerImpl::failStateSync(const std::error_code &error,
+                                       SyncResultHandler &&handler) {
+    BOOST_ASSERT(state_sync_.has_value());
+    SL_ERROR(log_,
+             "Syncing of state on block {} has failed: {}",
+             state_sync_->block,
+             error.message());
+    // Not flushed data is lost, so sync of state is started over by next
+    // attempt. Saved progress, which is consistent, is used after restart
+    state_sync_.reset();
+    if (handler) {
+      handler(outcome::failure(error));
+    }
+  }
+
+  outcome::result<void> SynchronizerImpl::saveStateSyncProgress() {
+    BOOST_ASSERT(state_sync_.has_value());
+    auto &state_sync = state_sync_.value();
+    state_sync.responses_since_saving = 0;
+
+    OUTCOME_TRY(root, flushStateSyncBatch(state_sync.main_batch));
+
+    StateSyncProgress progress{
+        state_sync.block, root, state_sync.ranges.ranges()};
+    auto res = buffer_storage_->put(
+        storage::kBlockOfIncompleteSyncStateLookupKey,
+        common::Buffer(scale::encode(progress).value()));
+    if (res.has_error()) {
+      // Sync still can go on, it'd be continued from older progress only
+      SL_WARN(
+          log_, "Can't save data of incomplete state sync: {}", res.error());
+    }
+    return outcome::success();
+  }
+
+  void SynchronizerImpl::finishStateSync(SyncResultHandler &&handler) {
+    BOOST_ASSERT(state_sync_.has_value());
+    auto &state_sync = state_sync_.value();
+    const auto block = state_sync.block;
+
+    auto res = flushStateSyncBatch(state_sync.main_batch);
+    if (res.has_error()) {
+      failStateSync(res.error(), std::move(handler));
+      return;
+    }
+
+    auto header_res = block_tree_->getBlockHeader(block.hash);
+    BOOST_ASSERT_MSG(header_res.has_value(),
+                     "It is state of existing block; head must be existing");
+    const auto &expected = header_res.value().state_root;
+    const auto &actual = res.value();
+
+    if (actual == expected) {
+      SL_INFO(log_,
+              "Syncing of state on block {} has finished. "
+              "Root hashes match: {}",
+              block,
+              actual);
+    } else {
+      SL_WARN(log_,
+              "Syncing of state on block {} has finished. "
+              "Root hashes mismatch: expected={}, actual={}",
+              block,
+              expected,
+              actual);
+    }
+
+    // Changes of loaded state are not tracked, but runtime code is reported
+    // as set at the block, so that runtime upgrade there is known
+    trie_changes_tracker_->onBlockExecutionStart(block.hash);
+    if (auto code = state_sync.main_batch.batch->get(storage::kRuntimeCodeKey);
+        code.has_value()) {
+      trie_changes_tracker_->onPut(
+          storage::kRuntimeCodeKey, code.value().get(), false);
+    }
+    trie_changes_tracker_->onBlockAdded(block.hash);
+
+    // Block proven by warp sync has no ancestry, so its epochs were unknown
+    // until now; reload them from the synced state
+    const auto &header = header_res.value();
+    auto has_parent_res = block_tree_->hasBlockHeader(header.parent_hash);
+    if (block.number != 0 and has_parent_res.has_value()
+        and not has_parent_res.value()) {
+      auto justification_res = block_tree_->getBlockJustification(block.hash);
+      if (justification_res.has_value()) {
+        auto reset_res =
+            block_tree_->resetToFinalized(header, justification_res.value());
+        if (reset_res.has_error()) {
+          SL_WARN(log_,
+                  "Can't load epochs of block {} from synced state: {}",
+                  block,
+                  reset_res.error());
+        }
+      }
+    }
+
+    // State syncing has completed; Switch to the full syncing
+    sync_method_ = application::AppConfiguration::SyncMethod::Full;
+    // Forget saved data of incomplete state sync
+    auto remove_res =
+        buffer_storage_->remove(storage::kBlockOfIncompleteSyncStateLookupKey);
+    if (remove_res.has_error()) {
+      SL_WARN(log_,
+              "Can't remove data of incomplete state sync: {}",
+              remove_res.error());
+    }
+    state_sync_.reset();
+    if (handler) {
+      handler(block);
+    }
+  }
+
+  void SynchronizerImpl::syncWarp(const libp2p::peer::PeerId &peer_id,
+                                  SyncResultHandler &&handler) {
+    if (not warp_proof_.has_value()) {
+      primitives::BlockInfo genesis{0, block_tree_->getGenesisBlockHash()};
+      auto authorities = authority_manager_->authorities(
+          genesis, authority::IsBlockFinalized{true});
+      if (not authorities.has_value()) {
+        SL_WARN(log_,
+                "Warp sync can't be started: "
+                "authority set of genesis block is unknown");
+        if (handler) handler(Error::NO_AUTHORITIES);
+        return;
+      }
+      warp_proof_.emplace(
+          ed25519_provider_, hasher_, genesis, *authorities.value());
+    }
+
+    if (warp_proof_->finished()) {
+      if (handler) handler(warp_proof_->block());
+      return;
+    }
+
+    if (warp_proof_requested_) {
+      SL_TRACE(log_,
+               "Warp proof was not requested from {}: "
+               "other request is in progress",
+               peer_id);
+      return;
+    }
+    warp_proof_requested_ = true;
+
+    SL_DEBUG(log_,
+             "Request warp proof from {} after block {}",
+             peer_id,
+             warp_proof_->block());
+
+    router_->getWarpProtocol()->request(
+        peer_id,
+        WarpRequest{warp_proof_->block().hash},
+        [wp = weak_from_this(), peer_id, handler = std::move(handler)](
+            auto &&proof_res) mutable {
+          if (auto self = wp.lock()) {
+            self->onWarpProof(
+                peer_id, std::move(proof_res), std::move(handler));
           }
-        };
+        });
+  }
 
-    protocol->request(peer_id, std::move(request), std::move(response_handler));
+  void SynchronizerImpl::onWarpProof(const libp2p::peer::PeerId &peer_id,
+                                     outcome::result<WarpSyncProof> proof_res,
+                                     SyncResultHandler &&handler) {
+    warp_proof_requested_ = false;
+
+    if (proof_res.has_error()) {
+      SL_WARN(log_,
+              "Can't load warp proof from {}: {}",
+              peer_id,
+              proof_res.error().message());
+      if (handler) handler(proof_res.as_failure());
+      return;
+    }
+
+    auto verify_res = warp_proof_->verify(proof_res.value());
+    if (verify_res.has_error()) {
+      SL_WARN(log_,
+              "Warp proof from {} is rejected: {}",
+              peer_id,
+              verify_res.error().message());
+      peer_rating_repository_->downvote(peer_id);
+      if (handler) handler(verify_res.as_failure());
+      return;
+    }
+
+    SL_INFO(log_,
+            "Warp proof is verified up to block {}; authority set #{}",
+            warp_proof_->block(),
+            warp_proof_->authorities().id);
+
+    if (not warp_proof_->finished()) {
+      syncWarp(peer_id, std::move(handler));
+      return;
+    }
+
+    SL_INFO(log_, "Warp proof is complete on block {}", warp_proof_->block());
+    if (auto res = applyWarpProof(); res.has_error()) {
+      SL_WARN(log_,
+              "Block {} proven by warp sync can't be finalized: {}",
+              warp_proof_->block(),
+              res.error().message());
+      warp_proof_.reset();
+      if (handler) handler(res.as_failure());
+      return;
+    }
+    if (handler) handler(warp_proof_->block());
+  }
+
+  outcome::result<void> SynchronizerImpl::applyWarpProof() {
+    BOOST_ASSERT(warp_proof_.has_value() and warp_proof_->finished());
+    const auto &header = warp_proof_->header();
+    if (not header.has_value()) {
+      // Nothing is proven after the last finalized block
+      return outcome::success();
+    }
+    OUTCOME_TRY(block_tree_->resetToFinalized(
+        header.value(), warp_proof_->justification().value()));
+    OUTCOME_TRY(authority_manager_->warp(warp_proof_->block(),
+                                         warp_proof_->authorities()));
+    return outcome::success();
   }
 
   void SynchronizerImpl::applyNextBlock() {
@@ -1182,7 +1879,7 @@ namespace kagome::network {
 
         } else {
           // Fast syncing
-          if (not state_sync_request_.has_value()) {
+          if (not state_sync_.has_value()) {
             // Headers loading
             applying_res = block_appender_->appendBlock(std::move(block));
 
@@ -1232,7 +1929,9 @@ namespace kagome::network {
             ? kMinPreloadedBlockAmount
             : kMinPreloadedBlockAmountForFastSyncing;
 
-    if (known_blocks_.size() < minPreloadedBlockAmount) {
+    if (block_download_.has_value()) {
+      requestBlockSegments();
+    } else if (known_blocks_.size() < minPreloadedBlockAmount) {
       SL_TRACE(log_,
                "{} blocks in queue: ask next portion of block",
                known_blocks_.size());
@@ -16,10 +16,18 @@
 
 #include "application/app_state_manager.hpp"
 #include "consensus/babe/block_appender.hpp"
+#include "consensus/authority/authority_manager.hpp"
 #include "consensus/babe/block_executor.hpp"
+#include "crypto/ed25519_provider.hpp"
 #include "metrics/metrics.hpp"
+#include "network/impl/block_download_scheduler.hpp"
+#include "network/impl/state_sync_ranges.hpp"
+#include "network/impl/warp_proof_verifier.hpp"
+#include "network/peer_scoring.hpp"
+#include "network/rating_repository.hpp"
 #include "network/router.hpp"
 #include "storage/buffer_map_types.hpp"
+#include "storage/trie/types.hpp"
 #include "telemetry/service.hpp"
 
 namespace kagome::application {
@@ -61,6 +69,26 @@ namespace kagome::network {
     static constexpr std::chrono::milliseconds kRecentnessDuration =
         std::chrono::seconds(60);
 
+    /// Amount of key ranges of state, which are loaded concurrently from
+    /// different peers during state syncing
+    static constexpr size_t kStateSyncRangesNumber = 16;
+
+    /// Amount of state responses, after which progress of state syncing is
+    /// saved to be continued after restart
+    static constexpr size_t kStateSyncSaveInterval = 64;
+
+    /// Amount of bytes of state put into a trie batch, after which its nodes
+    /// are flushed to storage
+    static constexpr size_t kStateSyncFlushThreshold = 32 * 1024 * 1024;
+
+    /// Amount of blocks in a segment, which is loaded from one peer during
+    /// parallel download. It is max amount of blocks in BlocksResponse
+    static constexpr uint32_t kBlockDownloadSegmentSize = 128;
+
+    /// Amount of segments, which might be loaded simultaneously ahead of the
+    /// first not loaded block. Also limits the queue of loaded blocks
+    static constexpr size_t kBlockDownloadWindow = 16;
+
     enum class Error {
       SHUTTING_DOWN = 1,
       EMPTY_RESPONSE,
@@ -73,6 +101,8 @@ namespace kagome::network {
       PEER_BUSY,
       ARRIVED_TOO_EARLY,
       DUPLICATE_REQUEST,
+      NO_SUITABLE_PEER,
+      NO_AUTHORITIES,
     };
 
     SynchronizerImpl(
@@ -87,7 +117,11 @@ namespace kagome::network {
         std::shared_ptr<network::Router> router,
         std::shared_ptr<libp2p::basic::Scheduler> scheduler,
         std::shared_ptr<crypto::Hasher> hasher,
-        std::shared_ptr<storage::BufferStorage> buffer_storage);
+        std::shared_ptr<storage::BufferStorage> buffer_storage,
+        std::shared_ptr<PeerRatingRepository> peer_rating_repository,
+        std::shared_ptr<PeerScoring> peer_scoring,
+        std::shared_ptr<authority::AuthorityManager> authority_manager,
+        std::shared_ptr<crypto::Ed25519Provider> ed25519_provider);
 
     /** @see AppStateManager::takeControl */
     bool prepare();
@@ -123,7 +157,9 @@ namespace kagome::network {
                                    SyncResultHandler &&handler) override;
 
     /// Enqueues loading and applying state on block {@param block}
-    /// from peer {@param peer_id}.
+    /// from peer {@param peer_id}. Key space of state is split into ranges;
+    /// each call assigns one of not loaded ranges to the peer, so state is
+    /// loaded concurrently from all peers the method is called for.
     /// If finished, {@param handler} be called
     void syncState(const libp2p::peer::PeerId &peer_id,
                    const primitives::BlockInfo &block,
@@ -161,9 +197,12 @@ namespace kagome::network {
 
     /// Check if incomplete requests of state sync exists
     bool hasIncompleteRequestOfStateSync() const override {
-      return state_sync_request_.has_value();
+      return state_sync_.has_value() or state_sync_progress_.has_value();
     }
 
+    void syncWarp(const libp2p::peer::PeerId &peer_id,
+                  SyncResultHandler &&handler) override;
+
    private:
     /// Subscribes handler for block with provided {@param block_info}
     /// {@param handler} will be called When block is received or discarded
@@ -178,6 +217,39 @@ namespace kagome::network {
     /// Tries to request another portion of block
     void askNextPortionOfBlocks();
 
+    /// Starts parallel download of blocks above common block {@param common}
+    /// up to {@param target}, or joins peer {@param peer_id} to the running
+    /// one. {@param handler} will be called when download is finished or
+    /// failed
+    void startBlockDownload(const libp2p::peer::PeerId &peer_id,
+                            const primitives::BlockInfo &common,
+                            const primitives::BlockInfo &target,
+                            SyncResultHandler &&handler);
+
+    /// Adds peer {@param peer_id}, having block {@param target}, to running
+    /// parallel download of blocks
+    void joinBlockDownload(const libp2p::peer::PeerId &peer_id,
+                           const primitives::BlockInfo &target,
+                           SyncResultHandler &&handler);
+
+    /// Requests segments of blocks from idle peers of parallel download;
+    /// the fastest peers get the most urgent segments
+    void requestBlockSegments();
+
+    /// Requests segment {@param segment} of blocks from peer {@param peer_id}
+    void requestBlockSegment(const libp2p::peer::PeerId &peer_id,
+                             const BlockDownloadScheduler::Segment &segment);
+
+    /// Stores received segment of blocks and enqueues blocks linked to the
+    /// queue
+    void onBlockSegment(const libp2p::peer::PeerId &peer_id,
+                        const BlockDownloadScheduler::Segment &segment,
+                        BlockDownloadScheduler::Clock::time_point requested,
+                        outcome::result<BlocksResponse> response_res);
+
+    /// Finishes parallel download and calls its handlers with {@param res}
+    void finishBlockDownload(outcome::result<primitives::BlockInfo> res);
+
     /// Pops next block from queue and tries to apply that
     void applyNextBlock();
 
@@ -192,6 +264,52 @@ namespace kagome::network {
     /// side-branch for provided finalized block {@param finalized_block}
     void prune(const primitives::BlockInfo &finalized_block);
 
+    /// Starts new state sync on block {@param block}, or continues saved one
+    outcome::result<void> startStateSync(const primitives::BlockInfo &block);
+
+    /// Requests next portion of range {@param index} of state from peer
+    /// {@param peer_id}
+    void requestStateRange(const libp2p::peer::PeerId &peer_id,
+                           StateSyncRanges::RangeIndex index,
+                           SyncResultHandler &&handler);
+
+    /// Stores received portion of range {@param index} of state
+    void onStateResponse(const libp2p::peer::PeerId &peer_id,
+                         StateSyncRanges::RangeIndex index,
+                         StateSyncRanges::RequestId request_id,
+                         const std::vector<common::Buffer> &request_start,
+                         StateSyncRanges::Clock::time_point requested,
+                         outcome::result<StateResponse> response_res,
+                         SyncResultHandler &&handler);
+
+    struct StateSyncBatch;
+
+    /// Flushes nodes of trie batch {@param sync_batch} to storage
+    /// @returns root of flushed trie
+    outcome::result<storage::trie::RootHash> flushStateSyncBatch(
+        StateSyncBatch &sync_batch);
+
+    /// Saves progress of state sync to continue it after restart
+    /// @returns error if loaded data can't be flushed
+    outcome::result<void> saveStateSyncProgress();
+
+    /// Stops state sync, which can't go on due to {@param error}
+    void failStateSync(const std::error_code &error,
+                       SyncResultHandler &&handler);
+
+    /// Checks loaded state and switches to full syncing
+    void finishStateSync(SyncResultHandler &&handler);
+
+    /// Verifies warp proof {@param proof_res} received from {@param peer_id}
+    /// and requests its continuation, if any
+    void onWarpProof(const libp2p::peer::PeerId &peer_id,
+                     outcome::result<WarpSyncProof> proof_res,
+                     SyncResultHandler &&handler);
+
+    /// Makes block proven by complete warp proof the last finalized one,
+    /// with authority set of the proof, so that its state is synced next
+    outcome::result<void> applyWarpProof();
+
     /// Purges internal cache of recent requests for specified {@param peer_id}
     /// and {@param fingerprint} after kRecentnessDuration timeout
     void scheduleRecentRequestRemoval(
@@ -210,6 +328,10 @@ namespace kagome::network {
     std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
     std::shared_ptr<crypto::Hasher> hasher_;
     std::shared_ptr<storage::BufferStorage> buffer_storage_;
+    std::shared_ptr<PeerRatingRepository> peer_rating_repository_;
+    std::shared_ptr<PeerScoring> peer_scoring_;
+    std::shared_ptr<authority::AuthorityManager> authority_manager_;
+    std::shared_ptr<crypto::Ed25519Provider> ed25519_provider_;
 
     application::AppConfiguration::SyncMethod sync_method_;
 
@@ -220,9 +342,49 @@ namespace kagome::network {
     log::Logger log_ = log::createLogger("Synchronizer", "synchronizer");
     telemetry::Telemetry telemetry_ = telemetry::createTelemetryService();
 
-    std::atomic_bool state_sync_request_in_progress_ = false;
-    std::optional<network::StateRequest> state_sync_request_;
-    std::optional<primitives::BlockInfo> state_sync_on_block_;
+    /// Progress of state sync, which is saved to continue it after restart
+    struct StateSyncProgress {
+      SCALE_TIE(3);
+
+      primitives::BlockInfo block;
+      /// Root of partially loaded main state
+      storage::trie::RootHash state_root;
+      std::vector<StateSyncRanges::Range> ranges;
+    };
+
+    /// Trie batch filled by state sync. Written nodes are replaced by their
+    /// hashes in memory, so after flush only paths to the next inserted keys
+    /// are loaded back, and memory doesn't grow with size of state
+    struct StateSyncBatch {
+      std::shared_ptr<storage::trie::PersistentTrieBatch> batch;
+      size_t unflushed_bytes = 0;
+    };
+
+    struct StateSync {
+      primitives::BlockInfo block;
+      StateSyncRanges ranges;
+      /// Batch of main state, shared by all ranges
+      StateSyncBatch main_batch;
+      /// Batches of child states, which are not loaded completely yet
+      std::unordered_map<storage::trie::RootHash, StateSyncBatch>
+          child_batches;
+      size_t responses_since_saving = 0;
+    };
+
+    std::optional<StateSync> state_sync_;
+    std::optional<StateSyncProgress> state_sync_progress_;
+
+    struct BlockDownload {
+      BlockDownloadScheduler scheduler;
+      /// Handlers of peers taking part in download
+      std::unordered_map<libp2p::peer::PeerId, SyncResultHandler> handlers;
+    };
+
+    std::optional<BlockDownload> block_download_;
+
+    /// Verified part of warp proof
+    std::optional<WarpProofVerifier> warp_proof_;
+    bool warp_proof_requested_ = false;
 
     bool node_is_shutting_down_ = false;
 
@@ -267,12 +429,6 @@ namespace kagome::network {
     std::set<std::tuple<libp2p::peer::PeerId, BlocksRequest::Fingerprint>>
         recent_requests_;
 
-    std::unordered_map<
-        storage::trie::RootHash,
-        std::tuple<common::Buffer,
-                   unsigned,
-                   std::shared_ptr<storage::trie::PersistentTrieBatch>>>
-        batches_store_;
     size_t entries_{0};
   };
 
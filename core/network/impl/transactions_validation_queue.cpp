@@ -0,0 +1,298 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/transactions_validation_queue.hpp"
+
+#include <algorithm>
+
+#include <boost/asio/post.hpp>
+#include <fmt/format.h>
+#include <soralog/util.hpp>
+
+#include "primitives/transaction_validity.hpp"
+#include "transaction_pool/transaction_pool_error.hpp"
+
+namespace {
+  constexpr const char *kDuplicateTxs = "kagome_network_duplicate_txs";
+  constexpr const char *kRateLimitedTxs = "kagome_network_rate_limited_txs";
+  constexpr const char *kTxsValidationQueueSize =
+      "kagome_network_txs_validation_queue_size";
+
+  /**
+   * @return true if transaction is rejected as invalid, so it is pointless to
+   * validate it again; false if rejection may be transient (e.g. pool is full,
+   * transaction is from the future or state is not available)
+   */
+  bool isInvalid(const std::error_code &error) {
+    using kagome::primitives::InvalidTransaction;
+    return error.category()
+               == make_error_code(InvalidTransaction::Call).category()
+       and error != make_error_code(InvalidTransaction::Future)
+       and error != make_error_code(InvalidTransaction::ExhaustsResources);
+  }
+}  // namespace
+
+namespace kagome::network {
+
+  namespace detail {
+
+    RecentHashes::RecentHashes(size_t capacity) : capacity_{capacity} {
+      BOOST_ASSERT(capacity_ > 0);
+    }
+
+    bool RecentHashes::contains(const common::Hash256 &hash) const {
+      return hashes_.count(hash) != 0;
+    }
+
+    void RecentHashes::add(const common::Hash256 &hash) {
+      if (not hashes_.emplace(hash).second) {
+        return;
+      }
+      order_.emplace_back(hash);
+      if (order_.size() > capacity_) {
+        hashes_.erase(order_.front());
+        order_.pop_front();
+      }
+    }
+
+  }  // namespace detail
+
+  TransactionsValidationQueue::TransactionsValidationQueue(
+      std::shared_ptr<ExtrinsicObserver> extrinsic_observer,
+      std::shared_ptr<crypto::Hasher> hasher,
+      std::shared_ptr<boost::asio::io_context> main_context,
+      Config config)
+      : config_{config},
+        extrinsic_observer_{std::move(extrinsic_observer)},
+        hasher_{std::move(hasher)},
+        main_context_{std::move(main_context)},
+        accepted_{config_.known_capacity},
+        rejected_{config_.known_capacity},
+        log_{log::createLogger("TransactionsValidationQueue", "network")} {
+    BOOST_ASSERT(extrinsic_observer_ != nullptr);
+    BOOST_ASSERT(hasher_ != nullptr);
+    BOOST_ASSERT(main_context_ != nullptr);
+    BOOST_ASSERT(config_.threads > 0);
+    BOOST_ASSERT(config_.batch_size > 0);
+
+    // Register metrics
+    metrics_registry_->registerCounterFamily(
+        kDuplicateTxs,
+        "Number of received transactions dropped as already known");
+    metric_duplicates_ =
+        metrics_registry_->registerCounterMetric(kDuplicateTxs);
+    metrics_registry_->registerCounterFamily(
+        kRateLimitedTxs,
+        "Number of received transactions dropped by rate limit of peer");
+    metric_rate_limited_ =
+        metrics_registry_->registerCounterMetric(kRateLimitedTxs);
+    metrics_registry_->registerGaugeFamily(
+        kTxsValidationQueueSize,
+        "Number of received transactions waiting for validation");
+    metric_queue_size_ =
+        metrics_registry_->registerGaugeMetric(kTxsValidationQueueSize);
+    metric_queue_size_->set(0);
+  }
+
+  TransactionsValidationQueue::~TransactionsValidationQueue() {
+    stop();
+  }
+
+  void TransactionsValidationQueue::start() {
+    if (not threads_.empty()) {
+      return;
+    }
+    {
+      std::lock_guard lock{mutex_};
+      io_context_ = std::make_shared<boost::asio::io_context>();
+      work_guard_.emplace(io_context_->get_executor());
+    }
+    threads_.reserve(config_.threads);
+    for (size_t i = 0; i < config_.threads; ++i) {
+      threads_.emplace_back([io_context{io_context_}, number{i + 1}] {
+        soralog::util::setThreadName(fmt::format("txs.{}", number));
+        io_context->run();
+      });
+    }
+  }
+
+  void TransactionsValidationQueue::stop() {
+    if (threads_.empty()) {
+      return;
+    }
+    {
+      std::lock_guard lock{mutex_};
+      work_guard_.reset();
+      io_context_->stop();
+    }
+    for (auto &thread : threads_) {
+      if (thread.get_id() == std::this_thread::get_id()) {
+        // Last reference might be released by a worker itself
+        thread.detach();
+      } else {
+        thread.join();
+      }
+    }
+    threads_.clear();
+
+    std::lock_guard lock{mutex_};
+    queue_.clear();
+    pending_.clear();
+    jobs_ = 0;
+    metric_queue_size_->set(0);
+  }
+
+  bool TransactionsValidationQueue::push(const libp2p::peer::PeerId &peer_id,
+                                         primitives::Extrinsic extrinsic) {
+    auto hash = hasher_->blake2b_256(extrinsic.data);
+    auto now = Clock::now();
+
+    std::lock_guard lock{mutex_};
+    if (pending_.count(hash) != 0 or accepted_.contains(hash)
+        or rejected_.contains(hash)) {
+      SL_TRACE(log_, "Tx {} from {} is already known", hash, peer_id);
+      metric_duplicates_->inc();
+      return false;
+    }
+    if (not takePeerToken(peer_id, now)) {
+      SL_TRACE(log_, "Tx {} from {} is over rate limit", hash, peer_id);
+      metric_rate_limited_->inc();
+      return false;
+    }
+    if (queue_.size() >= config_.capacity) {
+      SL_DEBUG(log_, "Tx {} from {} is dropped: queue is full", hash, peer_id);
+      return false;
+    }
+
+    pending_.emplace(hash);
+    queue_.emplace_back(Queued{hash, std::move(extrinsic)});
+    metric_queue_size_->set(queue_.size());
+    scheduleJobs();
+    return true;
+  }
+
+  bool TransactionsValidationQueue::takePeerToken(
+      const libp2p::peer::PeerId &peer_id, Clock::time_point now) {
+    if (peers_.size() >= kMaxTrackedPeers and config_.peer_rate > 0) {
+      // Forget peers whose buckets are refilled anyway
+      auto refill = std::chrono::duration<double>(config_.peer_burst
+                                                  / config_.peer_rate);
+      for (auto it = peers_.begin(); it != peers_.end();) {
+        if (now - it->second.updated > refill) {
+          it = peers_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+
+    auto [it, inserted] =
+        peers_.emplace(peer_id, PeerBucket{config_.peer_burst, now});
+    auto &bucket = it->second;
+    if (not inserted) {
+      auto elapsed = std::chrono::duration<double>(now - bucket.updated);
+      bucket.tokens =
+          std::min(config_.peer_burst,
+                   bucket.tokens + elapsed.count() * config_.peer_rate);
+      bucket.updated = now;
+    }
+    if (bucket.tokens < 1) {
+      return false;
+    }
+    bucket.tokens -= 1;
+    return true;
+  }
+
+  void TransactionsValidationQueue::scheduleJobs() {
+    if (not work_guard_.has_value()) {
+      return;
+    }
+    while (jobs_ < config_.threads
+           and jobs_ * config_.batch_size < queue_.size()) {
+      ++jobs_;
+      boost::asio::post(*io_context_, [wp{weak_from_this()}] {
+        if (auto self = wp.lock()) {
+          self->validateBatch();
+        }
+      });
+    }
+  }
+
+  void TransactionsValidationQueue::validateBatch() {
+    std::vector<Queued> batch;
+    {
+      std::lock_guard lock{mutex_};
+      auto size = std::min(config_.batch_size, queue_.size());
+      batch.reserve(size);
+      std::move(queue_.begin(),
+                queue_.begin() + size,
+                std::back_inserter(batch));
+      queue_.erase(queue_.begin(), queue_.begin() + size);
+      metric_queue_size_->set(queue_.size());
+    }
+
+    std::vector<outcome::result<primitives::Transaction>> validated;
+    validated.reserve(batch.size());
+    for (auto &queued : batch) {
+      validated.emplace_back(
+          extrinsic_observer_->validateTx(queued.extrinsic));
+    }
+
+    boost::asio::post(*main_context_,
+                      [wp{weak_from_this()},
+                       batch{std::move(batch)},
+                       validated{std::move(validated)}]() mutable {
+                        if (auto self = wp.lock()) {
+                          self->submitBatch(std::move(batch),
+                                            std::move(validated));
+                        }
+                      });
+
+    std::lock_guard lock{mutex_};
+    --jobs_;
+    scheduleJobs();
+  }
+
+  void TransactionsValidationQueue::submitBatch(
+      std::vector<Queued> batch,
+      std::vector<outcome::result<primitives::Transaction>> validated) {
+    enum class Verdict { ACCEPTED, INVALID, RETRY };
+    std::vector<Verdict> verdicts;
+    verdicts.reserve(batch.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+      auto result = validated[i].has_value()
+                      ? extrinsic_observer_->submitTx(
+                          std::move(validated[i].value()))
+                      : outcome::result<common::Hash256>{validated[i].error()};
+      if (result.has_value()) {
+        SL_DEBUG(log_, "Received tx {}", result.value());
+        verdicts.push_back(Verdict::ACCEPTED);
+      } else if (result
+                 == outcome::failure(transaction_pool::TransactionPoolError::
+                                         TX_ALREADY_IMPORTED)) {
+        verdicts.push_back(Verdict::ACCEPTED);
+      } else {
+        SL_DEBUG(log_,
+                 "Rejected tx {}: {}",
+                 batch[i].hash,
+                 result.error().message());
+        verdicts.push_back(isInvalid(result.error()) ? Verdict::INVALID
+                                                     : Verdict::RETRY);
+      }
+    }
+
+    std::lock_guard lock{mutex_};
+    for (size_t i = 0; i < batch.size(); ++i) {
+      auto &hash = batch[i].hash;
+      pending_.erase(hash);
+      if (verdicts[i] == Verdict::ACCEPTED) {
+        accepted_.add(hash);
+      } else if (verdicts[i] == Verdict::INVALID) {
+        rejected_.add(hash);
+      }
+    }
+  }
+
+}  // namespace kagome::network
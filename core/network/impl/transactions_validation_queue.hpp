@@ -0,0 +1,168 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_TRANSACTIONSVALIDATIONQUEUE
+#define KAGOME_NETWORK_TRANSACTIONSVALIDATIONQUEUE
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <libp2p/peer/peer_id.hpp>
+
+#include "crypto/hasher.hpp"
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "network/extrinsic_observer.hpp"
+#include "primitives/extrinsic.hpp"
+#include "primitives/transaction.hpp"
+
+namespace kagome::network {
+
+  namespace detail {
+
+    /**
+     * Set of the most recently added hashes. When capacity is exceeded, the
+     * oldest hash is forgotten.
+     */
+    class RecentHashes {
+     public:
+      explicit RecentHashes(size_t capacity);
+
+      bool contains(const common::Hash256 &hash) const;
+
+      void add(const common::Hash256 &hash);
+
+     private:
+      const size_t capacity_;
+      std::unordered_set<common::Hash256> hashes_;
+      std::deque<common::Hash256> order_;
+    };
+
+  }  // namespace detail
+
+  /**
+   * Validates transactions received from peers on own worker threads, so
+   * network thread is never blocked by runtime calls. Validated transactions
+   * are submitted into the pool on the main context, as pool is mutated only
+   * there.
+   *
+   * Transaction is dropped without validation if the same one is already
+   * queued, was recently accepted (i.e. is known to the pool) or was recently
+   * found invalid, or if the peer sends transactions faster than allowed.
+   * Transactions rejected for a transient reason (e.g. pool is full or
+   * transaction is from the future) are not remembered, so may be received
+   * again. Queued transactions are validated in batches.
+   */
+  class TransactionsValidationQueue final
+      : public std::enable_shared_from_this<TransactionsValidationQueue> {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Amount of peers, after which idle peers are forgotten by rate limiter
+    static constexpr size_t kMaxTrackedPeers = 1024;
+
+    struct Config {
+      /// Number of worker threads
+      size_t threads = 2;
+      /// Max amount of transactions validated by one job of a worker
+      size_t batch_size = 64;
+      /// Max amount of queued transactions, newer ones are dropped
+      size_t capacity = 8192;
+      /// Amount of remembered accepted and rejected transactions hashes
+      size_t known_capacity = 16384;
+      /// Transactions per second allowed to be received from a peer
+      double peer_rate = 64;
+      /// Transactions allowed to be received from a peer at once
+      double peer_burst = 512;
+    };
+
+    TransactionsValidationQueue(
+        std::shared_ptr<ExtrinsicObserver> extrinsic_observer,
+        std::shared_ptr<crypto::Hasher> hasher,
+        std::shared_ptr<boost::asio::io_context> main_context,
+        Config config);
+
+    ~TransactionsValidationQueue();
+
+    /// Launches worker threads
+    void start();
+
+    /// Stops worker threads; queued transactions are discarded
+    void stop();
+
+    /**
+     * Queues transaction for validation. Never blocks on validation.
+     * @return false if transaction was dropped
+     */
+    bool push(const libp2p::peer::PeerId &peer_id,
+              primitives::Extrinsic extrinsic);
+
+   private:
+    struct Queued {
+      common::Hash256 hash;
+      primitives::Extrinsic extrinsic;
+    };
+
+    struct PeerBucket {
+      double tokens;
+      Clock::time_point updated;
+    };
+
+    /// @return true if the peer may send one more transaction
+    bool takePeerToken(const libp2p::peer::PeerId &peer_id,
+                       Clock::time_point now);
+
+    /// Posts validation jobs for idle workers. Must be called under mutex
+    void scheduleJobs();
+
+    /// Validates a batch of queued transactions
+    void validateBatch();
+
+    /// Submits validated batch into the pool. Called on the main context
+    void submitBatch(
+        std::vector<Queued> batch,
+        std::vector<outcome::result<primitives::Transaction>> validated);
+
+    const Config config_;
+    std::shared_ptr<ExtrinsicObserver> extrinsic_observer_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+    std::shared_ptr<boost::asio::io_context> main_context_;
+
+    std::shared_ptr<boost::asio::io_context> io_context_;
+    using WorkGuard = boost::asio::executor_work_guard<
+        boost::asio::io_context::executor_type>;
+    std::optional<WorkGuard> work_guard_;
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+    std::deque<Queued> queue_;
+    /// Hashes of queued, being validated and being submitted transactions
+    std::unordered_set<common::Hash256> pending_;
+    detail::RecentHashes accepted_;
+    detail::RecentHashes rejected_;
+    std::unordered_map<libp2p::peer::PeerId, PeerBucket> peers_;
+    size_t jobs_ = 0;
+
+    log::Logger log_;
+
+    // Metrics
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Counter *metric_duplicates_;
+    metrics::Counter *metric_rate_limited_;
+    metrics::Gauge *metric_queue_size_;
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_TRANSACTIONSVALIDATIONQUEUE
@@ -0,0 +1,191 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/warp_proof_verifier.hpp"
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/assert.hpp>
+
+#include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
+#include "consensus/grandpa/voter_set.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::network, WarpProofVerifier::Error, e) {
+  using E = kagome::network::WarpProofVerifier::Error;
+  switch (e) {
+    case E::EMPTY_PROOF:
+      return "Warp proof is empty";
+    case E::WRONG_ORDER:
+      return "Fragments of warp proof are not ascending";
+    case E::JUSTIFIED_OTHER_BLOCK:
+      return "Justification of warp proof fragment is for other block";
+    case E::NO_AUTHORITY_SET_CHANGE:
+      return "Warp proof fragment doesn't change authority set";
+    case E::FORCED_CHANGE:
+      return "Warp proof contains forced change of authority set, which "
+             "can't be verified by warp sync";
+    case E::INVALID_SIGNATURE:
+      return "Precommit of warp proof justification has invalid signature";
+    case E::UNKNOWN_VOTER:
+      return "Precommit of warp proof justification is signed by unknown "
+             "voter";
+    case E::REDUNDANT_EQUIVOCATION:
+      return "Warp proof justification has third precommit of equivocator";
+    case E::NOT_ENOUGH_WEIGHT:
+      return "Warp proof justification does not have super-majority";
+  }
+  return "unknown error";
+}
+
+namespace kagome::network {
+
+  WarpProofVerifier::WarpProofVerifier(
+      std::shared_ptr<crypto::Ed25519Provider> ed25519_provider,
+      std::shared_ptr<crypto::Hasher> hasher,
+      const primitives::BlockInfo &begin,
+      primitives::AuthoritySet authorities)
+      : ed25519_provider_{std::move(ed25519_provider)},
+        hasher_{std::move(hasher)},
+        block_{begin},
+        authorities_{std::move(authorities)} {
+    BOOST_ASSERT(ed25519_provider_ != nullptr);
+    BOOST_ASSERT(hasher_ != nullptr);
+  }
+
+  outcome::result<void> WarpProofVerifier::verify(const WarpSyncProof &proof) {
+    if (proof.proofs.empty()) {
+      return Error::EMPTY_PROOF;
+    }
+
+    for (auto &fragment : proof.proofs) {
+      const auto &header = fragment.header;
+      if (header.number <= block_.number) {
+        return Error::WRONG_ORDER;
+      }
+      primitives::BlockInfo block{
+          header.number, hasher_->blake2b_256(scale::encode(header).value())};
+      if (fragment.justification.block_info != block) {
+        return Error::JUSTIFIED_OTHER_BLOCK;
+      }
+
+      for (const auto &ancestry : fragment.votes_ancestries) {
+        OUTCOME_TRY(forced, hasForcedChange(ancestry));
+        if (forced) {
+          return Error::FORCED_CHANGE;
+        }
+      }
+      OUTCOME_TRY(forced, hasForcedChange(header));
+      if (forced) {
+        return Error::FORCED_CHANGE;
+      }
+
+      OUTCOME_TRY(verifyJustification(fragment.justification,
+                                      fragment.votes_ancestries));
+
+      // Only the last fragment of complete proof might not change authority
+      // set, as it justifies the latest finalized block
+      OUTCOME_TRY(change, scheduledChangeOf(header));
+      auto is_last = &fragment == &proof.proofs.back();
+      if (not change.has_value() and not(is_last and proof.is_finished)) {
+        return Error::NO_AUTHORITY_SET_CHANGE;
+      }
+
+      block_ = block;
+      header_ = header;
+      justification_.emplace().data.put(
+          scale::encode(fragment.justification).value());
+      if (change.has_value()) {
+        authorities_ = primitives::AuthoritySet{authorities_.id + 1,
+                                                change->authorities};
+      }
+    }
+
+    finished_ = proof.is_finished;
+    return outcome::success();
+  }
+
+  outcome::result<void> WarpProofVerifier::verifyJustification(
+      const consensus::grandpa::GrandpaJustification &justification,
+      const std::vector<primitives::BlockHeader> &votes_ancestries) const {
+    using consensus::grandpa::Id;
+    const auto &justified = justification.block_info;
+
+    std::unordered_map<primitives::BlockHash, const primitives::BlockHeader *>
+        ancestries;
+    for (const auto &header : votes_ancestries) {
+      ancestries.emplace(hasher_->blake2b_256(scale::encode(header).value()),
+                         &header);
+    }
+    // Vote counts only if voted block is justified one or its descendant
+    auto has_ancestry = [&](primitives::BlockHash hash) {
+      while (hash != justified.hash) {
+        auto it = ancestries.find(hash);
+        if (it == ancestries.end() or it->second->number <= justified.number) {
+          return false;
+        }
+        hash = it->second->parent_hash;
+      }
+      return true;
+    };
+
+    auto voters =
+        std::make_shared<consensus::grandpa::VoterSet>(authorities_.id);
+    for (const auto &authority : authorities_.authorities) {
+      OUTCOME_TRY(voters->insert(primitives::GrandpaSessionKey(authority.id.id),
+                                 authority.weight));
+    }
+
+    // Only verifies signatures, so no keypair is needed
+    std::shared_ptr<crypto::Ed25519Keypair> keypair;
+    consensus::grandpa::VoteCryptoProviderImpl vote_crypto_provider{
+        keypair, ed25519_provider_, justification.round_number, voters};
+
+    // calculate super-majority
+    auto faulty = (voters->totalWeight() - 1) / 3;
+    auto threshold = voters->totalWeight() - faulty;
+    size_t total_weight = 0;
+
+    std::unordered_map<Id, primitives::BlockHash> validators;
+    std::unordered_set<Id> equivocators;
+
+    for (const auto &signed_precommit : justification.items) {
+      if (not vote_crypto_provider.verifyPrecommit(signed_precommit)) {
+        return Error::INVALID_SIGNATURE;
+      }
+      auto weight_res = voters->voterWeight(signed_precommit.id);
+      if (not weight_res.has_value()) {
+        return Error::UNKNOWN_VOTER;
+      }
+      auto weight = weight_res.value();
+
+      if (auto [it, success] = validators.emplace(
+              signed_precommit.id, signed_precommit.getBlockHash());
+          success) {
+        // New vote
+        if (has_ancestry(signed_precommit.getBlockHash())) {
+          total_weight += weight;
+        }
+
+      } else if (equivocators.emplace(signed_precommit.id).second) {
+        // Detected equivocation
+        if (has_ancestry(it->second)) {
+          total_weight -= weight;
+          threshold -= weight;
+        }
+
+      } else {
+        // Detected duplicate of equivotation
+        return Error::REDUNDANT_EQUIVOCATION;
+      }
+    }
+
+    if (total_weight < threshold) {
+      return Error::NOT_ENOUGH_WEIGHT;
+    }
+    return outcome::success();
+  }
+
+}  // namespace kagome::network
@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_WARPPROOFVERIFIER
+#define KAGOME_NETWORK_WARPPROOFVERIFIER
+
+#include <memory>
+#include <optional>
+
+#include "crypto/ed25519_provider.hpp"
+#include "crypto/hasher.hpp"
+#include "network/types/warp_sync.hpp"
+#include "primitives/authority.hpp"
+#include "primitives/justification.hpp"
+
+namespace kagome::network {
+
+  /**
+   * Verifies proofs of finality received by warp sync, starting from a
+   * finalized block with known authority set. Each fragment has to be
+   * justified by the current authority set; a fragment scheduling change of
+   * authority set moves verification to the next set.
+   *
+   * Blocks are not known locally, so precommits for descendants of the
+   * justified block are counted towards super-majority only if the fragment
+   * contains headers linking them to the justified block.
+   *
+   * Justifications are verified here rather than by GRANDPA, since it needs
+   * the justified blocks in block tree. Forced changes of authority set are
+   * not justified, so they can't be proven this way; a proof containing one
+   * is rejected with FORCED_CHANGE.
+   */
+  class WarpProofVerifier {
+   public:
+    enum class Error {
+      EMPTY_PROOF = 1,
+      WRONG_ORDER,
+      JUSTIFIED_OTHER_BLOCK,
+      NO_AUTHORITY_SET_CHANGE,
+      FORCED_CHANGE,
+      INVALID_SIGNATURE,
+      UNKNOWN_VOTER,
+      REDUNDANT_EQUIVOCATION,
+      NOT_ENOUGH_WEIGHT,
+    };
+
+    /**
+     * @param begin - finalized block, verification starts after it
+     * @param authorities - authority set finalizing blocks after {@param
+     * begin}
+     */
+    WarpProofVerifier(std::shared_ptr<crypto::Ed25519Provider> ed25519_provider,
+                      std::shared_ptr<crypto::Hasher> hasher,
+                      const primitives::BlockInfo &begin,
+                      primitives::AuthoritySet authorities);
+
+    /**
+     * Verifies fragments of the proof in order. The state is updated by each
+     * verified fragment, so on error it stays at the last valid one.
+     */
+    outcome::result<void> verify(const WarpSyncProof &proof);
+
+    /// @return last verified finalized block
+    const primitives::BlockInfo &block() const {
+      return block_;
+    }
+
+    /// @return authority set finalizing blocks after the last verified one
+    const primitives::AuthoritySet &authorities() const {
+      return authorities_;
+    }
+
+    /// @return header of the last verified block, if any
+    const std::optional<primitives::BlockHeader> &header() const {
+      return header_;
+    }
+
+    /// @return justification of the last verified block, if any
+    const std::optional<primitives::Justification> &justification() const {
+      return justification_;
+    }
+
+    /// @return true if verified proof reaches the latest finalized block
+    bool finished() const {
+      return finished_;
+    }
+
+   private:
+    outcome::result<void> verifyJustification(
+        const consensus::grandpa::GrandpaJustification &justification,
+        const std::vector<primitives::BlockHeader> &votes_ancestries) const;
+
+    std::shared_ptr<crypto::Ed25519Provider> ed25519_provider_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+
+    primitives::BlockInfo block_;
+    primitives::AuthoritySet authorities_;
+    std::optional<primitives::BlockHeader> header_;
+    std::optional<primitives::Justification> justification_;
+    bool finished_ = false;
+  };
+
+}  // namespace kagome::network
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::network, WarpProofVerifier::Error);
+
+#endif  // KAGOME_NETWORK_WARPPROOFVERIFIER
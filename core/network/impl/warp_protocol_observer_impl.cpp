@@ -0,0 +1,286 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/warp_protocol_observer_impl.hpp"
+
+#include <unordered_set>
+
+#include <boost/asio/post.hpp>
+#include <boost/assert.hpp>
+#include <soralog/util.hpp>
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::network,
+                            WarpProtocolObserverImpl::Error,
+                            e) {
+  using E = kagome::network::WarpProtocolObserverImpl::Error;
+  switch (e) {
+    case E::BEGIN_IS_NOT_FINALIZED:
+      return "Requested proof begins at a block, which is not finalized";
+    case E::MISSING_JUSTIFICATION:
+      return "Justification of a block changing authority set is not stored";
+    case E::INDEX_IS_NOT_READY:
+      return "Blocks changing authority set are not indexed yet";
+  }
+  return "unknown error";
+}
+
+namespace kagome::network {
+
+  WarpProtocolObserverImpl::WarpProtocolObserverImpl(
+      std::shared_ptr<application::AppStateManager> app_state_manager,
+      std::shared_ptr<blockchain::BlockTree> block_tree,
+      std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers,
+      primitives::events::ChainSubscriptionEnginePtr chain_sub_engine)
+      : block_tree_(std::move(block_tree)),
+        blocks_headers_(std::move(blocks_headers)),
+        chain_sub_engine_(std::move(chain_sub_engine)),
+        log_(log::createLogger("WarpProtocolObserver", "network")) {
+    BOOST_ASSERT(app_state_manager);
+    BOOST_ASSERT(block_tree_);
+    BOOST_ASSERT(blocks_headers_);
+    BOOST_ASSERT(chain_sub_engine_);
+
+    app_state_manager->takeControl(*this);
+  }
+
+  bool WarpProtocolObserverImpl::prepare() {
+    chain_subscription_ =
+        std::make_shared<primitives::events::ChainEventSubscriber>(
+            chain_sub_engine_);
+    chain_subscription_->subscribe(
+        chain_subscription_->generateSubscriptionSetId(),
+        primitives::events::ChainEventType::kFinalizedHeads);
+    chain_subscription_->setCallback(
+        [wp{weak_from_this()}](
+            auto set_id,
+            auto &receiver,
+            primitives::events::ChainEventType event_type,
+            const primitives::events::ChainEventParams &event_params) {
+          if (event_type
+              != primitives::events::ChainEventType::kFinalizedHeads) {
+            return;
+          }
+          if (auto self = wp.lock()) {
+            std::lock_guard lock{self->mutex_};
+            if (self->work_guard_.has_value()) {
+              boost::asio::post(*self->io_context_, [wp] {
+                if (auto self = wp.lock()) {
+                  self->index();
+                }
+              });
+            }
+          }
+        });
+    return true;
+  }
+
+  bool WarpProtocolObserverImpl::start() {
+    {
+      std::lock_guard lock{mutex_};
+      io_context_ = std::make_shared<boost::asio::io_context>();
+      work_guard_.emplace(io_context_->get_executor());
+    }
+    thread_ = std::thread([io_context{io_context_}] {
+      soralog::util::setThreadName("warp.index");
+      io_context->run();
+    });
+    boost::asio::post(*io_context_, [wp{weak_from_this()}] {
+      if (auto self = wp.lock()) {
+        self->index();
+      }
+    });
+    return true;
+  }
+
+  void WarpProtocolObserverImpl::stop() {
+    chain_subscription_.reset();
+    if (not thread_.joinable()) {
+      return;
+    }
+    {
+      std::lock_guard lock{mutex_};
+      work_guard_.reset();
+      io_context_->stop();
+    }
+    if (thread_.get_id() == std::this_thread::get_id()) {
+      // Last reference might be released by indexing thread itself
+      thread_.detach();
+    } else {
+      thread_.join();
+    }
+  }
+
+  void WarpProtocolObserverImpl::index() {
+    auto finalized = block_tree_->getLastFinalized();
+    auto res = scanChanges(finalized.number);
+    if (res.has_error()) {
+      SL_WARN(log_,
+              "Can't index authority set changes up to block {}: {}",
+              finalized,
+              res.error().message());
+      return;
+    }
+    std::lock_guard lock{mutex_};
+    if (not indexed_) {
+      indexed_ = true;
+      SL_INFO(log_,
+              "Authority set changes are indexed up to block {}: {} changes",
+              finalized,
+              changes_.size());
+    }
+  }
+
+  outcome::result<WarpSyncProof> WarpProtocolObserverImpl::onWarpRequest(
+      const WarpRequest &request) {
+    auto finalized = block_tree_->getLastFinalized();
+
+    OUTCOME_TRY(begin, blocks_headers_->getNumberByHash(request.begin));
+    if (begin > finalized.number) {
+      return Error::BEGIN_IS_NOT_FINALIZED;
+    }
+    OUTCOME_TRY(canonical, blocks_headers_->getHashByNumber(begin));
+    if (canonical != request.begin) {
+      return Error::BEGIN_IS_NOT_FINALIZED;
+    }
+
+    {
+      std::lock_guard lock{mutex_};
+      if (not indexed_) {
+        return Error::INDEX_IS_NOT_READY;
+      }
+    }
+    // Only a few blocks finalized since the last indexing may be left
+    OUTCOME_TRY(scanChanges(finalized.number));
+
+    std::vector<primitives::BlockHash> changes;
+    {
+      std::lock_guard lock{mutex_};
+      for (auto it = changes_.upper_bound(begin);
+           it != changes_.end() and it->first <= finalized.number;
+           ++it) {
+        changes.emplace_back(it->second);
+      }
+    }
+
+    WarpSyncProof proof;
+    size_t size = 0;
+    auto last = begin;
+    auto append = [&](WarpSyncFragment &&fragment) {
+      auto fragment_size = scale::encode(fragment).value().size();
+      if (not proof.proofs.empty()
+          and size + fragment_size > kMaxResponseSize) {
+        return false;
+      }
+      size += fragment_size;
+      last = fragment.header.number;
+      proof.proofs.emplace_back(std::move(fragment));
+      return true;
+    };
+
+    for (auto &hash : changes) {
+      OUTCOME_TRY(fragment, makeFragment(hash));
+      if (not append(std::move(fragment))) {
+        SL_DEBUG(log_,
+                 "Return incomplete warp proof from #{}: {} fragments",
+                 begin,
+                 proof.proofs.size());
+        return proof;
+      }
+    }
+
+    if (last < finalized.number) {
+      OUTCOME_TRY(fragment, makeFragment(finalized.hash));
+      if (not append(std::move(fragment))) {
+        return proof;
+      }
+    }
+
+    proof.is_finished = true;
+    SL_DEBUG(log_,
+             "Return warp proof from #{} to {}: {} fragments",
+             begin,
+             finalized,
+             proof.proofs.size());
+    return proof;
+  }
+
+  outcome::result<void> WarpProtocolObserverImpl::scanChanges(
+      primitives::BlockNumber finalized) {
+    for (;;) {
+      primitives::BlockNumber number;
+      {
+        std::lock_guard lock{mutex_};
+        if (scanned_ >= finalized) {
+          return outcome::success();
+        }
+        number = scanned_ + 1;
+      }
+      OUTCOME_TRY(hash, blocks_headers_->getHashByNumber(number));
+      OUTCOME_TRY(header, blocks_headers_->getBlockHeader(hash));
+      OUTCOME_TRY(change, scheduledChangeOf(header));
+      // Forced change is indexed too, so that requester learns it can't
+      // verify the proof instead of failing on signatures of the next set
+      OUTCOME_TRY(forced, hasForcedChange(header));
+
+      std::lock_guard lock{mutex_};
+      // The block might be scanned concurrently meanwhile
+      if (scanned_ + 1 == number) {
+        if (change.has_value() or forced) {
+          changes_.emplace(number, hash);
+        }
+        scanned_ = number;
+      }
+    }
+  }
+
+  outcome::result<WarpSyncFragment> WarpProtocolObserverImpl::makeFragment(
+      const primitives::BlockHash &hash) const {
+    OUTCOME_TRY(header, blocks_headers_->getBlockHeader(hash));
+    auto justification_res = block_tree_->getBlockJustification(hash);
+    if (not justification_res.has_value()) {
+      SL_WARN(log_,
+              "Can't make warp proof: no justification of block #{}",
+              header.number);
+      return Error::MISSING_JUSTIFICATION;
+    }
+    OUTCOME_TRY(justification,
+                scale::decode<consensus::grandpa::GrandpaJustification>(
+                    justification_res.value().data));
+    auto ancestries = votesAncestries(justification);
+    return WarpSyncFragment{
+        std::move(header), std::move(justification), std::move(ancestries)};
+  }
+
+  std::vector<primitives::BlockHeader>
+  WarpProtocolObserverImpl::votesAncestries(
+      const consensus::grandpa::GrandpaJustification &justification) const {
+    const auto &justified = justification.block_info;
+    std::vector<primitives::BlockHeader> ancestries;
+    std::unordered_set<primitives::BlockHash> collected;
+    for (const auto &signed_precommit : justification.items) {
+      std::vector<std::pair<primitives::BlockHash, primitives::BlockHeader>>
+          ancestry;
+      auto hash = signed_precommit.getBlockHash();
+      while (hash != justified.hash and collected.count(hash) == 0) {
+        auto header_res = blocks_headers_->getBlockHeader(hash);
+        if (not header_res.has_value()
+            or header_res.value().number <= justified.number) {
+          // Not a descendant of justified block, or it is unknown
+          ancestry.clear();
+          break;
+        }
+        auto parent_hash = header_res.value().parent_hash;
+        ancestry.emplace_back(hash, std::move(header_res.value()));
+        hash = parent_hash;
+      }
+      for (auto &[block_hash, header] : ancestry) {
+        collected.emplace(block_hash);
+        ancestries.emplace_back(std::move(header));
+      }
+    }
+    return ancestries;
+  }
+
+}  // namespace kagome::network
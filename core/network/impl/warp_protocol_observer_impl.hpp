@@ -0,0 +1,121 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_WARP_PROTOCOL_OBSERVER_IMPL
+#define KAGOME_WARP_PROTOCOL_OBSERVER_IMPL
+
+#include "network/warp_protocol_observer.hpp"
+
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "application/app_state_manager.hpp"
+#include "blockchain/block_header_repository.hpp"
+#include "blockchain/block_tree.hpp"
+#include "log/logger.hpp"
+#include "primitives/common.hpp"
+#include "primitives/event_types.hpp"
+
+namespace kagome::network {
+
+  /**
+   * Serves proofs of finality of the latest finalized block: headers of
+   * finalized blocks scheduling change of GRANDPA authority set, each with
+   * justification signed by authorities of the previous set, followed by
+   * justification of the latest finalized block.
+   *
+   * Blocks with changes are indexed on own thread: finalized headers are
+   * scanned once at start, and then newly finalized ones as they appear.
+   * Requests are answered only when the index is built. Each fragment is
+   * accompanied by headers of blocks voted by precommits of the
+   * justification, so that votes for descendants can be counted.
+   */
+  class WarpProtocolObserverImpl
+      : public WarpProtocolObserver,
+        public std::enable_shared_from_this<WarpProtocolObserverImpl> {
+   public:
+    enum class Error {
+      BEGIN_IS_NOT_FINALIZED = 1,
+      MISSING_JUSTIFICATION,
+      INDEX_IS_NOT_READY,
+    };
+
+    /// Max size of encoded proof in response; the rest of the proof is
+    /// requested by next request
+    static constexpr size_t kMaxResponseSize = 8 * 1024 * 1024;
+
+    WarpProtocolObserverImpl(
+        std::shared_ptr<application::AppStateManager> app_state_manager,
+        std::shared_ptr<blockchain::BlockTree> block_tree,
+        std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers,
+        primitives::events::ChainSubscriptionEnginePtr chain_sub_engine);
+
+    ~WarpProtocolObserverImpl() override = default;
+
+    /// Subscribes to finalization of blocks
+    bool prepare();
+
+    /// Launches indexing thread, which scans finalized blocks
+    bool start();
+
+    /// Stops indexing thread
+    void stop();
+
+    outcome::result<WarpSyncProof> onWarpRequest(
+        const WarpRequest &request) override;
+
+   private:
+    /// Indexes finalized blocks not scanned yet. Called on indexing thread
+    void index();
+
+    /**
+     * Finds blocks with scheduled changes up to the finalized one. May be
+     * called concurrently, each block is scanned once
+     */
+    outcome::result<void> scanChanges(primitives::BlockNumber finalized);
+
+    outcome::result<WarpSyncFragment> makeFragment(
+        const primitives::BlockHash &hash) const;
+
+    /**
+     * @return headers of blocks between justified block (exclusive) and
+     * blocks voted by precommits of {@param justification}; votes, ancestry of
+     * which is unknown, are skipped
+     */
+    std::vector<primitives::BlockHeader> votesAncestries(
+        const consensus::grandpa::GrandpaJustification &justification) const;
+
+    std::shared_ptr<blockchain::BlockTree> block_tree_;
+    std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers_;
+    primitives::events::ChainSubscriptionEnginePtr chain_sub_engine_;
+    primitives::events::ChainEventSubscriberPtr chain_subscription_;
+
+    std::shared_ptr<boost::asio::io_context> io_context_;
+    using WorkGuard = boost::asio::executor_work_guard<
+        boost::asio::io_context::executor_type>;
+    std::optional<WorkGuard> work_guard_;
+    std::thread thread_;
+
+    mutable std::mutex mutex_;
+    /// Finalized blocks with scheduled or forced changes of authority set
+    std::map<primitives::BlockNumber, primitives::BlockHash> changes_;
+    /// Number of the last scanned block
+    primitives::BlockNumber scanned_ = 0;
+    /// Set once blocks finalized at start are scanned
+    bool indexed_ = false;
+
+    log::Logger log_;
+  };
+
+}  // namespace kagome::network
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::network, WarpProtocolObserverImpl::Error);
+
+#endif  // KAGOME_WARP_PROTOCOL_OBSERVER_IMPL
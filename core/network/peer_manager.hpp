@@ -12,6 +12,7 @@
 #include <libp2p/peer/peer_id.hpp>
 #include <libp2p/peer/peer_info.hpp>
 
+#include "network/peer_scoring.hpp"
 #include "network/types/block_announce.hpp"
 #include "network/types/collator_messages.hpp"
 #include "network/types/grandpa_message.hpp"
@@ -147,6 +148,13 @@ namespace kagome::network {
     virtual std::optional<std::reference_wrapper<PeerState>> getPeerState(
         const PeerId &peer_id) = 0;
 
+    /**
+     * @returns statistics of interaction with active peer with {@param
+     * peer_id}, which its score is based on, or none
+     */
+    virtual std::optional<PeerStats> getPeerStats(
+        const PeerId &peer_id) const = 0;
+
     /**
      * @returns number of active peers
      */
@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_PEERSCORING
+#define KAGOME_NETWORK_PEERSCORING
+
+#include <chrono>
+#include <map>
+#include <optional>
+#include <string>
+
+#include <libp2p/peer/peer_id.hpp>
+
+namespace kagome::network {
+
+  /// Statistics of interaction with a peer over one protocol
+  struct PeerProtocolStats {
+    /// Requests sent to the peer
+    size_t requests = 0;
+    /// Requests failed or answered with unusable response
+    size_t failures = 0;
+    /// Smoothed time between sending request and receiving response
+    std::chrono::milliseconds latency{0};
+    /// Smoothed amount of useful payload received per second of request
+    double throughput = 0.;
+    /// Gossip messages received from the peer
+    size_t messages = 0;
+    /// Gossip messages, which were not known before
+    size_t useful_messages = 0;
+  };
+
+  struct PeerStats {
+    /// Score in range [0, 1], the higher the better
+    double score = 0.;
+    std::map<std::string, PeerProtocolStats> protocols;
+  };
+
+  /**
+   * Scores connected peers by quality of their service: latency and
+   * throughput of responses to requests, share of failed requests and share of
+   * useful gossip messages. Peers are kept ordered by score, so the worst one
+   * is found without walking over all of them.
+   * It is the only source of peer quality for ranking peers, e.g. in parallel
+   * download of blocks and state. Methods are safe to call from any thread.
+   */
+  class PeerScoring {
+   public:
+    using PeerId = libp2p::peer::PeerId;
+
+    virtual ~PeerScoring() = default;
+
+    /// Starts scoring of the peer, which became active
+    virtual void addPeer(const PeerId &peer_id) = 0;
+
+    /// Stops scoring of the peer and forgets its statistics
+    virtual void removePeer(const PeerId &peer_id) = 0;
+
+    /**
+     * Accounts successful response to request over {@param protocol}
+     * @param latency - time between sending request and receiving response
+     * @param bytes - amount of useful payload in response
+     */
+    virtual void onResponse(const PeerId &peer_id,
+                            const std::string &protocol,
+                            std::chrono::milliseconds latency,
+                            size_t bytes) = 0;
+
+    /// Accounts request over {@param protocol}, which failed
+    virtual void onRequestFailed(const PeerId &peer_id,
+                                 const std::string &protocol) = 0;
+
+    /**
+     * Accounts gossip message received over {@param protocol}
+     * @param useful - false if the message was already known
+     */
+    virtual void onMessage(const PeerId &peer_id,
+                           const std::string &protocol,
+                           bool useful) = 0;
+
+    /// @return score of the peer, or none if the peer isn't scored
+    virtual std::optional<double> score(const PeerId &peer_id) const = 0;
+
+    /// @return smoothed throughput (B/s) of responses of the peer over
+    /// {@param protocol}, or none if there was no successful response yet
+    virtual std::optional<double> throughput(
+        const PeerId &peer_id, const std::string &protocol) const = 0;
+
+    /// @return statistics of the peer, or none if the peer isn't scored
+    virtual std::optional<PeerStats> stats(const PeerId &peer_id) const = 0;
+
+    /// @return scored peer with the lowest score, if any
+    virtual std::optional<PeerId> worstPeer() const = 0;
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_PEERSCORING
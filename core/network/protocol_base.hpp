@@ -22,6 +22,16 @@ namespace kagome::network {
 
   using namespace std::string_literals;
 
+  /**
+   * Priority class of outgoing messages of a protocol. Messages of higher
+   * priority are written to a peer before ones of lower priority.
+   */
+  enum class OutboundPriority : uint8_t {
+    CONSENSUS = 0,
+    ANNOUNCES = 1,
+    TRANSACTIONS = 2,
+  };
+
   class ProtocolBase {
    public:
     ProtocolBase() = default;
@@ -33,6 +43,10 @@ namespace kagome::network {
 
     virtual const std::string &protocolName() const = 0;
 
+    virtual OutboundPriority outboundPriority() const {
+      return OutboundPriority::ANNOUNCES;
+    }
+
     virtual bool start() = 0;
     virtual bool stop() = 0;
 
@@ -0,0 +1,38 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_WARPPROTOCOL
+#define KAGOME_NETWORK_WARPPROTOCOL
+
+#include "network/protocol_base.hpp"
+
+#include <memory>
+
+#include "network/types/warp_sync.hpp"
+
+namespace kagome::network {
+
+  /**
+   * @brief Class for communication via `/{chainType}/sync/warp`: request of
+   * proof of finality of the latest finalized block
+   */
+  class WarpProtocol : public virtual ProtocolBase {
+   public:
+    /**
+     * @brief Make async request to peer and return response in callback
+     * @param peer_id of a peer to make request to
+     * @param request a request content
+     * @param response_handler a callback to call when response received
+     */
+    virtual void request(
+        const PeerId &peer_id,
+        WarpRequest request,
+        std::function<void(outcome::result<WarpSyncProof>)>
+            &&response_handler) = 0;
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_WARPPROTOCOL
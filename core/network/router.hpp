@@ -16,6 +16,7 @@
 #include "network/protocols/state_protocol.hpp"
 #include "network/impl/protocols/protocol_req_collation.hpp"
 #include "network/protocols/sync_protocol.hpp"
+#include "network/protocols/warp_protocol.hpp"
 
 namespace kagome::network {
   /**
@@ -35,6 +36,7 @@ namespace kagome::network {
     getPropagateTransactionsProtocol() const = 0;
     virtual std::shared_ptr<StateProtocol> getStateProtocol() const = 0;
     virtual std::shared_ptr<SyncProtocol> getSyncProtocol() const = 0;
+    virtual std::shared_ptr<WarpProtocol> getWarpProtocol() const = 0;
     virtual std::shared_ptr<GrandpaProtocol> getGrandpaProtocol() const = 0;
 
     virtual std::shared_ptr<libp2p::protocol::Ping> getPingProtocol() const = 0;
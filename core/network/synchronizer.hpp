@@ -50,11 +50,26 @@ namespace kagome::network {
                                            std::optional<uint32_t> limit,
                                            SyncResultHandler &&handler) = 0;
 
+    /// Loads ranges of state of block {@param block} from peer
+    /// {@param peer_id}, concurrently with other peers.
+    /// {@param handler} is called with the block once the peer has nothing
+    /// more to load, or with error; state is synced if there is no incomplete
+    /// request of state sync then
     virtual void syncState(const libp2p::peer::PeerId &peer_id,
                            const primitives::BlockInfo &block,
                            SyncResultHandler &&handler) = 0;
 
     virtual bool hasIncompleteRequestOfStateSync() const = 0;
+
+    /// Loads and verifies proof of finality of the latest finalized block
+    /// from peer {@param peer_id}, starting at genesis. The proof is a chain
+    /// of GRANDPA authority set changes, so only a few headers are loaded.
+    /// The verified block becomes the last finalized block with the authority
+    /// set of the proof, so that its state can be synced next.
+    /// {@param handler} is called with the verified block once the proof is
+    /// complete, or with error
+    virtual void syncWarp(const libp2p::peer::PeerId &peer_id,
+                          SyncResultHandler &&handler) = 0;
   };
 
 }  // namespace kagome::network
@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_WARPSYNC
+#define KAGOME_NETWORK_WARPSYNC
+
+#include "consensus/grandpa/structs.hpp"
+#include "primitives/block_header.hpp"
+#include "primitives/digest.hpp"
+#include "scale/tie.hpp"
+
+namespace kagome::network {
+  /**
+   * Request for proof of finality of the latest finalized block
+   */
+  struct WarpRequest {
+    SCALE_TIE(1);
+
+    /// Finalized block, authority set of which is known to requester;
+    /// proof starts after it
+    primitives::BlockHash begin;
+  };
+
+  /**
+   * Block changing authority set, and its justification signed by authorities
+   * before the change
+   */
+  struct WarpSyncFragment {
+    SCALE_TIE(3);
+
+    primitives::BlockHeader header;
+    consensus::grandpa::GrandpaJustification justification;
+    /// Headers of blocks between the justified one and blocks voted by
+    /// precommits of the justification
+    std::vector<primitives::BlockHeader> votes_ancestries;
+  };
+
+  /**
+   * Chain of authority set changes. Fragments of incomplete proof are
+   * followed by next request starting at the last of them.
+   */
+  struct WarpSyncProof {
+    SCALE_TIE(2);
+
+    std::vector<WarpSyncFragment> proofs;
+    /// true if the last fragment is justification of the latest finalized
+    /// block
+    bool is_finished = false;
+  };
+
+  /// @return GRANDPA scheduled change of authority set, which the block
+  /// contains, if any
+  inline outcome::result<std::optional<primitives::ScheduledChange>>
+  scheduledChangeOf(const primitives::BlockHeader &header) {
+    for (auto &digest : header.digest) {
+      if (auto consensus = boost::get<primitives::Consensus>(&digest);
+          consensus != nullptr) {
+        OUTCOME_TRY(message, consensus->decode());
+        if (message.isGrandpaDigestOf<primitives::ScheduledChange>()) {
+          return boost::get<primitives::ScheduledChange>(
+              message.asGrandpaDigest());
+        }
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// @return true if the block contains GRANDPA forced change of authority
+  /// set
+  inline outcome::result<bool> hasForcedChange(
+      const primitives::BlockHeader &header) {
+    for (auto &digest : header.digest) {
+      if (auto consensus = boost::get<primitives::Consensus>(&digest);
+          consensus != nullptr) {
+        OUTCOME_TRY(message, consensus->decode());
+        if (message.isGrandpaDigestOf<primitives::ForcedChange>()) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_WARPSYNC
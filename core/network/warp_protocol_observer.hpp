@@ -0,0 +1,30 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_WARP_PROTOCOL_OBSERVER_HPP
+#define KAGOME_WARP_PROTOCOL_OBSERVER_HPP
+
+#include <outcome/outcome.hpp>
+#include "network/types/warp_sync.hpp"
+
+namespace kagome::network {
+  /**
+   * Reactive part of Warp sync protocol
+   */
+  class WarpProtocolObserver {
+   public:
+    virtual ~WarpProtocolObserver() = default;
+
+    /**
+     * Process a warp sync request
+     * @param request to be processed
+     * @return proof of finality of the latest finalized block or error
+     */
+    virtual outcome::result<WarpSyncProof> onWarpRequest(
+        const WarpRequest &request) = 0;
+  };
+}  // namespace kagome::network
+
+#endif  // KAGOME_WARP_PROTOCOL_OBSERVER_HPP
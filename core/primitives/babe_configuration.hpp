@@ -10,6 +10,7 @@
 #include "consensus/babe/common.hpp"
 #include "crypto/sr25519_types.hpp"
 #include "primitives/authority.hpp"
+#include "scale/tie.hpp"
 
 namespace kagome::primitives {
 
@@ -76,6 +77,54 @@ namespace kagome::primitives {
     config.allowed_slots = static_cast<AllowedSlots>(allowed_slots);
     return s;
   }
+
+  /// Configuration of BABE, which might be changed at an epoch
+  struct BabeEpochConfiguration {
+    /// Value of `c`, as in BabeConfiguration::leadership_rate
+    std::pair<uint64_t, uint64_t> leadership_rate;
+
+    /// Type of allowed slots.
+    AllowedSlots allowed_slots;
+  };
+
+  template <class Stream,
+            typename = std::enable_if_t<Stream::is_encoder_stream>>
+  Stream &operator<<(Stream &s, const BabeEpochConfiguration &config) {
+    return s << config.leadership_rate
+             << static_cast<uint8_t>(config.allowed_slots);
+  }
+
+  template <class Stream,
+            typename = std::enable_if_t<Stream::is_decoder_stream>>
+  Stream &operator>>(Stream &s, BabeEpochConfiguration &config) {
+    uint8_t allowed_slots;
+    s >> config.leadership_rate >> allowed_slots;
+    config.allowed_slots = static_cast<AllowedSlots>(allowed_slots);
+    return s;
+  }
+
+  /// Data of BABE epoch, as provided by runtime
+  struct Epoch {
+    SCALE_TIE(6);
+
+    /// The epoch index.
+    consensus::EpochNumber epoch_index{};
+
+    /// The starting slot of the epoch.
+    BabeSlotNumber start_slot{};
+
+    /// The duration of this epoch in slots.
+    BabeSlotNumber duration{};
+
+    /// The authorities actual for the epoch.
+    AuthorityList authorities;
+
+    /// Randomness for this epoch.
+    Randomness randomness;
+
+    /// Configuration of the epoch.
+    BabeEpochConfiguration config;
+  };
 }  // namespace kagome::primitives
 
 #endif  // KAGOME_CORE_PRIMITIVES_BABE_CONFIGURATION_HPP
@@ -38,7 +38,9 @@ namespace kagome::primitives::events {
     kFinalizedHeads = 2,
     kAllHeads = 3,
     kFinalizedRuntimeVersion = 4,
-    kNewRuntime = 5
+    kNewRuntime = 5,
+    /// All storage changes of an added block are notified to subscribers
+    kStorageChangesNotified = 6
   };
 
   using HeadsEventParams = ref_t<const primitives::BlockHeader>;
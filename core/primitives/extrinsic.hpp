@@ -9,6 +9,7 @@
 #include <optional>
 
 #include "common/buffer.hpp"
+#include "scale/scale.hpp"
 #include "scale/tie.hpp"
 
 namespace kagome::primitives {
@@ -26,6 +27,32 @@ namespace kagome::primitives {
 
     common::Buffer data;  ///< extrinsic content as byte array
   };
+
+  /**
+   * SCALE encoding of extrinsic split into its parts: compact length of data
+   * and the data itself. Lets the encoding be written right into destination
+   * without intermediate encoded copy of data
+   */
+  struct EncodedExtrinsic {
+    std::vector<uint8_t> length;
+    common::BufferView data;
+
+    /// @return size of whole encoding
+    size_t size() const {
+      return length.size() + data.size();
+    }
+  };
+
+  /**
+   * @param extrinsic to be encoded, must outlive the result
+   * @return parts of SCALE encoding of extrinsic
+   */
+  inline EncodedExtrinsic encodeExtrinsic(const Extrinsic &extrinsic) {
+    return {
+        scale::encode(scale::CompactInteger{extrinsic.data.size()}).value(),
+        extrinsic.data,
+    };
+  }
 }  // namespace kagome::primitives
 
 #endif  // KAGOME_PRIMITIVES_EXTRINSIC_HPP
@@ -11,6 +11,29 @@
 
 namespace kagome::primitives {
 
+  enum class TransactionSource : uint8_t {
+    /// Transaction is already included in block.
+    ///
+    /// This means that we can't really tell where the transaction is coming
+    /// from, since it's already in the received block. Note that the custom
+    /// validation logic using either `Local` or `External` should most likely
+    /// just allow `InBlock` transactions as well.
+    InBlock,
+
+    /// Transaction is coming from a local source.
+    ///
+    /// This means that the transaction was produced internally by the node
+    /// (for instance an Off-Chain Worker, or an Off-Chain Call), as opposed
+    /// to being received over the network.
+    Local,
+
+    /// Transaction has been received externally.
+    ///
+    /// This means the transaction has been received from (usually) "untrusted"
+    /// source, for instance received over the network or RPC.
+    External,
+  };
+
   struct Transaction {
     /// Hash of tx
     using Hash = common::Hash256;
@@ -56,13 +79,18 @@ namespace kagome::primitives {
 
     /// Should that transaction be propagated.
     bool should_propagate{false};
+
+    /// Source the transaction was submitted from, it is revalidated as
+    /// coming from the same source
+    TransactionSource source{TransactionSource::External};
   };
 
   inline bool operator==(const Transaction &v1, const Transaction &v2) {
     return v1.ext == v2.ext && v1.bytes == v2.bytes && v1.hash == v2.hash
            && v1.priority == v2.priority && v1.valid_till == v2.valid_till
            && v1.requires == v2.requires && v1.provides == v2.provides
-           && v1.should_propagate == v2.should_propagate;
+           && v1.should_propagate == v2.should_propagate
+           && v1.source == v2.source;
   }
 
 }  // namespace kagome::primitives
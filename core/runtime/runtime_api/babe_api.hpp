@@ -25,6 +25,20 @@ namespace kagome::runtime {
      */
     virtual outcome::result<primitives::BabeConfiguration> configuration(
         primitives::BlockHash const &block) = 0;
+
+    /**
+     * Get data of the epoch, which the block belongs to
+     * @return current epoch
+     */
+    virtual outcome::result<primitives::Epoch> current_epoch(
+        primitives::BlockHash const &block) = 0;
+
+    /**
+     * Get data of the epoch following the one, which the block belongs to
+     * @return next epoch
+     */
+    virtual outcome::result<primitives::Epoch> next_epoch(
+        primitives::BlockHash const &block) = 0;
   };
 
 }  // namespace kagome::runtime
@@ -20,4 +20,15 @@ namespace kagome::runtime {
         block, "BabeApi_configuration");
   }
 
+  outcome::result<primitives::Epoch> BabeApiImpl::current_epoch(
+      primitives::BlockHash const &block) {
+    return executor_->callAt<primitives::Epoch>(block,
+                                                "BabeApi_current_epoch");
+  }
+
+  outcome::result<primitives::Epoch> BabeApiImpl::next_epoch(
+      primitives::BlockHash const &block) {
+    return executor_->callAt<primitives::Epoch>(block, "BabeApi_next_epoch");
+  }
+
 }  // namespace kagome::runtime
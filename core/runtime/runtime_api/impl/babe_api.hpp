@@ -19,6 +19,12 @@ namespace kagome::runtime {
     outcome::result<primitives::BabeConfiguration> configuration(
         primitives::BlockHash const &block) override;
 
+    outcome::result<primitives::Epoch> current_epoch(
+        primitives::BlockHash const &block) override;
+
+    outcome::result<primitives::Epoch> next_epoch(
+        primitives::BlockHash const &block) override;
+
    private:
     std::shared_ptr<Executor> executor_;
   };
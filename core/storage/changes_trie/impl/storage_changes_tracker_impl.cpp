@@ -35,6 +35,12 @@ namespace kagome::storage::changes_trie {
       storage_subscription_engine_->notify(
           pair.first, pair.second, parent_hash_);
     }
+    if (not actual_val_.empty()) {
+      // lets subscribers send changes of the block at once
+      chain_subscription_engine_->notify(
+          primitives::events::ChainEventType::kStorageChangesNotified,
+          std::nullopt);
+    }
   }
 
   void StorageChangesTrackerImpl::onPut(const common::BufferView &key,
@@ -76,6 +76,46 @@ namespace kagome::storage {
     return status_as_error(status);
   }
 
+  outcome::result<std::unique_ptr<RocksDB>> RocksDB::createSecondary(
+      const boost::filesystem::path &path,
+      const boost::filesystem::path &secondary_path,
+      rocksdb::Options options) {
+    if (!filesystem::createDirectoryRecursive(secondary_path)) {
+      return DatabaseError::DB_PATH_NOT_CREATED;
+    }
+
+    auto log = log::createLogger("RocksDB", "storage");
+
+    // secondary instance requires all files of primary one to be kept open
+    options.max_open_files = -1;
+
+    rocksdb::DB *db = nullptr;
+    auto status = rocksdb::DB::OpenAsSecondary(
+        options, path.native(), secondary_path.native(), &db);
+    if (status.ok()) {
+      std::unique_ptr<RocksDB> l{new RocksDB(false)};
+      l->db_ = std::unique_ptr<rocksdb::DB>(db);
+      l->logger_ = std::move(log);
+      return l;
+    }
+
+    SL_ERROR(log,
+             "Can't open database in {} as secondary: {}",
+             fs::absolute(path, fs::current_path()).native(),
+             status.ToString());
+
+    return status_as_error(status);
+  }
+
+  outcome::result<void> RocksDB::tryCatchUpWithPrimary() {
+    auto status = db_->TryCatchUpWithPrimary();
+    if (status.ok()) {
+      return outcome::success();
+    }
+
+    return status_as_error(status);
+  }
+
   std::unique_ptr<BufferBatch> RocksDB::batch() {
     return std::make_unique<Batch>(*this);
   }
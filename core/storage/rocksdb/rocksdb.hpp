@@ -32,6 +32,27 @@ namespace kagome::storage {
         rocksdb::Options options = rocksdb::Options(),
         bool prevent_destruction = false);
 
+    /**
+     * @brief Factory method to open database of another process as secondary
+     * instance, which is read-only and follows the primary one by
+     * `tryCatchUpWithPrimary` calls
+     * @param path filesystem path of database of primary instance
+     * @param secondary_path filesystem path where secondary instance keeps
+     * its own info logs
+     * @param options rocksdb options, such as caching, logging, etc.
+     * @return instance of RocksDB
+     */
+    static outcome::result<std::unique_ptr<RocksDB>> createSecondary(
+        const boost::filesystem::path &path,
+        const boost::filesystem::path &secondary_path,
+        rocksdb::Options options = rocksdb::Options());
+
+    /**
+     * @brief Applies changes made by primary instance since open or previous
+     * call, for instance created by `createSecondary`
+     */
+    outcome::result<void> tryCatchUpWithPrimary();
+
     std::unique_ptr<BufferBatch> batch() override;
 
     size_t size() const override;
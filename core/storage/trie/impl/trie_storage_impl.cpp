@@ -61,6 +61,16 @@ namespace kagome::storage::trie {
         codec_, serializer_, changes_, std::move(trie));
   }
 
+  outcome::result<std::unique_ptr<PersistentTrieBatch>>
+  TrieStorageImpl::getUntrackedPersistentBatchAt(const RootHash &root) {
+    SL_DEBUG(logger_,
+             "Initialize untracked persistent trie batch with root: {}",
+             root.toHex());
+    OUTCOME_TRY(trie, serializer_->retrieveTrie(Buffer{root}));
+    return PersistentTrieBatchImpl::create(
+        codec_, serializer_, std::nullopt, std::move(trie));
+  }
+
   outcome::result<std::unique_ptr<EphemeralTrieBatch>>
   TrieStorageImpl::getEphemeralBatchAt(const RootHash &root) const {
     SL_DEBUG(
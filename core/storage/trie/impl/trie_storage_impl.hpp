@@ -39,6 +39,8 @@ namespace kagome::storage::trie {
 
     outcome::result<std::unique_ptr<PersistentTrieBatch>> getPersistentBatchAt(
         const RootHash &root) override;
+    outcome::result<std::unique_ptr<PersistentTrieBatch>>
+    getUntrackedPersistentBatchAt(const RootHash &root) override;
     outcome::result<std::unique_ptr<EphemeralTrieBatch>> getEphemeralBatchAt(
         const RootHash &root) const override;
 
@@ -0,0 +1,128 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/polkadot_trie/polkadot_trie_diff.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace {
+  using namespace kagome::storage::trie;
+  using kagome::common::Buffer;
+
+  /// Compared key and its nibbles, which are left to pass from current node
+  struct PendingKey {
+    size_t index;
+    NibblesView nibbles;
+  };
+
+  /// @returns db key of the child, if it is not loaded from the storage yet
+  const Buffer *dbKeyOfChild(const BranchNode &branch, uint8_t idx) {
+    auto dummy = dynamic_cast<const DummyNode *>(branch.children.at(idx).get());
+    return dummy != nullptr ? &dummy->db_key : nullptr;
+  }
+
+  outcome::result<std::optional<Buffer>> valueAt(
+      const PolkadotTrie &trie,
+      const PolkadotTrie::ConstNodePtr &node,
+      const NibblesView &nibbles) {
+    OUTCOME_TRY(found, trie.getNode(node, nibbles));
+    if (found != nullptr and found->value.has_value()) {
+      return found->value;
+    }
+    return std::nullopt;
+  }
+
+  outcome::result<void> compareNodes(
+      const PolkadotTrie &prev,
+      const PolkadotTrie::ConstNodePtr &prev_node,
+      const PolkadotTrie &next,
+      const PolkadotTrie::ConstNodePtr &next_node,
+      const std::vector<PendingKey> &keys,
+      const OnChangedValue &callback) {
+    if (prev_node == nullptr and next_node == nullptr) {
+      return outcome::success();
+    }
+    auto prev_branch = std::dynamic_pointer_cast<const BranchNode>(prev_node);
+    auto next_branch = std::dynamic_pointer_cast<const BranchNode>(next_node);
+    auto same_shape = prev_node != nullptr and next_node != nullptr
+                  and prev_node->key_nibbles == next_node->key_nibbles
+                  and (prev_branch == nullptr) == (next_branch == nullptr);
+    if (not same_shape) {
+      // subtrees are structured differently, so keys are looked up in both
+      for (auto &key : keys) {
+        OUTCOME_TRY(prev_value, valueAt(prev, prev_node, key.nibbles));
+        OUTCOME_TRY(next_value, valueAt(next, next_node, key.nibbles));
+        if (prev_value != next_value) {
+          callback(key.index, next_value);
+        }
+      }
+      return outcome::success();
+    }
+
+    const auto &partial_key = next_node->key_nibbles;
+    std::array<std::vector<PendingKey>, BranchNode::kMaxChildren> by_child;
+    for (auto &key : keys) {
+      if (key.nibbles == partial_key) {
+        if (prev_node->value != next_node->value) {
+          callback(key.index, next_node->value);
+        }
+      } else if (next_branch != nullptr
+                 and key.nibbles.size()
+                         > static_cast<ssize_t>(partial_key.size())
+                 and std::equal(partial_key.begin(),
+                                partial_key.end(),
+                                key.nibbles.begin())) {
+        auto idx = key.nibbles[partial_key.size()];
+        by_child.at(idx).push_back(
+            {key.index, key.nibbles.subspan(partial_key.size() + 1)});
+      }
+      // otherwise the key is absent in both subtrees
+    }
+    if (next_branch == nullptr) {
+      return outcome::success();
+    }
+
+    for (uint8_t idx = 0; idx < BranchNode::kMaxChildren; ++idx) {
+      if (by_child.at(idx).empty()) {
+        continue;
+      }
+      auto prev_db_key = dbKeyOfChild(*prev_branch, idx);
+      auto next_db_key = dbKeyOfChild(*next_branch, idx);
+      if (prev_db_key != nullptr and next_db_key != nullptr
+          and *prev_db_key == *next_db_key) {
+        // the same merkle value, so the subtree is not changed
+        continue;
+      }
+      OUTCOME_TRY(prev_child, prev.retrieveChild(*prev_branch, idx));
+      OUTCOME_TRY(next_child, next.retrieveChild(*next_branch, idx));
+      OUTCOME_TRY(compareNodes(
+          prev, prev_child, next, next_child, by_child.at(idx), callback));
+    }
+    return outcome::success();
+  }
+}  // namespace
+
+namespace kagome::storage::trie {
+
+  outcome::result<void> forEachChangedValue(
+      const PolkadotTrie &prev,
+      const PolkadotTrie &next,
+      gsl::span<const common::Buffer> keys,
+      const OnChangedValue &callback) {
+    std::vector<KeyNibbles> nibbles;
+    nibbles.reserve(keys.size());
+    std::vector<PendingKey> pending;
+    pending.reserve(keys.size());
+    for (auto &key : keys) {
+      nibbles.emplace_back(KeyNibbles::fromByteBuffer(key));
+      pending.push_back({pending.size(), nibbles.back()});
+    }
+    return compareNodes(
+        prev, prev.getRoot(), next, next.getRoot(), pending, callback);
+  }
+
+}  // namespace kagome::storage::trie
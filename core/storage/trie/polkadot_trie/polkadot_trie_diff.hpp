@@ -0,0 +1,45 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_TRIE_POLKADOT_TRIE_DIFF_HPP
+#define KAGOME_STORAGE_TRIE_POLKADOT_TRIE_DIFF_HPP
+
+#include <functional>
+
+#include <gsl/span>
+
+#include "storage/trie/polkadot_trie/polkadot_trie.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * Called for each key, which value differs in compared tries
+   * @param key_index index of the key in the compared keys
+   * @param value of the key in the latter trie
+   */
+  using OnChangedValue = std::function<void(
+      size_t key_index, const std::optional<common::Buffer> &value)>;
+
+  /**
+   * Compares values of the keys in two tries, e.g. states of consecutive
+   * blocks. A subtree is descended only if its merkle values in the tries
+   * differ, so unchanged parts of the tries are neither loaded from the
+   * storage nor walked. Merkle values are known only for nodes not loaded
+   * yet, so the tries should be freshly retrieved: loaded subtrees are
+   * walked regardless.
+   * @param prev the former trie
+   * @param next the latter trie
+   * @param keys to compare values of
+   * @param callback to be called for each key, which value differs
+   */
+  outcome::result<void> forEachChangedValue(
+      const PolkadotTrie &prev,
+      const PolkadotTrie &next,
+      gsl::span<const common::Buffer> keys,
+      const OnChangedValue &callback);
+
+}  // namespace kagome::storage::trie
+
+#endif  // KAGOME_STORAGE_TRIE_POLKADOT_TRIE_DIFF_HPP
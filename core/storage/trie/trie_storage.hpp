@@ -30,6 +30,14 @@ namespace kagome::storage::trie {
      */
     virtual outcome::result<std::unique_ptr<PersistentTrieBatch>>
     getPersistentBatchAt(const RootHash &root) = 0;
+
+    /**
+     * Initializes a batch at the provided state, changes of which are not
+     * reported to storage changes tracker, e.g. to load a state of many
+     * entries without keeping them in memory
+     */
+    virtual outcome::result<std::unique_ptr<PersistentTrieBatch>>
+    getUntrackedPersistentBatchAt(const RootHash &root) = 0;
     virtual outcome::result<std::unique_ptr<EphemeralTrieBatch>>
     getEphemeralBatchAt(const RootHash &root) const = 0;
   };
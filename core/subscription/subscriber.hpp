@@ -51,7 +51,7 @@ namespace kagome::subscription {
    private:
     using SubscriptionsContainer =
         std::unordered_map<EventType,
-                           typename SubscriptionEngineType::IteratorType>;
+                           typename SubscriptionEngineType::SubscriptionId>;
     using SubscriptionsSets =
         std::unordered_map<SubscriptionSetId, SubscriptionsContainer>;
     SubscriptionEnginePtr engine_;
@@ -92,7 +92,7 @@ namespace kagome::subscription {
     void subscribe(SubscriptionSetId id, const EventType &key) {
       std::lock_guard lock(subscriptions_cs_);
       auto &&[it, inserted] = subscriptions_sets_[id].emplace(
-          key, typename SubscriptionEngineType::IteratorType{});
+          key, typename SubscriptionEngineType::SubscriptionId{});
 
       /// Here we check first local subscriptions because of strong connection
       /// with SubscriptionEngine.
@@ -6,10 +6,12 @@
 #ifndef KAGOME_SUBSCRIPTION_ENGINE_HPP
 #define KAGOME_SUBSCRIPTION_ENGINE_HPP
 
-#include <list>
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace kagome::subscription {
 
@@ -19,6 +21,12 @@ namespace kagome::subscription {
   using SubscriptionSetId = uint32_t;
 
   /**
+   * Subscribers of each key are stored in a contiguous snapshot. Notification
+   * holds the lock only to take the snapshot of the key, and neither blocks
+   * nor is blocked by (un)subscribing while it calls the subscribers. The
+   * snapshot is changed in place unless it's held by a notification, then it
+   * is replaced by a modified copy. So a series of subscriptions to the same
+   * key costs O(n) in total, and O(n) per subscription only while notified.
    * @tparam EventKey - the type of a specific event from event set (e. g. a key
    * from a storage or a particular kind of event from an enumeration)
    * @tparam Receiver - the type of an object that is a part of a Subscriber
@@ -37,20 +45,23 @@ namespace kagome::subscription {
         Subscriber<EventKeyType, ReceiverType, EventParams...>;
     using SubscriberWeakPtr = std::weak_ptr<SubscriberType>;
 
-    /// List is preferable here because this container iterators remain
-    /// alive after removal from the middle of the container
-    /// TODO(iceseer): PRE-476 remove processor cache penalty, while iterating,
-    /// using custom allocator
-    using SubscribersContainer =
-        std::list<std::pair<SubscriptionSetId, SubscriberWeakPtr>>;
-    using IteratorType = typename SubscribersContainer::iterator;
+    /// Identifies a subscription of a subscriber to a key, to unsubscribe it
+    using SubscriptionId = uint64_t;
+
+    struct SubscriptionEntry {
+      SubscriptionId id;
+      SubscriptionSetId set_id;
+      SubscriberWeakPtr subscriber;
+    };
+    using SubscribersContainer = std::vector<SubscriptionEntry>;
+    using SubscribersSnapshot = std::shared_ptr<const SubscribersContainer>;
 
    public:
     SubscriptionEngine() = default;
     ~SubscriptionEngine() = default;
 
-    SubscriptionEngine(SubscriptionEngine &&) = default;             // NOLINT
-    SubscriptionEngine &operator=(SubscriptionEngine &&) = default;  // NOLINT
+    SubscriptionEngine(SubscriptionEngine &&) = delete;
+    SubscriptionEngine &operator=(SubscriptionEngine &&) = delete;
 
     SubscriptionEngine(const SubscriptionEngine &) = delete;
     SubscriptionEngine &operator=(const SubscriptionEngine &) = delete;
@@ -59,58 +70,88 @@ namespace kagome::subscription {
     template <typename KeyType, typename ValueType, typename... Args>
     friend class Subscriber;
     using KeyValueContainer =
-        std::unordered_map<EventKeyType, SubscribersContainer>;
+        std::unordered_map<EventKeyType,
+                           std::shared_ptr<SubscribersContainer>>;
 
     mutable std::shared_mutex subscribers_map_cs_;
     KeyValueContainer subscribers_map_;
+    SubscriptionId last_subscription_id_ = 0;
+
+    /**
+     * Subscribers of a key to be changed, the lock must be held uniquely.
+     * Snapshots are shared only under the lock, so the only owner of the
+     * snapshot is the engine, and no notification can see the change
+     */
+    static SubscribersContainer &modifiable(
+        std::shared_ptr<SubscribersContainer> &subscribers) {
+      if (subscribers == nullptr) {
+        subscribers = std::make_shared<SubscribersContainer>();
+      } else if (subscribers.use_count() != 1) {
+        subscribers = std::make_shared<SubscribersContainer>(*subscribers);
+      } else {
+        // pairs with release of the snapshot by the last notification
+        std::atomic_thread_fence(std::memory_order_acquire);
+      }
+      return *subscribers;
+    }
 
-    IteratorType subscribe(SubscriptionSetId set_id,
-                           const EventKeyType &key,
-                           SubscriberWeakPtr ptr) {
+    SubscriptionId subscribe(SubscriptionSetId set_id,
+                             const EventKeyType &key,
+                             SubscriberWeakPtr ptr) {
       std::unique_lock lock(subscribers_map_cs_);
-      auto &subscribers_list = subscribers_map_[key];
-      return subscribers_list.emplace(subscribers_list.end(),
-                                      std::make_pair(set_id, std::move(ptr)));
+      auto id = ++last_subscription_id_;
+      modifiable(subscribers_map_[key])
+          .emplace_back(SubscriptionEntry{id, set_id, std::move(ptr)});
+      return id;
     }
 
-    void unsubscribe(const EventKeyType &key, const IteratorType &it_remove) {
+    void unsubscribe(const EventKeyType &key, SubscriptionId id) {
       std::unique_lock lock(subscribers_map_cs_);
       auto it = subscribers_map_.find(key);
-      if (subscribers_map_.end() != it) {
-        it->second.erase(it_remove);
-        if (it->second.empty()) subscribers_map_.erase(it);
+      if (subscribers_map_.end() == it) return;
+
+      auto &subscribers = modifiable(it->second);
+      subscribers.erase(
+          std::remove_if(subscribers.begin(),
+                         subscribers.end(),
+                         [id](const SubscriptionEntry &entry) {
+                           // also drops entries of destroyed subscribers
+                           return entry.id == id or entry.subscriber.expired();
+                         }),
+          subscribers.end());
+      if (subscribers.empty()) {
+        subscribers_map_.erase(it);
       }
     }
 
-   public:
-    size_t size(const EventKeyType &key) const {
+    SubscribersSnapshot snapshot(const EventKeyType &key) const {
       std::shared_lock lock(subscribers_map_cs_);
       if (auto it = subscribers_map_.find(key); it != subscribers_map_.end())
-        return it->second.size();
+        return it->second;
 
-      return 0ull;
+      return nullptr;
+    }
+
+   public:
+    size_t size(const EventKeyType &key) const {
+      auto subscribers = snapshot(key);
+      return subscribers != nullptr ? subscribers->size() : 0ull;
     }
 
     size_t size() const {
       std::shared_lock lock(subscribers_map_cs_);
       size_t count = 0ull;
-      for (auto &it : subscribers_map_) count += it.second.size();
+      for (auto &it : subscribers_map_) count += it.second->size();
       return count;
     }
 
     void notify(const EventKeyType &key, const EventParams &...args) {
-      std::shared_lock lock(subscribers_map_cs_);
-      auto it = subscribers_map_.find(key);
-      if (subscribers_map_.end() == it) return;
+      auto subscribers = snapshot(key);
+      if (subscribers == nullptr) return;
 
-      auto &subscribers_container = it->second;
-      for (auto it_sub = subscribers_container.begin();
-           it_sub != subscribers_container.end();) {
-        if (auto sub = it_sub->second.lock()) {
-          sub->on_notify(it_sub->first, key, args...);
-          ++it_sub;
-        } else {
-          it_sub = subscribers_container.erase(it_sub);
+      for (auto &entry : *subscribers) {
+        if (auto sub = entry.subscriber.lock()) {
+          sub->on_notify(entry.set_id, key, args...);
         }
       }
     }
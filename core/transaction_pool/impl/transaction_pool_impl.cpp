@@ -5,10 +5,15 @@
 
 #include "transaction_pool/impl/transaction_pool_impl.hpp"
 
+#include <unordered_set>
+
+#include <gsl/gsl_util>
+
 #include "crypto/hasher.hpp"
 #include "network/transactions_transmitter.hpp"
 #include "primitives/block_id.hpp"
 #include "runtime/runtime_api/tagged_transaction_queue.hpp"
+#include "scale/scale.hpp"
 #include "transaction_pool/transaction_pool_error.hpp"
 
 using kagome::primitives::BlockNumber;
@@ -21,6 +26,39 @@ namespace {
 
 namespace kagome::transaction_pool {
 
+  namespace detail {
+
+    bool ShardedHashSet::contains(const Transaction::Hash &hash) const {
+      auto &shard = this->shard(hash);
+      std::shared_lock lock{shard.mutex};
+      return shard.hashes.count(hash) != 0;
+    }
+
+    bool ShardedHashSet::add(const Transaction::Hash &hash) {
+      auto &shard = this->shard(hash);
+      std::unique_lock lock{shard.mutex};
+      return shard.hashes.emplace(hash).second;
+    }
+
+    void ShardedHashSet::remove(const Transaction::Hash &hash) {
+      auto &shard = this->shard(hash);
+      std::unique_lock lock{shard.mutex};
+      shard.hashes.erase(hash);
+    }
+
+    const ShardedHashSet::Shard &ShardedHashSet::shard(
+        const Transaction::Hash &hash) const {
+      // Hashes are uniformly distributed, so any byte is good for sharding
+      return shards_[hash[0] % kShards];
+    }
+
+    ShardedHashSet::Shard &ShardedHashSet::shard(
+        const Transaction::Hash &hash) {
+      return shards_[hash[0] % kShards];
+    }
+
+  }  // namespace detail
+
   using primitives::events::ExtrinsicEventType;
   using primitives::events::ExtrinsicLifecycleEvent;
 
@@ -60,6 +98,42 @@ namespace kagome::transaction_pool {
     metric_ready_txs_->set(0);
   }
 
+  template <typename F>
+  auto TransactionPoolImpl::locked(F &&f) {
+    std::vector<PendingEvent> events;
+    // Destroyed in reverse order: events are taken under the lock, and sent
+    // after it's released, even if f returns early
+    auto send = gsl::finally([&] { sendEvents(events); });
+    std::lock_guard lock{mutex_};
+    auto take = gsl::finally([&] { events.swap(pending_events_); });
+    return std::forward<F>(f)();
+  }
+
+  void TransactionPoolImpl::notify(const Transaction::Hash &hash,
+                                   ExtrinsicEventType type,
+                                   bool last) {
+    pending_events_.emplace_back(PendingEvent{hash, type, last});
+  }
+
+  void TransactionPoolImpl::sendEvents(
+      const std::vector<PendingEvent> &events) {
+    for (auto &event : events) {
+      auto key = ext_key_repo_->get(event.hash);
+      if (not key.has_value()) {
+        continue;
+      }
+      sub_engine_->notify(
+          key.value(),
+          ExtrinsicLifecycleEvent{key.value(),
+                                  event.type,
+                                  ExtrinsicLifecycleEvent::Params{
+                                      std::nullopt}});
+      if (event.last) {
+        ext_key_repo_->remove(event.hash);
+      }
+    }
+  }
+
   outcome::result<primitives::Transaction>
   TransactionPoolImpl::constructTransaction(
       primitives::TransactionSource source,
@@ -80,7 +154,10 @@ namespace kagome::transaction_pool {
         [&](const primitives::ValidTransaction &v)
             -> outcome::result<primitives::Transaction> {
           common::Hash256 hash = hasher_->blake2b_256(extrinsic.data);
-          size_t length = extrinsic.data.size();
+          // size of encoded extrinsic is cached for block authoring
+          scale::ScaleEncoderStream s(true);
+          s << extrinsic;
+          size_t length = s.size();
 
           return primitives::Transaction{extrinsic,
                                          length,
@@ -89,15 +166,26 @@ namespace kagome::transaction_pool {
                                          v.longevity,
                                          v.requires,
                                          v.provides,
-                                         v.propagate};
+                                         v.propagate,
+                                         source};
         });
   }
 
   outcome::result<Transaction::Hash> TransactionPoolImpl::submitExtrinsic(
       primitives::TransactionSource source, primitives::Extrinsic extrinsic) {
+    // Fast path for duplicates, without runtime call and locking the pool
+    if (known_txs_.contains(hasher_->blake2b_256(extrinsic.data))) {
+      return TransactionPoolError::TX_ALREADY_IMPORTED;
+    }
+
     OUTCOME_TRY(tx, constructTransaction(source, extrinsic));
 
-    if (tx.should_propagate && !imported_txs_.count(tx.hash)) {
+    return submitTransaction(std::move(tx));
+  }
+
+  outcome::result<Transaction::Hash> TransactionPoolImpl::submitTransaction(
+      Transaction &&tx) {
+    if (tx.should_propagate && !known_txs_.contains(tx.hash)) {
       tx_transmitter_->propagateTransactions(gsl::make_span(std::vector{tx}));
     }
     auto hash = tx.hash;
@@ -108,7 +196,12 @@ namespace kagome::transaction_pool {
   }
 
   outcome::result<void> TransactionPoolImpl::submitOne(Transaction &&tx) {
-    return submitOne(std::make_shared<Transaction>(std::move(tx)));
+    return locked([&]() -> outcome::result<void> {
+      auto hash = tx.hash;
+      OUTCOME_TRY(submitOne(std::make_shared<Transaction>(std::move(tx))));
+      revalidation_order_.emplace_back(std::move(hash));
+      return outcome::success();
+    });
   }
 
   outcome::result<void> TransactionPoolImpl::submitOne(
@@ -116,15 +209,14 @@ namespace kagome::transaction_pool {
     if (auto [_, ok] = imported_txs_.emplace(tx->hash, tx); !ok) {
       return TransactionPoolError::TX_ALREADY_IMPORTED;
     }
+    known_txs_.add(tx->hash);
 
     auto processResult = processTransaction(tx);
     if (processResult.has_error()
         && processResult.error() == TransactionPoolError::POOL_IS_FULL) {
-      if (auto key = ext_key_repo_->get(tx->hash); key.has_value()) {
-        sub_engine_->notify(key.value(),
-                            ExtrinsicLifecycleEvent::Dropped(key.value()));
-      }
+      notify(tx->hash, ExtrinsicEventType::DROPPED);
       imported_txs_.erase(tx->hash);
+      known_txs_.remove(tx->hash);
     } else {
       SL_DEBUG(logger_,
                "Extrinsic {} with hash {} was added to the pool",
@@ -164,10 +256,7 @@ namespace kagome::transaction_pool {
   void TransactionPoolImpl::postponeTransaction(
       const std::shared_ptr<Transaction> &tx) {
     postponed_txs_.push_back(tx);
-    if (auto key = ext_key_repo_->get(tx->hash); key.has_value()) {
-      sub_engine_->notify(key.value(),
-                          ExtrinsicLifecycleEvent::Future(key.value()));
-    }
+    notify(tx->hash, ExtrinsicEventType::FUTURE);
   }
 
   outcome::result<void> TransactionPoolImpl::processTransactionAsWaiting(
@@ -192,14 +281,24 @@ namespace kagome::transaction_pool {
     for (auto &tag : tx->requires) {
       tx_waits_tag_.emplace(tag, tx);
     }
-    if (auto key = ext_key_repo_->get(tx->hash); key.has_value()) {
-      sub_engine_->notify(key.value(),
-                          ExtrinsicLifecycleEvent::Future(key.value()));
-    }
+    notify(tx->hash, ExtrinsicEventType::FUTURE);
   }
 
   outcome::result<Transaction> TransactionPoolImpl::removeOne(
       const Transaction::Hash &tx_hash) {
+    return locked([&] { return removeAndTouchTags(tx_hash); });
+  }
+
+  outcome::result<Transaction> TransactionPoolImpl::removeAndTouchTags(
+      const Transaction::Hash &tx_hash) {
+    OUTCOME_TRY(tx, removeTransaction(tx_hash));
+    // Validity of transactions sharing tags with removed one might change
+    touched_tags_.insert(tx.provides.begin(), tx.provides.end());
+    return std::move(tx);
+  }
+
+  outcome::result<Transaction> TransactionPoolImpl::removeTransaction(
+      const Transaction::Hash &tx_hash) {
     auto tx_node = imported_txs_.extract(tx_hash);
     if (tx_node.empty()) {
       SL_TRACE(logger_,
@@ -208,6 +307,7 @@ namespace kagome::transaction_pool {
       return TransactionPoolError::TX_NOT_FOUND;
     }
     const auto &tx = tx_node.mapped();
+    known_txs_.remove(tx_hash);
 
     unsetReady(tx);
     delTransactionAsWaiting(tx);
@@ -243,7 +343,7 @@ namespace kagome::transaction_pool {
       const std::shared_ptr<Transaction> &tx) {
     for (auto &tag : tx->requires) {
       auto range = tx_waits_tag_.equal_range(tag);
-      for (auto i = range.first; i != range.second;) {
+      for (auto i = range.first; i != range.second; ++i) {
         if (i->second.lock() == tx) {
           tx_waits_tag_.erase(i);
           break;
@@ -254,17 +354,92 @@ namespace kagome::transaction_pool {
 
   std::map<Transaction::Hash, std::shared_ptr<Transaction>>
   TransactionPoolImpl::getReadyTransactions() const {
+    std::lock_guard lock{mutex_};
     std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready;
     std::for_each(ready_txs_.begin(), ready_txs_.end(), [&ready](auto it) {
-      if (auto tx = it.second.lock()) {
+      if (auto tx = it.second.tx.lock()) {
         ready.emplace(it.first, std::move(tx));
       }
     });
     return ready;
   }
 
-  const std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
-      &TransactionPoolImpl::getPendingTransactions() const {
+  void TransactionPoolImpl::forEachReadyTransaction(
+      const ReadyTransactionVisitor &visitor) const {
+    using ReadyEntry =
+        std::pair<ReadyOrder, std::shared_ptr<const Transaction>>;
+
+    // Snapshot of ready transactions, so that the pool is not locked while
+    // visitor runs (e.g. applies extrinsics during block production).
+    // Transactions are not changed in place, so their tags are stable
+    std::vector<ReadyEntry> best;
+    std::multimap<Transaction::Tag, ReadyEntry> dependents;
+    {
+      std::lock_guard lock{mutex_};
+      best.reserve(best_ready_txs_.size());
+      for (auto &[order, weak_tx] : best_ready_txs_) {
+        if (auto tx = weak_tx.lock()) {
+          best.emplace_back(order, std::move(tx));
+        }
+      }
+      for (auto &[hash, ready] : ready_txs_) {
+        auto tx = ready.tx.lock();
+        if (not tx) {
+          continue;
+        }
+        for (auto &tag : tx->requires) {
+          dependents.emplace(tag, ReadyEntry{ready.order, tx});
+        }
+      }
+    }
+
+    // Tags provided by taken transactions
+    std::set<Transaction::Tag> provided;
+    // Transactions, all required tags of which are provided by taken ones
+    std::map<ReadyOrder, std::shared_ptr<const Transaction>> unlocked;
+
+    auto best_it = best.begin();
+    while (true) {
+      std::shared_ptr<const Transaction> tx;
+      if (best_it != best.end()
+          and (unlocked.empty() or best_it->first < unlocked.begin()->first)) {
+        tx = (best_it++)->second;
+      } else if (not unlocked.empty()) {
+        tx = std::move(unlocked.extract(unlocked.begin()).mapped());
+      } else {
+        break;
+      }
+
+      auto visit = visitor(tx);
+      if (visit == Visit::STOP) {
+        return;
+      }
+      if (visit == Visit::SKIPPED) {
+        continue;
+      }
+
+      for (auto &tag : tx->provides) {
+        if (not provided.emplace(tag).second) {
+          continue;
+        }
+        auto range = dependents.equal_range(tag);
+        for (auto it = range.first; it != range.second; ++it) {
+          auto &[order, dependent] = it->second;
+          if (std::all_of(dependent->requires.begin(),
+                          dependent->requires.end(),
+                          [&](auto &required) {
+                            return provided.count(required) != 0;
+                          })) {
+            unlocked.emplace(order, dependent);
+          }
+        }
+      }
+    }
+  }
+
+  std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
+  TransactionPoolImpl::getPendingTransactions() const {
+    std::lock_guard lock{mutex_};
     return imported_txs_;
   }
 
@@ -272,32 +447,30 @@ namespace kagome::transaction_pool {
       const primitives::BlockId &at) {
     OUTCOME_TRY(number, header_repo_->getNumberById(at));
 
-    std::vector<Transaction::Hash> remove_to;
+    return locked([&]() -> outcome::result<std::vector<Transaction>> {
+      std::vector<Transaction::Hash> remove_to;
 
-    for (auto &[txHash, tx] : imported_txs_) {
-      if (moderator_->banIfStale(number, *tx)) {
-        remove_to.emplace_back(txHash);
+      for (auto &[txHash, tx] : imported_txs_) {
+        if (moderator_->banIfStale(number, *tx)) {
+          remove_to.emplace_back(txHash);
+        }
       }
-    }
 
-    for (auto &tx_hash : remove_to) {
-      OUTCOME_TRY(tx, removeOne(tx_hash));
-      if (auto key = ext_key_repo_->get(tx.hash); key.has_value()) {
-        sub_engine_->notify(key.value(),
-                            ExtrinsicLifecycleEvent::Dropped(key.value()));
-        ext_key_repo_->remove(tx.hash);
+      for (auto &tx_hash : remove_to) {
+        OUTCOME_TRY(tx, removeAndTouchTags(tx_hash));
+        notify(tx.hash, ExtrinsicEventType::DROPPED, true);
       }
-    }
 
-    moderator_->updateBan();
+      moderator_->updateBan();
 
-    return outcome::success();
+      return outcome::success();
+    });
   }
 
   bool TransactionPoolImpl::isInReady(
       const std::shared_ptr<const Transaction> &tx) const {
     auto i = ready_txs_.find(tx->hash);
-    return i != ready_txs_.end() && !i->second.expired();
+    return i != ready_txs_.end() && !i->second.tx.expired();
   }
 
   bool TransactionPoolImpl::checkForReady(
@@ -310,11 +483,12 @@ namespace kagome::transaction_pool {
   }
 
   void TransactionPoolImpl::setReady(const std::shared_ptr<Transaction> &tx) {
-    if (auto [_, ok] = ready_txs_.emplace(tx->hash, tx); ok) {
-      if (auto key = ext_key_repo_->get(tx->hash); key.has_value()) {
-        sub_engine_->notify(key.value(),
-                            ExtrinsicLifecycleEvent::Ready(key.value()));
+    ReadyOrder order{tx->priority, next_ready_sequence_++};
+    if (auto [_, ok] = ready_txs_.emplace(tx->hash, ReadyTx{tx, order}); ok) {
+      if (tx->requires.empty()) {
+        best_ready_txs_.emplace(order, tx);
       }
+      notify(tx->hash, ExtrinsicEventType::READY);
       commitRequiredTags(tx);
       commitProvidedTags(tx);
       metric_ready_txs_->set(ready_txs_.size());
@@ -361,13 +535,11 @@ namespace kagome::transaction_pool {
 
   void TransactionPoolImpl::unsetReady(const std::shared_ptr<Transaction> &tx) {
     if (auto tx_node = ready_txs_.extract(tx->hash); !tx_node.empty()) {
+      best_ready_txs_.erase(tx_node.mapped().order);
       metric_ready_txs_->set(ready_txs_.size());
       rollbackRequiredTags(tx);
       rollbackProvidedTags(tx);
-      if (auto key = ext_key_repo_->get(tx->hash); key.has_value()) {
-        sub_engine_->notify(key.value(),
-                            ExtrinsicLifecycleEvent::Future(key.value()));
-      }
+      notify(tx->hash, ExtrinsicEventType::FUTURE);
     }
   }
 
@@ -406,7 +578,121 @@ namespace kagome::transaction_pool {
     }
   }
 
+  std::vector<std::shared_ptr<const Transaction>>
+  TransactionPoolImpl::getTransactionsToRevalidate(size_t limit) {
+    std::lock_guard lock{mutex_};
+    std::vector<std::shared_ptr<const Transaction>> txs;
+    std::unordered_set<Transaction::Hash> selected;
+    auto select = [&](const std::shared_ptr<Transaction> &tx) {
+      if (tx and imported_txs_.count(tx->hash) != 0
+          and selected.emplace(tx->hash).second) {
+        txs.emplace_back(tx);
+      }
+    };
+
+    // Transactions sharing tags with removed ones go first
+    for (auto tag_it = touched_tags_.begin();
+         tag_it != touched_tags_.end() and txs.size() < limit;) {
+      auto &tag = *tag_it;
+      bool all_selected = true;
+      for (auto *index :
+           {&tx_waits_tag_, &tx_depends_on_tag_, &tx_provides_tag_}) {
+        auto range = index->equal_range(tag);
+        for (auto it = range.first; it != range.second; ++it) {
+          if (txs.size() == limit) {
+            all_selected = false;
+            break;
+          }
+          select(it->second.lock());
+        }
+      }
+      if (not all_selected) {
+        break;
+      }
+      tag_it = touched_tags_.erase(tag_it);
+    }
+
+    // The rest are taken in round-robin order
+    for (auto n = revalidation_order_.size(); n > 0 and txs.size() < limit;
+         --n) {
+      auto hash = std::move(revalidation_order_.front());
+      revalidation_order_.pop_front();
+      auto it = imported_txs_.find(hash);
+      if (it == imported_txs_.end()) {
+        // already removed
+        continue;
+      }
+      select(it->second);
+      revalidation_order_.emplace_back(std::move(hash));
+    }
+
+    return txs;
+  }
+
+  void TransactionPoolImpl::onRevalidated(
+      const Transaction::Hash &tx_hash,
+      const primitives::TransactionValidity &validity) {
+    locked([&] { applyRevalidation(tx_hash, validity); });
+  }
+
+  void TransactionPoolImpl::applyRevalidation(
+      const Transaction::Hash &tx_hash,
+      const primitives::TransactionValidity &validity) {
+    auto it = imported_txs_.find(tx_hash);
+    if (it == imported_txs_.end()) {
+      // removed while being revalidated
+      return;
+    }
+    auto tx = it->second;
+
+    visit_in_place(
+        validity,
+        [&](const primitives::TransactionValidityError &error) {
+          if (boost::get<primitives::UnknownTransaction>(&error) != nullptr) {
+            SL_DEBUG(logger_,
+                     "Validity of extrinsic with hash {} is unknown, it's kept "
+                     "in the pool",
+                     tx_hash);
+            return;
+          }
+          if (auto res = removeAndTouchTags(tx_hash); res.has_error()) {
+            return;
+          }
+          moderator_->ban(tx_hash);
+          SL_DEBUG(logger_,
+                   "Extrinsic with hash {} became invalid and was removed from "
+                   "the pool",
+                   tx_hash);
+          notify(tx_hash, ExtrinsicEventType::INVALID, true);
+        },
+        [&](const primitives::ValidTransaction &valid) {
+          if (valid.priority == tx->priority and valid.requires == tx->requires
+              and valid.provides == tx->provides) {
+            return;
+          }
+          auto updated = std::make_shared<Transaction>(*tx);
+          updated->priority = valid.priority;
+          updated->valid_till = valid.longevity;
+          updated->requires = valid.requires;
+          updated->provides = valid.provides;
+          updated->should_propagate = valid.propagate;
+
+          // Reimported to take its place by new priority and tags
+          if (auto res = removeTransaction(tx_hash); res.has_error()) {
+            return;
+          }
+          if (auto res = submitOne(updated); res.has_error()) {
+            SL_DEBUG(logger_,
+                     "Revalidated extrinsic with hash {} was not reimported: "
+                     "{}",
+                     tx_hash,
+                     res.error().message());
+          }
+        });
+  }
+
   TransactionPoolImpl::Status TransactionPoolImpl::getStatus() const {
+    std::lock_guard lock{mutex_};
     return Status{ready_txs_.size(), imported_txs_.size() - ready_txs_.size()};
   }
 
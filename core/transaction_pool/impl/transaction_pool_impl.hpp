@@ -6,6 +6,14 @@
 #ifndef KAGOME_TRANSACTION_POOL_IMPL_HPP
 #define KAGOME_TRANSACTION_POOL_IMPL_HPP
 
+#include <array>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <unordered_set>
+#include <vector>
+
 #include "blockchain/block_header_repository.hpp"
 #include "log/logger.hpp"
 #include "metrics/metrics.hpp"
@@ -28,6 +36,45 @@ namespace kagome::network {
 
 namespace kagome::transaction_pool {
 
+  namespace detail {
+
+    /**
+     * Set of transaction hashes split into shards with own locks, so that
+     * concurrent lookups and updates of different hashes rarely contend
+     */
+    class ShardedHashSet {
+     public:
+      static constexpr size_t kShards = 16;
+
+      bool contains(const Transaction::Hash &hash) const;
+
+      /// @return false if the hash is already contained
+      bool add(const Transaction::Hash &hash);
+
+      void remove(const Transaction::Hash &hash);
+
+     private:
+      struct Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_set<Transaction::Hash> hashes;
+      };
+
+      const Shard &shard(const Transaction::Hash &hash) const;
+      Shard &shard(const Transaction::Hash &hash);
+
+      std::array<Shard, kShards> shards_;
+    };
+
+  }  // namespace detail
+
+  /**
+   * Transaction pool is safe to be used from many threads. Transactions are
+   * validated and hashed before the pool is locked, and already imported
+   * transactions are rejected by sharded set of their hashes without locking
+   * the pool and calling runtime at all. Changes of the dependency graph are
+   * serialized by the pool lock, because tags connect transactions of
+   * different senders.
+   */
   class TransactionPoolImpl : public TransactionPool {
    public:
     TransactionPoolImpl(
@@ -41,7 +88,7 @@ namespace kagome::transaction_pool {
         std::shared_ptr<subscription::ExtrinsicEventKeyRepository> ext_key_repo,
         Limits limits);
 
-    TransactionPoolImpl(TransactionPoolImpl &&) = default;
+    TransactionPoolImpl(TransactionPoolImpl &&) = delete;
     TransactionPoolImpl(const TransactionPoolImpl &) = delete;
 
     ~TransactionPoolImpl() override = default;
@@ -49,13 +96,16 @@ namespace kagome::transaction_pool {
     TransactionPoolImpl &operator=(TransactionPoolImpl &&) = delete;
     TransactionPoolImpl &operator=(const TransactionPoolImpl &) = delete;
 
-    const std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
-        &getPendingTransactions() const override;
+    std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
+    getPendingTransactions() const override;
 
     outcome::result<Transaction::Hash> submitExtrinsic(
         primitives::TransactionSource source,
         primitives::Extrinsic extrinsic) override;
 
+    outcome::result<Transaction::Hash> submitTransaction(
+        Transaction &&tx) override;
+
     outcome::result<void> submitOne(Transaction &&tx) override;
 
     outcome::result<Transaction> removeOne(
@@ -64,9 +114,19 @@ namespace kagome::transaction_pool {
     std::map<Transaction::Hash, std::shared_ptr<Transaction>>
     getReadyTransactions() const override;
 
+    void forEachReadyTransaction(
+        const ReadyTransactionVisitor &visitor) const override;
+
     outcome::result<std::vector<Transaction>> removeStale(
         const primitives::BlockId &at) override;
 
+    std::vector<std::shared_ptr<const Transaction>>
+    getTransactionsToRevalidate(size_t limit) override;
+
+    void onRevalidated(
+        const Transaction::Hash &tx_hash,
+        const primitives::TransactionValidity &validity) override;
+
     Status getStatus() const override;
 
     outcome::result<primitives::Transaction> constructTransaction(
@@ -74,8 +134,57 @@ namespace kagome::transaction_pool {
         primitives::Extrinsic extrinsic) const override;
 
    private:
+    /// Place of ready transaction in order of visiting
+    struct ReadyOrder {
+      Transaction::Priority priority;
+      /// Sequential number of becoming ready
+      uint64_t sequence;
+
+      bool operator<(const ReadyOrder &other) const {
+        return priority > other.priority
+            or (priority == other.priority and sequence < other.sequence);
+      }
+    };
+
+    struct ReadyTx {
+      std::weak_ptr<Transaction> tx;
+      ReadyOrder order;
+    };
+
+    /// Lifecycle event of extrinsic, which is sent after the pool is unlocked
+    struct PendingEvent {
+      Transaction::Hash hash;
+      primitives::events::ExtrinsicEventType type;
+      /// Whether the event is final, so the key of extrinsic is forgotten
+      bool last;
+    };
+
+    /// Calls {@param f} under the pool lock, then sends events it queued
+    template <typename F>
+    auto locked(F &&f);
+
+    /// Queues event of extrinsic {@param hash} for its subscribers
+    void notify(const Transaction::Hash &hash,
+                primitives::events::ExtrinsicEventType type,
+                bool last = false);
+
+    void sendEvents(const std::vector<PendingEvent> &events);
+
     outcome::result<void> submitOne(const std::shared_ptr<Transaction> &tx);
 
+    /// Removes transaction and marks its tags as touched, pool must be locked
+    outcome::result<Transaction> removeAndTouchTags(
+        const Transaction::Hash &tx_hash);
+
+    /// Updates or removes transaction by result of its revalidation, pool
+    /// must be locked
+    void applyRevalidation(const Transaction::Hash &tx_hash,
+                           const primitives::TransactionValidity &validity);
+
+    /// Removes transaction without marking its tags as touched
+    outcome::result<Transaction> removeTransaction(
+        const Transaction::Hash &tx_hash);
+
     outcome::result<void> processTransaction(
         const std::shared_ptr<Transaction> &tx);
 
@@ -134,13 +243,29 @@ namespace kagome::transaction_pool {
     /// bans stale and invalid transactions for some amount of time
     std::unique_ptr<PoolModerator> moderator_;
 
+    /// Guards all the state below. Neither subscribers nor key repository
+    /// are called under it, their events are queued and sent after unlock
+    mutable std::mutex mutex_;
+
+    /// Events queued under the lock by current change of the pool
+    std::vector<PendingEvent> pending_events_;
+
+    /// Hashes of imported transactions, checked without locking the pool
+    detail::ShardedHashSet known_txs_;
+
     /// All of imported transaction, contained in the pool
     std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
         imported_txs_;
 
     /// Collection transaction with full-satisfied dependencies
-    std::unordered_map<Transaction::Hash, std::weak_ptr<Transaction>>
-        ready_txs_;
+    std::unordered_map<Transaction::Hash, ReadyTx> ready_txs_;
+
+    /// Ready transactions without required tags in order of visiting. Other
+    /// ready transactions are reached through the ones providing their tags
+    std::map<ReadyOrder, std::weak_ptr<Transaction>> best_ready_txs_;
+
+    /// Sequential number for the next transaction becoming ready
+    uint64_t next_ready_sequence_ = 0;
 
     /// List of ready transaction over limit. It will be process first of all
     std::list<std::weak_ptr<Transaction>> postponed_txs_;
@@ -156,6 +281,13 @@ namespace kagome::transaction_pool {
     /// Transactions with unresolved require of specific tags
     std::multimap<Transaction::Tag, std::weak_ptr<Transaction>> tx_waits_tag_;
 
+    /// Tags provided by removed transactions; transactions requiring or
+    /// providing them are revalidated first
+    std::set<Transaction::Tag> touched_tags_;
+
+    /// Hashes of imported transactions in order of revalidation
+    std::deque<Transaction::Hash> revalidation_order_;
+
     Limits limits_;
 
     // Metrics
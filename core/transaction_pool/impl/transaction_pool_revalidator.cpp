@@ -0,0 +1,198 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "transaction_pool/impl/transaction_pool_revalidator.hpp"
+
+#include <boost/asio/post.hpp>
+#include <fmt/format.h>
+#include <soralog/util.hpp>
+
+namespace {
+  constexpr const char *kRevalidatedTxs = "kagome_revalidated_transactions";
+  constexpr const char *kInvalidatedTxs = "kagome_invalidated_transactions";
+}  // namespace
+
+namespace kagome::transaction_pool {
+
+  TransactionPoolRevalidator::TransactionPoolRevalidator(
+      std::shared_ptr<application::AppStateManager> app_state_manager,
+      std::shared_ptr<TransactionPool> pool,
+      std::shared_ptr<runtime::TaggedTransactionQueue> ttq,
+      std::shared_ptr<blockchain::BlockTree> block_tree,
+      primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+      std::shared_ptr<boost::asio::io_context> main_context,
+      Config config)
+      : config_{config},
+        pool_{std::move(pool)},
+        ttq_{std::move(ttq)},
+        block_tree_{std::move(block_tree)},
+        chain_sub_engine_{std::move(chain_sub_engine)},
+        main_context_{std::move(main_context)},
+        log_{log::createLogger("TransactionPoolRevalidator", "transactions")} {
+    BOOST_ASSERT(app_state_manager != nullptr);
+    BOOST_ASSERT(pool_ != nullptr);
+    BOOST_ASSERT(ttq_ != nullptr);
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(chain_sub_engine_ != nullptr);
+    BOOST_ASSERT(main_context_ != nullptr);
+    BOOST_ASSERT(config_.threads > 0);
+    BOOST_ASSERT(config_.batch_size > 0);
+
+    // Register metrics
+    metrics_registry_->registerCounterFamily(
+        kRevalidatedTxs, "Number of revalidated pooled transactions");
+    metric_revalidated_ =
+        metrics_registry_->registerCounterMetric(kRevalidatedTxs);
+    metrics_registry_->registerCounterFamily(
+        kInvalidatedTxs,
+        "Number of pooled transactions found invalid by revalidation");
+    metric_invalidated_ =
+        metrics_registry_->registerCounterMetric(kInvalidatedTxs);
+
+    app_state_manager->takeControl(*this);
+  }
+
+  bool TransactionPoolRevalidator::prepare() {
+    chain_subscription_ =
+        std::make_shared<primitives::events::ChainEventSubscriber>(
+            chain_sub_engine_);
+    chain_subscription_->subscribe(
+        chain_subscription_->generateSubscriptionSetId(),
+        primitives::events::ChainEventType::kNewHeads);
+    chain_subscription_->setCallback(
+        [wp{weak_from_this()}](
+            auto set_id,
+            auto &receiver,
+            primitives::events::ChainEventType event_type,
+            const primitives::events::ChainEventParams &event_params) {
+          if (event_type != primitives::events::ChainEventType::kNewHeads) {
+            return;
+          }
+          if (auto self = wp.lock()) {
+            boost::asio::post(*self->main_context_, [wp] {
+              if (auto self = wp.lock()) {
+                self->onNewHead();
+              }
+            });
+          }
+        });
+    return true;
+  }
+
+  bool TransactionPoolRevalidator::start() {
+    io_context_ = std::make_shared<boost::asio::io_context>();
+    work_guard_.emplace(io_context_->get_executor());
+    threads_.reserve(config_.threads);
+    for (size_t i = 0; i < config_.threads; ++i) {
+      threads_.emplace_back([io_context{io_context_}, number{i + 1}] {
+        soralog::util::setThreadName(fmt::format("txs.reval.{}", number));
+        io_context->run();
+      });
+    }
+    return true;
+  }
+
+  void TransactionPoolRevalidator::stop() {
+    chain_subscription_.reset();
+    if (threads_.empty()) {
+      return;
+    }
+    work_guard_.reset();
+    io_context_->stop();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+    threads_.clear();
+  }
+
+  void TransactionPoolRevalidator::onNewHead() {
+    if (round_in_progress_) {
+      round_pending_ = true;
+      return;
+    }
+    if (not work_guard_.has_value()) {
+      return;
+    }
+
+    auto best_block = block_tree_->deepestLeaf();
+    if (best_block == last_best_block_) {
+      return;
+    }
+    last_best_block_ = best_block;
+
+    auto round = std::make_shared<Round>();
+    round->txs = pool_->getTransactionsToRevalidate(config_.batch_size);
+    if (round->txs.empty()) {
+      return;
+    }
+    round->results.resize(round->txs.size());
+    SL_DEBUG(log_,
+             "Revalidate {} transactions at new best block {}",
+             round->txs.size(),
+             best_block);
+
+    auto job_size = (round->txs.size() + config_.threads - 1) / config_.threads;
+    round->jobs = (round->txs.size() + job_size - 1) / job_size;
+    round_in_progress_ = true;
+    for (size_t begin = 0; begin < round->txs.size(); begin += job_size) {
+      auto end = std::min(begin + job_size, round->txs.size());
+      boost::asio::post(*io_context_,
+                        [wp{weak_from_this()}, round, begin, end] {
+                          if (auto self = wp.lock()) {
+                            self->validate(round, begin, end);
+                          }
+                        });
+    }
+  }
+
+  void TransactionPoolRevalidator::validate(const std::shared_ptr<Round> &round,
+                                            size_t begin,
+                                            size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      auto &tx = round->txs[i];
+      auto res = ttq_->validate_transaction(tx->source, tx->ext);
+      if (res.has_value()) {
+        round->results[i] = std::move(res.value());
+      } else {
+        SL_DEBUG(log_,
+                 "Revalidation of tx {} failed: {}",
+                 tx->hash,
+                 res.error().message());
+      }
+    }
+
+    if (--round->jobs == 0) {
+      boost::asio::post(*main_context_, [wp{weak_from_this()}, round] {
+        if (auto self = wp.lock()) {
+          self->applyRound(*round);
+        }
+      });
+    }
+  }
+
+  void TransactionPoolRevalidator::applyRound(const Round &round) {
+    for (size_t i = 0; i < round.txs.size(); ++i) {
+      auto &result = round.results[i];
+      if (not result.has_value()) {
+        continue;
+      }
+      metric_revalidated_->inc();
+      if (auto error =
+              boost::get<primitives::TransactionValidityError>(&*result);
+          error != nullptr
+          and boost::get<primitives::InvalidTransaction>(error) != nullptr) {
+        metric_invalidated_->inc();
+      }
+      pool_->onRevalidated(round.txs[i]->hash, result.value());
+    }
+
+    round_in_progress_ = false;
+    if (round_pending_) {
+      round_pending_ = false;
+      onNewHead();
+    }
+  }
+
+}  // namespace kagome::transaction_pool
@@ -0,0 +1,114 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TRANSACTION_POOL_REVALIDATOR_HPP
+#define KAGOME_TRANSACTION_POOL_REVALIDATOR_HPP
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "application/app_state_manager.hpp"
+#include "blockchain/block_tree.hpp"
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "primitives/event_types.hpp"
+#include "runtime/runtime_api/tagged_transaction_queue.hpp"
+#include "transaction_pool/transaction_pool.hpp"
+
+namespace kagome::transaction_pool {
+
+  /**
+   * Revalidates pooled transactions against state of each new best block on
+   * own worker threads, so that transactions invalidated by the block are
+   * evicted before block authoring tries to push them.
+   *
+   * Each round revalidates a bounded batch of transactions, ones sharing tags
+   * with transactions removed from the pool go first. Results are applied to
+   * the pool on the main thread. New best blocks appeared during a round are
+   * served by a single next round.
+   */
+  class TransactionPoolRevalidator final
+      : public std::enable_shared_from_this<TransactionPoolRevalidator> {
+   public:
+    struct Config {
+      /// Number of worker threads
+      size_t threads = 2;
+      /// Max amount of transactions revalidated after one new best block
+      size_t batch_size = 256;
+    };
+
+    TransactionPoolRevalidator(
+        std::shared_ptr<application::AppStateManager> app_state_manager,
+        std::shared_ptr<TransactionPool> pool,
+        std::shared_ptr<runtime::TaggedTransactionQueue> ttq,
+        std::shared_ptr<blockchain::BlockTree> block_tree,
+        primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+        std::shared_ptr<boost::asio::io_context> main_context,
+        Config config);
+
+    /** @see AppStateManager::takeControl */
+    bool prepare();
+
+    /** @see AppStateManager::takeControl */
+    bool start();
+
+    /** @see AppStateManager::takeControl */
+    void stop();
+
+   private:
+    struct Round {
+      std::vector<std::shared_ptr<const Transaction>> txs;
+      std::vector<std::optional<primitives::TransactionValidity>> results;
+      /// Number of jobs not finished yet
+      std::atomic_size_t jobs{0};
+    };
+
+    /// Starts new round if best block is changed and no round is in progress
+    void onNewHead();
+
+    /// Validates transactions of the round in range [begin, end)
+    void validate(const std::shared_ptr<Round> &round,
+                  size_t begin,
+                  size_t end);
+
+    /// Applies results of finished round to the pool
+    void applyRound(const Round &round);
+
+    const Config config_;
+    std::shared_ptr<TransactionPool> pool_;
+    std::shared_ptr<runtime::TaggedTransactionQueue> ttq_;
+    std::shared_ptr<blockchain::BlockTree> block_tree_;
+    primitives::events::ChainSubscriptionEnginePtr chain_sub_engine_;
+    primitives::events::ChainEventSubscriberPtr chain_subscription_;
+    std::shared_ptr<boost::asio::io_context> main_context_;
+
+    std::shared_ptr<boost::asio::io_context> io_context_;
+    using WorkGuard = boost::asio::executor_work_guard<
+        boost::asio::io_context::executor_type>;
+    std::optional<WorkGuard> work_guard_;
+    std::vector<std::thread> threads_;
+
+    // accessed on the main thread only
+    std::optional<primitives::BlockInfo> last_best_block_;
+    bool round_in_progress_ = false;
+    bool round_pending_ = false;
+
+    log::Logger log_;
+
+    // Metrics
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Counter *metric_revalidated_;
+    metrics::Counter *metric_invalidated_;
+  };
+
+}  // namespace kagome::transaction_pool
+
+#endif  // KAGOME_TRANSACTION_POOL_REVALIDATOR_HPP
@@ -6,6 +6,8 @@
 #ifndef KAGOME_TRANSACTION_POOL_HPP
 #define KAGOME_TRANSACTION_POOL_HPP
 
+#include <functional>
+
 #include <outcome/outcome.hpp>
 
 #include "primitives/block_id.hpp"
@@ -21,14 +23,26 @@ namespace kagome::transaction_pool {
     struct Status;
     struct Limits;
 
+    /// Decision of visitor of ready transactions
+    enum class Visit {
+      /// Transaction is taken, transactions depending on it may be visited
+      TAKEN,
+      /// Transaction is not taken, transactions depending on it are skipped
+      SKIPPED,
+      /// Visiting is finished
+      STOP,
+    };
+
+    using ReadyTransactionVisitor =
+        std::function<Visit(const std::shared_ptr<const Transaction> &)>;
+
     virtual ~TransactionPool() = default;
 
     /**
-     * @return pending transactions
+     * @return snapshot of pending transactions
      */
-    virtual const std::unordered_map<Transaction::Hash,
-                                     std::shared_ptr<Transaction>>
-        &getPendingTransactions() const = 0;
+    virtual std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
+    getPendingTransactions() const = 0;
 
     /**
      * Builds and validates transaction for provided extrinsic, and submit
@@ -43,6 +57,15 @@ namespace kagome::transaction_pool {
         primitives::TransactionSource source,
         primitives::Extrinsic extrinsic) = 0;
 
+    /**
+     * Submits transaction built by {@see constructTransaction} into the pool
+     * and propagates it if needed, i.e. is the second half of
+     * {@see submitExtrinsic}, so that validation may be done separately
+     * @return hash of successfully submitted transaction
+     */
+    virtual outcome::result<Transaction::Hash> submitTransaction(
+        Transaction &&tx) = 0;
+
     /**
      * Import one verified transaction to the pool. If it has unresolved
      * dependencies (requires tags of transactions that are not in the pool
@@ -67,6 +90,18 @@ namespace kagome::transaction_pool {
     virtual std::map<Transaction::Hash, std::shared_ptr<Transaction>>
     getReadyTransactions() const = 0;
 
+    /**
+     * Visits ready transactions from the best one: by descending priority, and
+     * in order of becoming ready for equal priority. Transaction is visited
+     * only after all transactions providing tags it requires were taken by
+     * {@param visitor}, so it goes after them regardless of its priority.
+     * Visited transactions are a snapshot taken under the pool lock, which is
+     * not held while {@param visitor} runs, so the pool remains available to
+     * other threads, and changes made meanwhile are not visited
+     */
+    virtual void forEachReadyTransaction(
+        const ReadyTransactionVisitor &visitor) const = 0;
+
     /**
      * Remove from the pool and temporarily ban transactions which longevity is
      * expired
@@ -78,6 +113,23 @@ namespace kagome::transaction_pool {
     virtual outcome::result<std::vector<Transaction>> removeStale(
         const primitives::BlockId &at) = 0;
 
+    /**
+     * @return up to {@param limit} pooled transactions to be revalidated
+     * against state of new best block. Transactions requiring or providing
+     * tags of ones removed from the pool since previous call go first, the
+     * rest are taken in round-robin order
+     */
+    virtual std::vector<std::shared_ptr<const Transaction>>
+    getTransactionsToRevalidate(size_t limit) = 0;
+
+    /**
+     * Applies result of revalidation of pooled transaction: invalid one is
+     * removed and banned, valid one gets its new priority and tags
+     */
+    virtual void onRevalidated(
+        const Transaction::Hash &tx_hash,
+        const primitives::TransactionValidity &validity) = 0;
+
     virtual Status getStatus() const = 0;
 
     virtual outcome::result<primitives::Transaction> constructTransaction(
@@ -61,6 +61,11 @@ int main(int argc, const char **argv) {
       return app->recovery();
     }
 
+    // Read-only RPC over database of another node
+    if (configuration.dbSecondaryPath().has_value()) {
+      return app->readOnlyRpc();
+    }
+
     app->run();
   }
 
@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/jrpc/raw_json.hpp"
+
+#include <gtest/gtest.h>
+
+#include "api/jrpc/custom_json_writer.hpp"
+#include "api/jrpc/value_converter.hpp"
+#include "testutil/literals.hpp"
+
+using kagome::api::JsonWriter;
+using kagome::api::makeRawJson;
+using kagome::api::makeValue;
+using kagome::common::Buffer;
+using kagome::primitives::BlockData;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::Extrinsic;
+using kagome::primitives::Justification;
+using kagome::primitives::PreRuntime;
+
+/// JSON text of {@param value} as it is written to response
+std::string toJson(const jsonrpc::Value &value) {
+  JsonWriter writer;
+  value.Write(writer);
+  auto data = writer.GetData();
+  return {data->GetData(), data->GetSize()};
+}
+
+/**
+ * @given block with header, digest, extrinsics and justification
+ * @when it is serialized right to JSON
+ * @then text is the same as written for value tree of the block
+ */
+TEST(RawJsonTest, BlockMatchesValueTree) {
+  BlockData block;
+  BlockHeader header;
+  header.parent_hash = "parent"_hash256;
+  header.number = 0x1234;
+  header.state_root = "state"_hash256;
+  header.extrinsics_root = "extrinsics"_hash256;
+  header.digest.emplace_back(PreRuntime{});
+  block.header = header;
+  block.body = {Extrinsic{"ext1"_buf}, Extrinsic{Buffer(100, 0xab)}};
+  block.justification = Justification{"just"_buf};
+
+  auto raw = makeRawJson(block);
+  ASSERT_TRUE(raw.IsBinary());
+  EXPECT_EQ(raw.AsBinary(), toJson(makeValue(block)));
+
+  block.body.reset();
+  block.justification.reset();
+  EXPECT_EQ(makeRawJson(block).AsBinary(), toJson(makeValue(block)));
+}
+
+/**
+ * @given keys of storage
+ * @when they are serialized right to JSON
+ * @then text is the same as written for value tree of the keys
+ */
+TEST(RawJsonTest, KeysMatchValueTree) {
+  std::vector<Buffer> keys{"key1"_buf, Buffer{}, "key3"_buf};
+  EXPECT_EQ(makeRawJson(keys).AsBinary(), toJson(makeValue(keys)));
+  EXPECT_EQ(makeRawJson(std::vector<Buffer>{}).AsBinary(), "[]");
+}
+
+/**
+ * @given pre-serialized result nested into other values
+ * @when it is written to response
+ * @then it is emitted verbatim, not as a string
+ */
+TEST(RawJsonTest, WrittenVerbatim) {
+  std::vector<Buffer> keys{"key1"_buf};
+  jsonrpc::Value::Array array{makeRawJson(keys), makeValue(keys)};
+  EXPECT_EQ(toJson(array), "[[\"0x6b657931\"],[\"0x6b657931\"]]");
+}
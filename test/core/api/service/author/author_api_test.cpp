@@ -63,7 +63,6 @@ using ::testing::ByRef;
 using ::testing::DoAll;
 using ::testing::InSequence;
 using ::testing::Return;
-using ::testing::ReturnRef;
 
 using testutil::createHash256;
 using testutil::DummyError;
@@ -496,7 +495,7 @@ TEST_F(AuthorApiTest, PendingExtrinsics) {
   std::vector<Extrinsic> expected_result;
 
   EXPECT_CALL(*transaction_pool, getPendingTransactions())
-      .WillOnce(ReturnRef(trxs));
+      .WillOnce(Return(trxs));
 
   ASSERT_OUTCOME_SUCCESS(actual_result, author_api->pendingExtrinsics());
   ASSERT_EQ(expected_result, actual_result);
@@ -17,8 +17,15 @@
 #include "mock/core/runtime/metadata_mock.hpp"
 #include "mock/core/runtime/raw_executor_mock.hpp"
 #include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "mock/core/storage/trie/serialization/trie_serializer_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
 #include "primitives/block_header.hpp"
+#include "storage/in_memory/in_memory_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 
@@ -33,7 +40,17 @@ using kagome::primitives::BlockInfo;
 using kagome::runtime::CoreMock;
 using kagome::runtime::MetadataMock;
 using kagome::runtime::RawExecutorMock;
+using kagome::storage::InMemoryStorage;
+using kagome::storage::trie::BranchNode;
+using kagome::storage::trie::DummyNode;
 using kagome::storage::trie::EphemeralTrieBatchMock;
+using kagome::storage::trie::PolkadotTrie;
+using kagome::storage::trie::PolkadotCodec;
+using kagome::storage::trie::PolkadotTrieFactoryImpl;
+using kagome::storage::trie::PolkadotTrieImpl;
+using kagome::storage::trie::TrieSerializerImpl;
+using kagome::storage::trie::TrieSerializerMock;
+using kagome::storage::trie::TrieStorageBackendImpl;
 using kagome::storage::trie::TrieStorageMock;
 using testing::_;
 using testing::ElementsAre;
@@ -46,6 +63,7 @@ namespace kagome::api {
     void SetUp() override {
       api_ = std::make_unique<api::StateApiImpl>(block_header_repo_,
                                                  storage_,
+                                                 trie_serializer_,
                                                  block_tree_,
                                                  runtime_core_,
                                                  metadata_,
@@ -55,6 +73,8 @@ namespace kagome::api {
    protected:
     std::shared_ptr<TrieStorageMock> storage_ =
         std::make_shared<TrieStorageMock>();
+    std::shared_ptr<TrieSerializerMock> trie_serializer_ =
+        std::make_shared<TrieSerializerMock>();
     std::shared_ptr<BlockHeaderRepositoryMock> block_header_repo_ =
         std::make_shared<BlockHeaderRepositoryMock>();
     std::shared_ptr<BlockTreeMock> block_tree_ =
@@ -112,12 +132,14 @@ namespace kagome::api {
       auto metadata = std::make_shared<MetadataMock>();
       auto executor = std::make_shared<RawExecutorMock>();
 
-      api_ = std::make_shared<api::StateApiImpl>(block_header_repo_,
-                                                 storage,
-                                                 block_tree_,
-                                                 runtime_core,
-                                                 metadata,
-                                                 executor);
+      api_ = std::make_shared<api::StateApiImpl>(
+          block_header_repo_,
+          storage,
+          std::make_shared<TrieSerializerMock>(),
+          block_tree_,
+          runtime_core,
+          metadata,
+          executor);
 
       EXPECT_CALL(*block_tree_, getLastFinalized())
           .WillOnce(testing::Return(BlockInfo(42, "D"_hash256)));
@@ -351,6 +373,16 @@ namespace kagome::api {
         ::testing::Contains(arg), container, result_listener);
   }
 
+  /// Trie of a state, where the keys have the given values
+  std::shared_ptr<PolkadotTrie> makeTrie(
+      const std::vector<std::pair<common::Buffer, common::Buffer>> &entries) {
+    auto trie = std::make_shared<PolkadotTrieImpl>();
+    for (auto &[key, value] : entries) {
+      EXPECT_OUTCOME_TRUE_1(trie->put(key, value));
+    }
+    return trie;
+  }
+
   /**
    * @given that every queried key changed in every queired block
    * @when querying these changes through queryStorage
@@ -379,24 +411,23 @@ namespace kagome::api {
                   getBlockHeader(primitives::BlockId{block_hash}))
           .WillOnce(testing::Return(
               primitives::BlockHeader{.state_root = state_root}));
-      EXPECT_CALL(*storage_, getEphemeralBatchAt(state_root))
-          .WillOnce(testing::Invoke([&keys](auto &root) {
-            auto batch =
-                std::make_unique<storage::trie::EphemeralTrieBatchMock>();
-            for (auto &key : keys) {
-              EXPECT_CALL(*batch, tryGet(key.view()))
-                  .WillOnce(testing::Return(common::Buffer(root)));
-            }
-            return batch;
-          }));
+      std::vector<std::pair<common::Buffer, common::Buffer>> entries;
+      for (auto &key : keys) {
+        entries.emplace_back(key, common::Buffer{state_root});
+      }
+      EXPECT_CALL(*trie_serializer_,
+                  retrieveTrie(common::Buffer{state_root}))
+          .WillRepeatedly(testing::Return(makeTrie(entries)));
     }
     // WHEN
     EXPECT_OUTCOME_TRUE(changes, api_->queryStorage(keys, from, to))
 
     // THEN
+    ASSERT_EQ(changes.size(), block_range.size());
     auto current_block = block_range.begin();
     for (auto &block_changes : changes) {
       ASSERT_EQ(*current_block, block_changes.block);
+      ASSERT_EQ(block_changes.changes.size(), keys.size());
       ASSERT_THAT(block_changes.changes,
                   ::testing::Each(::testing::Field(
                       &StateApiImpl::StorageChangeSet::Change::key,
@@ -405,6 +436,146 @@ namespace kagome::api {
     }
   }
 
+  /**
+   * @given blocks, some of which don't change state or queried keys
+   * @when querying changes of the keys through queryStorage
+   * @then state of a block with the same state root as its parent is not
+   * retrieved, and only blocks actually changing the keys are reported with
+   * changed keys only
+   */
+  TEST_F(StateApiTest, QueryStorageReportsChangedKeysOnly) {
+    // GIVEN
+    std::vector<common::Buffer> keys{"key1"_buf, "key2"_buf, "key3"_buf};
+    std::vector block_range{
+        "b1"_hash256, "b2"_hash256, "b3"_hash256, "b4"_hash256};
+    std::vector state_roots{
+        "s1"_hash256, "s1"_hash256, "s3"_hash256, "s4"_hash256};
+    std::vector<std::shared_ptr<PolkadotTrie>> states{
+        makeTrie({{"key1"_buf, "1"_buf}, {"key2"_buf, "2"_buf}}),
+        nullptr,
+        makeTrie({{"key1"_buf, "1"_buf},
+                  {"key2"_buf, "2"_buf},
+                  {"other"_buf, "3"_buf}}),
+        makeTrie({{"key1"_buf, "1"_buf}, {"key3"_buf, "3"_buf}}),
+    };
+    EXPECT_CALL(*block_header_repo_, getNumberByHash(block_range.front()))
+        .WillOnce(testing::Return(1));
+    EXPECT_CALL(*block_header_repo_, getNumberByHash(block_range.back()))
+        .WillOnce(testing::Return(4));
+    EXPECT_CALL(*block_tree_,
+                getChainByBlocks(block_range.front(), block_range.back()))
+        .WillOnce(testing::Return(block_range));
+    for (size_t i = 0; i < block_range.size(); ++i) {
+      EXPECT_CALL(*block_header_repo_,
+                  getBlockHeader(primitives::BlockId{block_range[i]}))
+          .WillOnce(testing::Return(
+              primitives::BlockHeader{.state_root = state_roots[i]}));
+      if (states[i] != nullptr) {
+        EXPECT_CALL(*trie_serializer_,
+                    retrieveTrie(common::Buffer{state_roots[i]}))
+            .WillRepeatedly(testing::Return(states[i]));
+      }
+    }
+
+    // WHEN
+    EXPECT_OUTCOME_TRUE(
+        changes,
+        api_->queryStorage(keys, block_range.front(), block_range.back()))
+
+    // THEN
+    using Change = StateApiImpl::StorageChangeSet::Change;
+    auto change_eq = [](const common::Buffer &key,
+                        std::optional<common::Buffer> data) {
+      return ::testing::AllOf(::testing::Field(&Change::key, key),
+                              ::testing::Field(&Change::data, data));
+    };
+    ASSERT_EQ(changes.size(), 2);
+    EXPECT_EQ(changes[0].block, block_range[0]);
+    EXPECT_THAT(changes[0].changes,
+                ElementsAre(change_eq("key1"_buf, "1"_buf),
+                            change_eq("key2"_buf, "2"_buf),
+                            change_eq("key3"_buf, std::nullopt)));
+    EXPECT_EQ(changes[1].block, block_range[3]);
+    EXPECT_THAT(changes[1].changes,
+                ElementsAre(change_eq("key2"_buf, std::nullopt),
+                            change_eq("key3"_buf, "3"_buf)));
+  }
+
+  /**
+   * @given stored states of four blocks, each of which changes a key in the
+   * second subtree of the root only
+   * @when querying changes of keys from both subtrees through queryStorage
+   * @then the changes are reported, and the first subtree is not loaded from
+   * any state compared with the previous one
+   */
+  TEST_F(StateApiTest, QueryStorageSkipsUnchangedSubtrees) {
+    // GIVEN
+    auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
+    auto serializer = std::make_shared<TrieSerializerImpl>(
+        factory,
+        std::make_shared<PolkadotCodec>(),
+        std::make_shared<TrieStorageBackendImpl>(
+            std::make_shared<InMemoryStorage>(), Buffer{}));
+    // values are long enough for nodes to be stored by hashes
+    std::vector<common::Buffer> keys{
+        "1100"_hex2buf, "1101"_hex2buf, "2200"_hex2buf};
+    std::vector block_range{
+        "b1"_hash256, "b2"_hash256, "b3"_hash256, "b4"_hash256};
+    std::vector<storage::trie::RootHash> state_roots;
+    for (uint8_t i = 0; i < block_range.size(); ++i) {
+      auto trie = factory->createEmpty();
+      EXPECT_OUTCOME_TRUE_1(trie->put(keys[0], Buffer(40, 1)));
+      EXPECT_OUTCOME_TRUE_1(trie->put(keys[1], Buffer(40, 2)));
+      EXPECT_OUTCOME_TRUE_1(trie->put(keys[2], Buffer(40, 3 + i)));
+      EXPECT_OUTCOME_TRUE(state_root, serializer->storeTrie(*trie));
+      state_roots.emplace_back(state_root);
+      EXPECT_CALL(*block_header_repo_,
+                  getBlockHeader(primitives::BlockId{block_range[i]}))
+          .WillOnce(testing::Return(
+              primitives::BlockHeader{.state_root = state_root}));
+    }
+    EXPECT_CALL(*block_header_repo_, getNumberByHash(block_range.front()))
+        .WillOnce(testing::Return(1));
+    EXPECT_CALL(*block_header_repo_, getNumberByHash(block_range.back()))
+        .WillOnce(testing::Return(4));
+    EXPECT_CALL(*block_tree_,
+                getChainByBlocks(block_range.front(), block_range.back()))
+        .WillOnce(testing::Return(block_range));
+    std::vector<std::shared_ptr<PolkadotTrie>> retrieved;
+    EXPECT_CALL(*trie_serializer_, retrieveTrie(_))
+        .WillRepeatedly(testing::Invoke([&](const common::Buffer &root) {
+          auto trie = serializer->retrieveTrie(root);
+          if (trie.has_value()) {
+            retrieved.emplace_back(trie.value());
+          }
+          return trie;
+        }));
+
+    // WHEN
+    EXPECT_OUTCOME_TRUE(
+        changes,
+        api_->queryStorage(keys, block_range.front(), block_range.back()))
+
+    // THEN
+    ASSERT_EQ(changes.size(), block_range.size());
+    for (size_t i = 1; i < changes.size(); ++i) {
+      EXPECT_EQ(changes[i].block, block_range[i]);
+      ASSERT_EQ(changes[i].changes.size(), 1);
+      EXPECT_EQ(changes[i].changes[0].key, keys[2]);
+      EXPECT_EQ(changes[i].changes[0].data, Buffer(40, 3 + i));
+    }
+    // the first state is looked up entirely, each other one is retrieved as
+    // the latter and then as the former state of a comparison
+    ASSERT_EQ(retrieved.size(), 1 + 2 * (block_range.size() - 1));
+    for (size_t i = 1; i < retrieved.size(); ++i) {
+      auto &root = dynamic_cast<const BranchNode &>(*retrieved[i]->getRoot());
+      EXPECT_NE(dynamic_cast<const DummyNode *>(root.children.at(1).get()),
+                nullptr);
+      EXPECT_EQ(dynamic_cast<const DummyNode *>(root.children.at(2).get()),
+                nullptr);
+    }
+  }
+
   /**
    * @given Block range longer than the maximum allowed block range of State API
    * @when querying storage changes for this range via queryStorage
@@ -451,16 +622,12 @@ namespace kagome::api {
     EXPECT_CALL(*block_header_repo_, getBlockHeader(primitives::BlockId{at}))
         .WillOnce(
             testing::Return(primitives::BlockHeader{.state_root = state_root}));
-    EXPECT_CALL(*storage_, getEphemeralBatchAt(state_root))
-        .WillOnce(testing::Invoke([&keys](auto &root) {
-          auto batch =
-              std::make_unique<storage::trie::EphemeralTrieBatchMock>();
-          for (auto &key : keys) {
-            EXPECT_CALL(*batch, tryGet(key.view()))
-                .WillOnce(testing::Return(common::Buffer(root)));
-          }
-          return batch;
-        }));
+    std::vector<std::pair<common::Buffer, common::Buffer>> entries;
+    for (auto &key : keys) {
+      entries.emplace_back(key, common::Buffer{state_root});
+    }
+    EXPECT_CALL(*trie_serializer_, retrieveTrie(common::Buffer{state_root}))
+        .WillOnce(testing::Return(makeTrie(entries)));
 
     // WHEN
     EXPECT_OUTCOME_TRUE(changes, api_->queryStorageAt(keys, at))
@@ -0,0 +1,49 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "api/jrpc/jrpc_request_id.hpp"
+
+using kagome::api::jrpcRequestId;
+
+/**
+ * @given requests with number, string and null id
+ * @when extract id
+ * @then id is returned as json
+ */
+TEST(JrpcRequestIdTest, Scalar) {
+  EXPECT_EQ(jrpcRequestId(R"({"jsonrpc":"2.0","id":42,"method":"foo"})"),
+            "42");
+  EXPECT_EQ(jrpcRequestId(R"({"jsonrpc":"2.0","id":"a\"b","method":"foo"})"),
+            R"("a\"b")");
+  EXPECT_EQ(jrpcRequestId(R"({"jsonrpc":"2.0","id":null,"method":"foo"})"),
+            "null");
+}
+
+/**
+ * @given request with "id" keys inside params before its own id
+ * @when extract id
+ * @then id of request is returned
+ */
+TEST(JrpcRequestIdTest, NestedIdIgnored) {
+  EXPECT_EQ(jrpcRequestId(R"({"jsonrpc":"2.0","method":"foo",)"
+                          R"("params":[{"id":1},[2]],"id":3})"),
+            "3");
+}
+
+/**
+ * @given requests without id, with invalid id, batch and malformed one
+ * @when extract id
+ * @then null is returned
+ */
+TEST(JrpcRequestIdTest, NotFound) {
+  EXPECT_EQ(jrpcRequestId(R"({"jsonrpc":"2.0","method":"foo"})"), "null");
+  EXPECT_EQ(jrpcRequestId(R"({"jsonrpc":"2.0","id":[1],"method":"foo"})"),
+            "null");
+  EXPECT_EQ(jrpcRequestId(R"([{"jsonrpc":"2.0","id":1,"method":"foo"}])"),
+            "null");
+  EXPECT_EQ(jrpcRequestId(R"({"jsonrpc":"2.0","method":)"), "null");
+}
@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/jrpc/jrpc_server_impl.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using kagome::api::JRpcServerImpl;
+using testing::HasSubstr;
+
+#define REQUEST(method, id) \
+  R"({"jsonrpc":"2.0","method":")" method R"(","id":)" #id R"(,"params":[]})"
+
+struct JRpcServerImplTest : ::testing::Test {
+  /// Calls method of server from inside of the method's call
+  void registerNested(const std::string &name) {
+    server_.registerHandler(
+        name, [this, name](const jsonrpc::Request::Parameters &) {
+          if (not nested_called_) {
+            nested_called_ = true;
+            server_.processData(
+                R"({"jsonrpc":"2.0","method":")" + name
+                    + R"(","id":1,"params":[]})",
+                [&](std::string_view response) {
+                  nested_response_ = response;
+                });
+          }
+          return jsonrpc::Value{0};
+        });
+  }
+
+  JRpcServerImpl server_{[] {
+    JRpcServerImpl::Configuration config;
+    config.max_concurrent_calls = 2;
+    config.method_concurrent_calls = {{"heavy", 1}};
+    return config;
+  }()};
+  bool nested_called_ = false;
+  std::string nested_response_;
+};
+
+/**
+ * @given method limited to single simultaneous call
+ * @when method is called while its previous call is not finished
+ * @then second call is rejected, and the first one succeeds
+ */
+TEST_F(JRpcServerImplTest, RejectsCallOverMethodLimit) {
+  registerNested("heavy");
+
+  std::string response;
+  server_.processData(REQUEST("heavy", 0),
+                      [&](std::string_view r) { response = r; });
+
+  EXPECT_EQ(response, R"({"jsonrpc":"2.0","id":0,"result":0})");
+  EXPECT_THAT(nested_response_,
+              HasSubstr(std::to_string(JRpcServerImpl::kServerBusyCode)));
+
+  // limit is released after calls are finished
+  nested_called_ = false;
+  server_.processData(REQUEST("heavy", 2),
+                      [&](std::string_view r) { response = r; });
+  EXPECT_EQ(response, R"({"jsonrpc":"2.0","id":2,"result":0})");
+}
+
+/**
+ * @given method limited by common limit of two simultaneous calls
+ * @when method is called while its previous call is not finished
+ * @then both calls succeed
+ */
+TEST_F(JRpcServerImplTest, AllowsCallsWithinLimit) {
+  registerNested("light");
+
+  std::string response;
+  server_.processData(REQUEST("light", 0),
+                      [&](std::string_view r) { response = r; });
+
+  EXPECT_EQ(response, R"({"jsonrpc":"2.0","id":0,"result":0})");
+  EXPECT_EQ(nested_response_, R"({"jsonrpc":"2.0","id":1,"result":0})");
+}
+
+/**
+ * @given server with lock of calls
+ * @when method is called
+ * @then the lock is held shared during the call, so it can't be taken
+ * exclusively, and is released after the call
+ */
+TEST(JRpcServerImplCallsLockTest, CallHoldsLockShared) {
+  JRpcServerImpl::Configuration config;
+  config.calls_lock = std::make_shared<std::shared_mutex>();
+  JRpcServerImpl server{config};
+
+  bool locked_exclusively = true;
+  server.registerHandler("read", [&](const jsonrpc::Request::Parameters &) {
+    locked_exclusively = config.calls_lock->try_lock();
+    return jsonrpc::Value{0};
+  });
+
+  std::string response;
+  server.processData(REQUEST("read", 0),
+                     [&](std::string_view r) { response = r; });
+
+  EXPECT_EQ(response, R"({"jsonrpc":"2.0","id":0,"result":0})");
+  EXPECT_FALSE(locked_exclusively);
+  ASSERT_TRUE(config.calls_lock->try_lock());
+  config.calls_lock->unlock();
+}
@@ -108,7 +108,8 @@ struct ListenerTest : public ::testing::Test {
 
   sptr<ApiStub> api = std::make_shared<ApiStub>();
 
-  sptr<JRpcServer> server = std::make_shared<JRpcServerImpl>();
+  sptr<JRpcServer> server =
+      std::make_shared<JRpcServerImpl>(JRpcServerImpl::Configuration{});
 
   std::vector<std::shared_ptr<JRpcProcessor>> processors{
       std::make_shared<JrpcProcessorStub>(server, api)};
@@ -141,7 +142,8 @@ struct ListenerTest : public ::testing::Test {
       ext_events_engine,
       ext_event_key_repo,
       block_tree,
-      trie_storage);
+      trie_storage,
+      ApiServiceImpl::Configuration{});
 };
 
 #endif  // KAGOME_TEST_CORE_API_TRANSPORT_LISTENER_TEST_HPP
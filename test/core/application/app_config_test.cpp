@@ -669,3 +669,45 @@ TEST_F(AppConfigurationTest, SetRandomWalk) {
   ASSERT_TRUE(app_config_->initializeFromArgs(std::size(args), args));
   ASSERT_EQ(app_config_->getRandomWalkInterval(), std::chrono::seconds(30));
 }
+
+/**
+ * @given an instance of AppConfigurationImpl
+ * @when limits of simultaneous RPC calls are specified
+ * @then the common limit and limits of particular methods have the specified
+ * values
+ */
+TEST_F(AppConfigurationTest, RpcConcurrentCalls) {
+  char const *args[] = {"/path/",
+                        "--chain",
+                        chain_path.native().c_str(),
+                        "--base-path",
+                        base_path.native().c_str(),
+                        "--rpc-max-concurrent-calls",
+                        "16",
+                        "--rpc-method-concurrent-calls",
+                        "state_queryStorage=1",
+                        "state_call=0"};
+
+  ASSERT_TRUE(app_config_->initializeFromArgs(std::size(args), args));
+  ASSERT_EQ(app_config_->rpcMaxConcurrentCalls(), 16);
+  ASSERT_EQ(app_config_->rpcMethodConcurrentCalls(),
+            (std::unordered_map<std::string, uint32_t>{
+                {"state_queryStorage", 1}, {"state_call", 0}}));
+}
+
+/**
+ * @given an instance of AppConfigurationImpl
+ * @when limit of RPC method calls is specified without a number
+ * @then configuration is rejected
+ */
+TEST_F(AppConfigurationTest, InvalidRpcMethodConcurrentCalls) {
+  char const *args[] = {"/path/",
+                        "--chain",
+                        chain_path.native().c_str(),
+                        "--base-path",
+                        base_path.native().c_str(),
+                        "--rpc-method-concurrent-calls",
+                        "state_queryStorage"};
+
+  ASSERT_FALSE(app_config_->initializeFromArgs(std::size(args), args));
+}
@@ -17,7 +17,6 @@
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
-#include "transaction_pool/transaction_pool_error.hpp"
 
 using ::testing::_;
 using ::testing::Invoke;
@@ -42,7 +41,7 @@ using kagome::primitives::Transaction;
 using kagome::primitives::events::ExtrinsicSubscriptionEngine;
 using kagome::runtime::BlockBuilderApiMock;
 using kagome::subscription::ExtrinsicEventKeyRepository;
-using kagome::transaction_pool::TransactionPoolError;
+using kagome::transaction_pool::TransactionPool;
 using kagome::transaction_pool::TransactionPoolMock;
 
 // TODO (kamilsa): workaround unless we bump gtest version to 1.8.1+
@@ -55,6 +54,8 @@ namespace kagome::primitives {
 
 class ProposerTest : public ::testing::Test {
  public:
+  static constexpr std::chrono::milliseconds kMaxDuration{1000};
+
   static void SetUpTestCase() {
     testutil::prepareLoggers();
   }
@@ -76,6 +77,32 @@ class ProposerTest : public ::testing::Test {
   }
 
  protected:
+  /// Makes transaction pool visit {@param txs} as ready ones in given order
+  void expectReadyTransactions(
+      std::vector<std::shared_ptr<Transaction>> txs) {
+    EXPECT_CALL(*transaction_pool_, forEachReadyTransaction(_))
+        .WillOnce(Invoke([txs](auto &visitor) {
+          for (auto &tx : txs) {
+            if (visitor(tx) == TransactionPool::Visit::STOP) {
+              return;
+            }
+          }
+        }));
+  }
+
+  /// @return ready transactions with distinct hashes
+  static std::vector<std::shared_ptr<Transaction>> makeTransactions(
+      size_t count) {
+    std::vector<std::shared_ptr<Transaction>> txs;
+    for (size_t i = 0; i < count; ++i) {
+      auto tx = std::make_shared<Transaction>();
+      tx->hash = "fakeHash"_hash256;
+      tx->hash.back() = 'a' + i;
+      txs.emplace_back(std::move(tx));
+    }
+    return txs;
+  }
+
   std::shared_ptr<BlockBuilderFactoryMock> block_builder_factory_ =
       std::make_shared<BlockBuilderFactoryMock>();
   std::shared_ptr<TransactionPoolMock> transaction_pool_ =
@@ -117,12 +144,10 @@ TEST_F(ProposerTest, CreateBlockSuccess) {
       .WillOnce(Return(outcome::success()))
       .WillOnce(Return(outcome::success()));
 
-  // getReadyTransaction will return vector with single transaction
-  std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready_transactions{
-      std::make_pair("fakeHash"_hash256, std::make_shared<Transaction>())};
-
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
+  // transaction pool has single ready transaction
+  auto ready_transaction = std::make_shared<Transaction>();
+  ready_transaction->hash = "fakeHash"_hash256;
+  expectReadyTransactions({ready_transaction});
 
   EXPECT_CALL(*transaction_pool_, removeOne("fakeHash"_hash256))
       .WillOnce(Return(outcome::success()));
@@ -136,7 +161,8 @@ TEST_F(ProposerTest, CreateBlockSuccess) {
 
   // when
   auto block_res =
-      proposer_.propose(expected_block_, inherent_data_, inherent_digests_);
+      proposer_.propose(
+          expected_block_, inherent_data_, inherent_digests_, kMaxDuration);
 
   // then
   ASSERT_TRUE(block_res);
@@ -159,7 +185,8 @@ TEST_F(ProposerTest, CreateBlockFailsWhenXtNotPushed) {
 
   // when
   auto block_res =
-      proposer_.propose(expected_block_, inherent_data_, inherent_digests_);
+      proposer_.propose(
+          expected_block_, inherent_data_, inherent_digests_, kMaxDuration);
 
   // then
   ASSERT_FALSE(block_res);
@@ -178,7 +205,8 @@ TEST_F(ProposerTest, CreateBlockFailsToGetInhetentExtr) {
 
   // when
   auto block_res =
-      proposer_.propose(expected_block_, inherent_data_, inherent_digests_);
+      proposer_.propose(
+          expected_block_, inherent_data_, inherent_digests_, kMaxDuration);
 
   // then
   ASSERT_FALSE(block_res);
@@ -207,19 +235,20 @@ TEST_F(ProposerTest, PushFailed) {
   EXPECT_CALL(*block_builder_, estimateBlockSize()).WillOnce(Return(1));
   EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
 
-  std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready_transactions{
-      std::make_pair("fakeHash"_hash256, std::make_shared<Transaction>())};
+  auto ready_transaction = std::make_shared<Transaction>();
+  ready_transaction->hash = "fakeHash"_hash256;
+  expectReadyTransactions({ready_transaction});
 
+  // the failed transaction is invalid, so it is removed from the pool
   EXPECT_CALL(*transaction_pool_, removeOne("fakeHash"_hash256))
       .WillOnce(Return(Transaction{}));
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
   EXPECT_CALL(*transaction_pool_, removeStale(BlockId(expected_block_.number)))
       .WillOnce(Return(outcome::success()));
 
   // when
   auto block_res =
-      proposer_.propose(expected_block_, inherent_data_, inherent_digests_);
+      proposer_.propose(
+          expected_block_, inherent_data_, inherent_digests_, kMaxDuration);
 
   // then
   ASSERT_TRUE(block_res);
@@ -244,28 +273,18 @@ TEST_F(ProposerTest, TrxSkippedDueToOverflow) {
   EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
 
   // number of trxs is kMaxSkippedTransactions + 1
-  std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready_transactions;
-  std::generate_n(std::inserter(ready_transactions, ready_transactions.end()),
-                  ProposerImpl::kMaxSkippedTransactions + 1,
-                  []() {
-                    static char c = 'a';
-                    auto hash = "fakeHash"_hash256;
-                    hash.back() = c++;
-                    return std::make_pair(hash,
-                                          std::make_shared<Transaction>());
-                  });
-
-  EXPECT_CALL(*transaction_pool_, removeOne(_))
-      .WillRepeatedly(
-          Return(outcome::failure(TransactionPoolError::TX_NOT_FOUND)));
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillRepeatedly(Return(ready_transactions));
+  expectReadyTransactions(
+      makeTransactions(ProposerImpl::kMaxSkippedTransactions + 1));
+
+  // skipped transactions stay in the pool for the next blocks
+  EXPECT_CALL(*transaction_pool_, removeOne(_)).Times(0);
   EXPECT_CALL(*transaction_pool_, removeStale(BlockId(expected_block_.number)))
       .WillRepeatedly(Return(outcome::success()));
 
   // when
   auto block_res =
-      proposer_.propose(expected_block_, inherent_data_, inherent_digests_);
+      proposer_.propose(
+          expected_block_, inherent_data_, inherent_digests_, kMaxDuration);
 
   // then
   ASSERT_TRUE(block_res);
@@ -290,28 +309,50 @@ TEST_F(ProposerTest, TrxSkippedDueToResourceExhausted) {
   EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
 
   // number is kMaxSkippedTransactions + 1
-  std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready_transactions;
-  std::generate_n(std::inserter(ready_transactions, ready_transactions.end()),
-                  ProposerImpl::kMaxSkippedTransactions + 1,
-                  []() {
-                    static char c = 'a';
-                    auto hash = "fakeHash"_hash256;
-                    hash.back() = c++;
-                    return std::make_pair(hash,
-                                          std::make_shared<Transaction>());
-                  });
-
-  EXPECT_CALL(*transaction_pool_, removeOne(_))
-      .WillRepeatedly(
-          Return(outcome::failure(TransactionPoolError::TX_NOT_FOUND)));
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillRepeatedly(Return(ready_transactions));
+  expectReadyTransactions(
+      makeTransactions(ProposerImpl::kMaxSkippedTransactions + 1));
+
+  // skipped transactions stay in the pool for the next blocks
+  EXPECT_CALL(*transaction_pool_, removeOne(_)).Times(0);
   EXPECT_CALL(*transaction_pool_, removeStale(BlockId(expected_block_.number)))
       .WillRepeatedly(Return(outcome::success()));
 
   // when
   auto block_res =
-      proposer_.propose(expected_block_, inherent_data_, inherent_digests_);
+      proposer_.propose(
+          expected_block_, inherent_data_, inherent_digests_, kMaxDuration);
+
+  // then
+  ASSERT_TRUE(block_res);
+}
+
+/**
+ * @given BlockBuilderApi creating inherent extrinsics @and TransactionPool
+ * returning extrinsics
+ * @when Proposer is trying to create block @but time budget is already spent
+ * after pushing of inherent extrinsics
+ * @then Block is still created, but without trxs, which stay in the pool
+ */
+TEST_F(ProposerTest, TrxSkippedDueToDeadline) {
+  // given
+  EXPECT_CALL(*block_builder_, getInherentExtrinsics(inherent_data_))
+      .WillOnce(Return(inherent_xts));
+  // only inherent xt is pushed
+  EXPECT_CALL(*block_builder_, pushExtrinsic(inherent_xts[0]))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*block_builder_, estimateBlockSize()).WillOnce(Return(1));
+  EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
+
+  expectReadyTransactions(makeTransactions(3));
+  EXPECT_CALL(*transaction_pool_, removeOne(_)).Times(0);
+  EXPECT_CALL(*transaction_pool_, removeStale(BlockId(expected_block_.number)))
+      .WillOnce(Return(outcome::success()));
+
+  // when
+  auto block_res = proposer_.propose(expected_block_,
+                                     inherent_data_,
+                                     inherent_digests_,
+                                     std::chrono::milliseconds{0});
 
   // then
   ASSERT_TRUE(block_res);
@@ -20,6 +20,7 @@
 #include "mock/core/blockchain/block_storage_mock.hpp"
 #include "mock/core/blockchain/justification_storage_policy.hpp"
 #include "mock/core/consensus/babe/babe_util_mock.hpp"
+#include "mock/core/runtime/babe_api_mock.hpp"
 #include "mock/core/runtime/core_mock.hpp"
 #include "mock/core/storage/changes_trie/changes_tracker_mock.hpp"
 #include "mock/core/transaction_pool/transaction_pool_mock.hpp"
@@ -157,6 +158,7 @@ struct BlockTreeTest : public testing::Test {
                                         extrinsic_event_key_repo,
                                         runtime_core_,
                                         changes_tracker_,
+                                        babe_api_,
                                         babe_config_,
                                         babe_util_,
                                         justification_storage_policy_)
@@ -253,6 +255,9 @@ struct BlockTreeTest : public testing::Test {
   std::shared_ptr<storage::changes_trie::ChangesTrackerMock> changes_tracker_ =
       std::make_shared<storage::changes_trie::ChangesTrackerMock>();
 
+  std::shared_ptr<runtime::BabeApiMock> babe_api_ =
+      std::make_shared<runtime::BabeApiMock>();
+
   std::shared_ptr<primitives::BabeConfiguration> babe_config_;
   std::shared_ptr<BabeUtilMock> babe_util_;
 
@@ -971,3 +976,95 @@ TEST_F(BlockTreeTest, KeepLastFinalizedJustificationIfItShouldBeStored) {
       .WillOnce(Return(outcome::success()));
   EXPECT_OUTCOME_TRUE_1(block_tree_->finalize(b56, new_justification));
 }
+
+/**
+ * @given block tree with following topology in storage written by other
+ * process (finalized blocks marked with an asterisk):
+ *
+ *      +---B*---C
+ *     /
+ * ---A*---B1
+ *
+ * @when block tree is synced with storage
+ * @then blocks B and C are added, block B is finalized and block B1 is pruned
+ */
+TEST_F(BlockTreeTest, SyncWithStorage) {
+  // GIVEN
+  BlockHeader B_header{.parent_hash = kFinalizedBlockInfo.hash,
+                       .number = kFinalizedBlockInfo.number + 1};
+  auto B_hash = "B"_hash256;
+  BlockHeader B1_header{.parent_hash = kFinalizedBlockInfo.hash,
+                        .number = kFinalizedBlockInfo.number + 1,
+                        .state_root = "B1"_hash256};
+  auto B1_hash = "B1"_hash256;
+  BlockHeader C_header{.parent_hash = B_hash, .number = B_header.number + 1};
+  auto C_hash = "C"_hash256;
+
+  EXPECT_CALL(*storage_, getBlockHeader(BlockId{B_hash}))
+      .WillRepeatedly(Return(B_header));
+  EXPECT_CALL(*storage_, getBlockHeader(BlockId{B1_hash}))
+      .WillRepeatedly(Return(B1_header));
+  EXPECT_CALL(*storage_, getBlockHeader(BlockId{C_hash}))
+      .WillRepeatedly(Return(C_header));
+  EXPECT_CALL(*storage_, getBlockTreeLeaves())
+      .WillOnce(Return(std::vector<BlockHash>{C_hash, B1_hash}));
+  EXPECT_CALL(*storage_, getLastFinalized())
+      .WillOnce(Return(BlockInfo{B_header.number, B_hash}));
+  EXPECT_CALL(*storage_, getJustification(BlockId{B_hash}))
+      .WillOnce(Return(std::optional<Justification>{}));
+  EXPECT_CALL(*runtime_core_, version(B_hash))
+      .WillOnce(Return(primitives::Version{}));
+
+  // WHEN
+  EXPECT_OUTCOME_TRUE_1(block_tree_->syncWithStorage());
+
+  // THEN
+  ASSERT_EQ(block_tree_->getLastFinalized(),
+            BlockInfo(B_header.number, B_hash));
+  ASSERT_EQ(block_tree_->getLeaves(), std::vector<BlockHash>{C_hash});
+  ASSERT_EQ(block_tree_->deepestLeaf(), BlockInfo(C_header.number, C_hash));
+}
+
+/**
+ * @given block tree and a block proven by warp sync, whose state is synced
+ * @when reset the block tree to the block
+ * @then the block is the only finalized leaf, and its BABE epochs are read
+ * from its state
+ */
+TEST_F(BlockTreeTest, ResetToFinalized) {
+  // GIVEN
+  BlockHeader W_header{.parent_hash = "unknown"_hash256,
+                       .number = kFinalizedBlockInfo.number + 100,
+                       .digest = make_digest(1000)};
+  auto W_hash = hasher_->blake2b_256(scale::encode(W_header).value());
+  BlockInfo W_block{W_header.number, W_hash};
+  Justification justification{.data = "justification"_buf};
+
+  primitives::Epoch current{.epoch_index = 7, .start_slot = 20};
+  current.randomness.fill(7);
+  primitives::Epoch next{.epoch_index = 8, .start_slot = 22};
+  next.randomness.fill(8);
+
+  EXPECT_CALL(*storage_, putBlockHeader(W_header)).WillOnce(Return(W_hash));
+  EXPECT_CALL(*storage_,
+              putJustification(justification, W_hash, W_block.number))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*storage_, setBlockTreeLeaves(std::vector<BlockHash>{W_hash}))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*babe_api_, current_epoch(W_hash)).WillOnce(Return(current));
+  EXPECT_CALL(*babe_api_, next_epoch(W_hash)).WillOnce(Return(next));
+
+  // WHEN
+  EXPECT_OUTCOME_TRUE_1(block_tree_->resetToFinalized(W_header, justification));
+
+  // THEN
+  ASSERT_EQ(block_tree_->getLastFinalized(), W_block);
+  ASSERT_EQ(block_tree_->getLeaves(), std::vector<BlockHash>{W_hash});
+  ASSERT_EQ(block_tree_->deepestLeaf(), W_block);
+  ASSERT_EQ(num_to_hash_[W_block.number], W_hash);
+
+  EXPECT_OUTCOME_TRUE(current_digest, block_tree_->getEpochDigest(7, W_hash));
+  ASSERT_EQ(current_digest.randomness, current.randomness);
+  EXPECT_OUTCOME_TRUE(next_digest, block_tree_->getEpochDigest(8, W_hash));
+  ASSERT_EQ(next_digest.randomness, next.randomness);
+}
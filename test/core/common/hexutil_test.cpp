@@ -6,6 +6,8 @@
 #include "common/hexutil.hpp"
 
 #include <gtest/gtest.h>
+#include <numeric>
+
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 
@@ -23,6 +25,24 @@ TEST(Common, Hexutil_Hex) {
   ASSERT_EQ(hexed, "00010204081020FF"s);
 }
 
+/**
+ * @given bytes of all values
+ * @when hex them in lowercase, with and without prefix
+ * @then hex matches lowercased uppercase encoding
+ */
+TEST(Common, Hexutil_HexLower) {
+  std::vector<uint8_t> bin(256);
+  std::iota(bin.begin(), bin.end(), 0);
+  auto expected = hex_upper(bin);
+  std::transform(
+      expected.begin(), expected.end(), expected.begin(), [](char c) {
+        return std::tolower(c);
+      });
+  ASSERT_EQ(hex_lower(bin), expected);
+  ASSERT_EQ(hex_lower_0x(bin), "0x" + expected);
+  ASSERT_EQ(hex_lower_0x(gsl::span<const uint8_t>{}), "0x");
+}
+
 /**
  * @given Hexencoded string of even length
  * @when unhex
@@ -157,6 +157,9 @@ class AuthorityManagerTest : public testing::Test {
         }));
     EXPECT_CALL(*block_tree, hasDirectChain(_, _)).Times(testing::AnyNumber());
 
+    ON_CALL(*block_tree, hasBlockHeader(_)).WillByDefault(Return(true));
+    EXPECT_CALL(*block_tree, hasBlockHeader(_)).Times(testing::AnyNumber());
+
     EXPECT_CALL(*block_tree, getBlockHeader(primitives::BlockId("GEN"_hash256)))
         .WillRepeatedly(Return(primitives::BlockHeader{}));
   }
@@ -226,6 +229,73 @@ TEST_F(AuthorityManagerTest, Init) {
   examine({20, "D"_hash256}, authorities->authorities);
 }
 
+/**
+ * @given initialized manager
+ * @when authorities of the same block are requested repeatedly, and then a
+ * forced change is applied
+ * @then repeated requests are served from cache, and authorities are
+ * recalculated after the change
+ */
+TEST_F(AuthorityManagerTest, AuthoritiesLookupIsCached) {
+  prepareAuthorityManager();
+
+  primitives::BlockInfo examined_block{15, "C"_hash256};
+
+  auto first_opt =
+      authority_manager->authorities(examined_block, IsBlockFinalized{false});
+  ASSERT_TRUE(first_opt.has_value());
+
+  // Cache miss is followed by checking if the block is known
+  EXPECT_CALL(*block_tree, hasBlockHeader(_)).Times(0);
+  for (auto i = 0; i < 10; ++i) {
+    auto cached_opt =
+        authority_manager->authorities(examined_block, IsBlockFinalized{false});
+    ASSERT_TRUE(cached_opt.has_value());
+    EXPECT_EQ(cached_opt.value(), first_opt.value());
+  }
+  EXPECT_CALL(*block_tree, hasBlockHeader(_)).Times(testing::AnyNumber());
+
+  primitives::BlockInfo target_block{10, "B"_hash256};
+  EXPECT_CALL(*header_repo, getHashByNumber(target_block.number))
+      .WillOnce(Return(target_block.hash));
+  primitives::AuthorityList new_authorities{makeAuthority("Auth1", 123)};
+
+  EXPECT_OUTCOME_SUCCESS(
+      r1,
+      authority_manager->onConsensus(
+          target_block,
+          primitives::ForcedChange(new_authorities, 5, target_block.number)));
+
+  examine(examined_block, new_authorities);
+}
+
+/**
+ * @given initialized manager with changes scheduled on blocks B and D
+ * @when authorities of block D are requested
+ * @then schedule node of D is found by index, without walking the tree and
+ * checking chains of blocks
+ */
+TEST_F(AuthorityManagerTest, ScheduleNodeIsIndexed) {
+  prepareAuthorityManager();
+
+  primitives::AuthorityList b_authorities{makeAuthority("Auth1", 1)};
+  primitives::AuthorityList d_authorities{makeAuthority("Auth2", 1)};
+  EXPECT_OUTCOME_SUCCESS(
+      r1,
+      authority_manager->onConsensus(
+          {10, "B"_hash256}, primitives::ScheduledChange(b_authorities, 0)));
+  EXPECT_OUTCOME_SUCCESS(
+      r2,
+      authority_manager->onConsensus(
+          {20, "D"_hash256}, primitives::ScheduledChange(d_authorities, 0)));
+
+  EXPECT_CALL(*block_tree, hasDirectChain(_, _)).Times(0);
+  auto authorities_opt =
+      authority_manager->authorities({20, "D"_hash256}, IsBlockFinalized{true});
+  ASSERT_TRUE(authorities_opt.has_value());
+  EXPECT_EQ(authorities_opt.value()->authorities, d_authorities);
+}
+
 /**
  * @given initialized manager has some state
  * @when do pruning upto block
@@ -287,6 +357,108 @@ TEST_F(AuthorityManagerTest, OnConsensus_ScheduledChange) {
   examine({25, "E"_hash256}, new_authorities);
 }
 
+/**
+ * @given manager which stored its root after pruning upto finalized block
+ * @when manager is restarted with the same persistent storage
+ * @then stored root is used as is, without looking for the last authority set
+ * change and fetching authorities from runtime
+ */
+TEST_F(AuthorityManagerTest, WarmStartFromStoredRoot) {
+  prepareAuthorityManager();
+
+  primitives::AuthorityList new_authorities{makeAuthority("Auth1", 123)};
+  EXPECT_OUTCOME_SUCCESS(
+      r1,
+      authority_manager->onConsensus(
+          {5, "A"_hash256}, primitives::ScheduledChange(new_authorities, 10)));
+
+  primitives::BlockInfo finalized_block{20, "D"_hash256};
+  authority_manager->prune(finalized_block);
+
+  EXPECT_CALL(*app_state_manager, atPrepare(_));
+  auto restarted_manager =
+      std::make_shared<AuthorityManagerImpl>(AuthorityManagerImpl::Config{},
+                                             app_state_manager,
+                                             block_tree,
+                                             trie_storage,
+                                             grandpa_api,
+                                             hasher,
+                                             persistent_storage,
+                                             header_repo);
+
+  EXPECT_CALL(*block_tree, getLastFinalized())
+      .WillRepeatedly(Return(finalized_block));
+  EXPECT_CALL(*block_tree, getLeaves())
+      .WillOnce(Return(std::vector{finalized_block.hash}));
+  EXPECT_CALL(*block_tree,
+              getBlockHeader(primitives::BlockId(finalized_block.hash)))
+      .WillOnce(Return(primitives::BlockHeader{}));
+  EXPECT_CALL(*grandpa_api, authorities(_)).Times(0);
+
+  ASSERT_TRUE(restarted_manager->prepare());
+  EXPECT_EQ(restarted_manager->base(), finalized_block);
+
+  auto authorities_opt = restarted_manager->authorities(
+      {25, "E"_hash256}, IsBlockFinalized{false});
+  ASSERT_TRUE(authorities_opt.has_value());
+  EXPECT_EQ(authorities_opt.value()->authorities, new_authorities);
+}
+
+/**
+ * @given manager which stored its root after pruning upto finalized block
+ * @when manager is restarted, and header of a block above the stored root
+ * can't be read
+ * @then state is recalculated from genesis instead of using the stored root
+ */
+TEST_F(AuthorityManagerTest, WarmStartFallsBackToRecalculation) {
+  prepareAuthorityManager();
+
+  primitives::AuthorityList new_authorities{makeAuthority("Auth1", 123)};
+  EXPECT_OUTCOME_SUCCESS(
+      r1,
+      authority_manager->onConsensus(
+          {5, "A"_hash256}, primitives::ScheduledChange(new_authorities, 10)));
+  authority_manager->prune({20, "D"_hash256});
+
+  EXPECT_CALL(*app_state_manager, atPrepare(_));
+  auto restarted_manager =
+      std::make_shared<AuthorityManagerImpl>(AuthorityManagerImpl::Config{},
+                                             app_state_manager,
+                                             block_tree,
+                                             trie_storage,
+                                             grandpa_api,
+                                             hasher,
+                                             persistent_storage,
+                                             header_repo);
+
+  primitives::BlockInfo finalized_block{25, "E"_hash256};
+  EXPECT_CALL(*block_tree, getLastFinalized())
+      .WillRepeatedly(Return(finalized_block));
+  EXPECT_CALL(*block_tree, getLeaves())
+      .WillRepeatedly(Return(std::vector{finalized_block.hash}));
+  EXPECT_CALL(*block_tree,
+              getBlockHeader(primitives::BlockId(finalized_block.hash)))
+      .WillRepeatedly(Return(testutil::DummyError::ERROR));
+
+  // headers of recalculation carry no authority changes
+  EXPECT_CALL(*header_repo, getBlockHeader(_))
+      .WillRepeatedly(Return(primitives::BlockHeader{}));
+  EXPECT_CALL(*header_repo, getHashByNumber(_))
+      .WillRepeatedly(Return("hash"_hash256));
+  EXPECT_CALL(*block_tree, getBlockJustification(_))
+      .WillRepeatedly(Return(testutil::DummyError::ERROR));
+  EXPECT_CALL(*grandpa_api, authorities(_))
+      .Times(testing::AtLeast(1))
+      .WillRepeatedly(Return(authorities->authorities));
+
+  ASSERT_TRUE(restarted_manager->prepare());
+
+  auto authorities_opt =
+      restarted_manager->authorities(finalized_block, IsBlockFinalized{true});
+  ASSERT_TRUE(authorities_opt.has_value());
+  EXPECT_EQ(authorities_opt.value()->authorities, authorities->authorities);
+}
+
 /**
  * @given initialized manager has some state
  * @when apply Consensus message as ForcedChange
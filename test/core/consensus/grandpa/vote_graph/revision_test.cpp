@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "core/consensus/grandpa/vote_graph/fixture.hpp"
+
+/**
+ * @given empty graph
+ * @when votes are inserted and removed
+ * @then revision of corresponding vote type is changed only if weights might
+ * be changed, and cumulative votes of ancestors are kept actual
+ */
+TEST_F(VoteGraphFixture, Revision) {
+  BlockInfo base{0, GENESIS_HASH};
+  graph = std::make_shared<VoteGraphImpl>(base, voter_set, chain);
+
+  auto prevotes_revision = graph->revision(VoteType::Prevote);
+  auto precommits_revision = graph->revision(VoteType::Precommit);
+
+  // new vote changes revision
+  expect_getAncestry(
+      GENESIS_HASH, "C"_H, vec("C"_H, "B"_H, "A"_H, GENESIS_HASH));
+  EXPECT_OUTCOME_TRUE_1(graph->insert(vt, {3, "C"_H}, "w10_a"_ID));
+  EXPECT_NE(graph->revision(VoteType::Prevote), prevotes_revision);
+  EXPECT_EQ(graph->revision(VoteType::Precommit), precommits_revision);
+  prevotes_revision = graph->revision(VoteType::Prevote);
+
+  // repeated vote does not change revision
+  EXPECT_OUTCOME_TRUE_1(graph->insert(vt, {3, "C"_H}, "w10_a"_ID));
+  EXPECT_EQ(graph->revision(VoteType::Prevote), prevotes_revision);
+
+  // vote for descendant changes revision, but ancestors keep the same weight
+  expect_getAncestry(
+      GENESIS_HASH, "D"_H, vec("D"_H, "C"_H, "B"_H, "A"_H, GENESIS_HASH));
+  EXPECT_OUTCOME_TRUE_1(graph->insert(vt, {4, "D"_H}, "w10_a"_ID));
+  EXPECT_NE(graph->revision(VoteType::Prevote), prevotes_revision);
+  prevotes_revision = graph->revision(VoteType::Prevote);
+  EXPECT_EQ(graph->getEntries().at(GENESIS_HASH).cumulative_vote.sum(vt), 10u);
+  EXPECT_EQ(graph->getEntries().at("C"_H).cumulative_vote.sum(vt), 10u);
+  EXPECT_EQ(graph->getEntries().at("D"_H).cumulative_vote.sum(vt), 10u);
+
+  // another voter changes weight of all ancestors
+  EXPECT_OUTCOME_TRUE_1(graph->insert(vt, {4, "D"_H}, "w5_a"_ID));
+  EXPECT_NE(graph->revision(VoteType::Prevote), prevotes_revision);
+  prevotes_revision = graph->revision(VoteType::Prevote);
+  EXPECT_EQ(graph->getEntries().at(GENESIS_HASH).cumulative_vote.sum(vt), 15u);
+  EXPECT_EQ(graph->getEntries().at("C"_H).cumulative_vote.sum(vt), 15u);
+  EXPECT_EQ(graph->getEntries().at("D"_H).cumulative_vote.sum(vt), 15u);
+
+  // removing always changes revision
+  graph->remove(vt, "w1_a"_ID);
+  EXPECT_NE(graph->revision(VoteType::Prevote), prevotes_revision);
+  EXPECT_EQ(graph->revision(VoteType::Precommit), precommits_revision);
+}
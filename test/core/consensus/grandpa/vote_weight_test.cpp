@@ -6,7 +6,10 @@
 #include <gtest/gtest.h>
 
 #include "consensus/grandpa/vote_weight.hpp"
+#include "core/consensus/grandpa/literals.hpp"
+#include "testutil/outcome.hpp"
 
+using kagome::consensus::grandpa::VoterSet;
 using kagome::consensus::grandpa::VoteWeight;
 
 class VoteWeightTest : public testing::Test {
@@ -32,21 +35,21 @@ TEST_F(VoteWeightTest, AddDifferentVote) {
 
   // THEN.1
   EXPECT_EQ(testee->sum, w[0]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 1);
+  EXPECT_EQ(testee->flags.count(), 1u);
 
   // WHEN.2
   testee->set(2, w[2]);
 
   // THEN.2
   EXPECT_EQ(testee->sum, w[0] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 2);
+  EXPECT_EQ(testee->flags.count(), 2u);
 
   // WHEN.3
   testee->set(1, w[1]);
 
   // THEN.3
   EXPECT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  EXPECT_EQ(testee->flags.count(), 3u);
 }
 
 /**
@@ -60,28 +63,28 @@ TEST_F(VoteWeightTest, AddExistingVote) {
   testee->set(1, w[1]);
   testee->set(2, w[2]);
   ASSERT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  ASSERT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  ASSERT_EQ(testee->flags.count(), 3u);
 
   // WHEN.1
   testee->set(0, w[0]);
 
   // THEN.1
   EXPECT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  EXPECT_EQ(testee->flags.count(), 3u);
 
   // WHEN.2
   testee->set(1, w[1]);
 
   // WHEN.2
   EXPECT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  EXPECT_EQ(testee->flags.count(), 3u);
 
   // THEN.3
   testee->set(2, w[2]);
 
   // WHEN.3
   EXPECT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  EXPECT_EQ(testee->flags.count(), 3u);
 }
 
 /**
@@ -95,28 +98,28 @@ TEST_F(VoteWeightTest, RemoveExistingVote) {
   testee->set(1, w[1]);
   testee->set(2, w[2]);
   ASSERT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  ASSERT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  ASSERT_EQ(testee->flags.count(), 3u);
 
   // WHEN.1
   testee->unset(1, w[1]);
 
   // THEN.1
   EXPECT_EQ(testee->sum, w[0] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 2);
+  EXPECT_EQ(testee->flags.count(), 2u);
 
   // WHEN.2
   testee->unset(0, w[0]);
 
   // THEN.2
   EXPECT_EQ(testee->sum, w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 1);
+  EXPECT_EQ(testee->flags.count(), 1u);
 
   // WHEN.3
   testee->unset(2, w[2]);
 
   // THEN.3
   EXPECT_EQ(testee->sum, 0);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 0);
+  EXPECT_EQ(testee->flags.count(), 0u);
 }
 
 /**
@@ -129,12 +132,67 @@ TEST_F(VoteWeightTest, RemoveNonExistingVote) {
   testee->set(0, w[0]);
   testee->set(2, w[2]);
   ASSERT_EQ(testee->sum, w[0] + w[2]);
-  ASSERT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 2);
+  ASSERT_EQ(testee->flags.count(), 2u);
 
   // WHEN
   testee->unset(1, w[1]);
 
   // THEN
   EXPECT_EQ(testee->sum, w[0] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 2);
+  EXPECT_EQ(testee->flags.count(), 2u);
+}
+
+/**
+ * @given two VoteWeights with partially the same voters
+ * @when merge one into another
+ * @then result contains votes of both, and weight of each voter counted once
+ */
+TEST_F(VoteWeightTest, Merge) {
+  // GIVEN
+  auto voter_set = std::make_shared<VoterSet>();
+  ASSERT_OUTCOME_SUCCESS_TRY(voter_set->insert("A"_ID, w[0]));
+  ASSERT_OUTCOME_SUCCESS_TRY(voter_set->insert("B"_ID, w[1]));
+  ASSERT_OUTCOME_SUCCESS_TRY(voter_set->insert("C"_ID, w[2]));
+
+  testee->set(0, w[0]);
+  testee->set(1, w[1]);
+  VoteWeight::OneTypeVoteWeight other;
+  other.set(1, w[1]);
+  other.set(2, w[2]);
+
+  // WHEN
+  testee->merge(other, voter_set);
+
+  // THEN
+  EXPECT_EQ(testee->sum, w[0] + w[1] + w[2]);
+  EXPECT_EQ(testee->flags.count(), 3u);
+}
+
+/**
+ * @given VoteWeight with some votes
+ * @when total weight is calculated considering equivocators
+ * @then weight of equivocators is counted even if they did not vote here
+ */
+TEST_F(VoteWeightTest, TotalWithEquivocators) {
+  // GIVEN
+  VoterSet voter_set;
+  ASSERT_OUTCOME_SUCCESS_TRY(voter_set.insert("A"_ID, w[0]));
+  ASSERT_OUTCOME_SUCCESS_TRY(voter_set.insert("B"_ID, w[1]));
+  ASSERT_OUTCOME_SUCCESS_TRY(voter_set.insert("C"_ID, w[2]));
+
+  testee->set(0, w[0]);
+  testee->set(1, w[1]);
+
+  VoterSet::Bitset equivocators(voter_set.size());
+
+  // WHEN+THEN.1
+  EXPECT_EQ(testee->total(equivocators, voter_set), w[0] + w[1]);
+
+  // WHEN+THEN.2
+  equivocators.set(1);
+  EXPECT_EQ(testee->total(equivocators, voter_set), w[0] + w[1]);
+
+  // WHEN+THEN.3
+  equivocators.set(2);
+  EXPECT_EQ(testee->total(equivocators, voter_set), w[0] + w[1] + w[2]);
 }
@@ -155,3 +155,34 @@ TEST_F(VoterSetTest, GetIndexAndWeight) {
                          VoterSet::Error::VOTER_NOT_FOUND);
   }
 }
+
+/**
+ * @given voter sets with different and with the same weights of voters
+ * @when weight of some subset of voters is queried
+ * @then it is equal to sum of weights of voters of subset, bits beyond the
+ * voters are not counted
+ */
+TEST_F(VoterSetTest, WeightOf) {
+  // GIVEN
+  for (auto &[voter, weight] : voters) {
+    ASSERT_OUTCOME_SUCCESS_TRY(testee->insert(voter, weight));
+  }
+  VoterSet uniform;
+  for (auto &[voter, weight] : voters) {
+    ASSERT_OUTCOME_SUCCESS_TRY(uniform.insert(voter, 5));
+  }
+
+  VoterSet::Bitset subset(voters.size());
+  subset.set(0).set(3).set(4);
+
+  // WHEN+THEN
+  EXPECT_EQ(testee->weightOf(subset), 1u + 2u + 3u);
+  EXPECT_EQ(uniform.weightOf(subset), 3u * 5u);
+  EXPECT_EQ(testee->weightOf(VoterSet::Bitset(voters.size())), 0u);
+
+  // bits beyond the voters are ignored by both
+  VoterSet::Bitset wider(voters.size() + 70);
+  wider.set(0).set(voters.size()).set(voters.size() + 69);
+  EXPECT_EQ(testee->weightOf(wider), 1u);
+  EXPECT_EQ(uniform.weightOf(wider), 5u);
+}
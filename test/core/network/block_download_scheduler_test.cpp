@@ -0,0 +1,235 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/block_download_scheduler.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::network::BlockDownloadScheduler;
+using kagome::primitives::BlockData;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::BlockNumber;
+using libp2p::peer::PeerId;
+
+using Segment = BlockDownloadScheduler::Segment;
+
+struct BlockDownloadSchedulerTest : ::testing::Test {
+  /// @return hash of block {@param number} of chain {@param fork}
+  static BlockHash hash(BlockNumber number, uint8_t fork = 0) {
+    BlockHash hash;
+    hash[0] = fork;
+    hash[1] = number >> 8;
+    hash[2] = number & 0xff;
+    return hash;
+  }
+
+  /// @return blocks {@param first}..{@param last} of chain {@param fork}
+  static std::vector<BlockData> chain(BlockNumber first,
+                                      BlockNumber last,
+                                      uint8_t fork = 0) {
+    std::vector<BlockData> blocks;
+    for (auto number = first; number <= last; ++number) {
+      BlockData block;
+      block.hash = hash(number, fork);
+      block.header.emplace(BlockHeader{
+          .parent_hash = hash(number - 1, number == 1 ? 0 : fork),
+          .number = number});
+      blocks.emplace_back(std::move(block));
+    }
+    return blocks;
+  }
+
+  static std::vector<BlockNumber> numbers(
+      const std::vector<BlockDownloadScheduler::LoadedBlock> &blocks) {
+    std::vector<BlockNumber> numbers;
+    for (auto &block : blocks) {
+      numbers.emplace_back(block.data.header->number);
+    }
+    return numbers;
+  }
+
+  const PeerId peer1_{"peer1"_peerid};
+  const PeerId peer2_{"peer2"_peerid};
+  const PeerId peer3_{"peer3"_peerid};
+  const BlockDownloadScheduler::Clock::time_point now_{};
+  const BlockInfo anchor_{0, hash(0)};
+};
+
+/**
+ * @given blocks split into segments
+ * @when several peers ask for a segment
+ * @then each peer gets own segment, lowest ones go first, busy peer gets
+ * nothing
+ */
+TEST_F(BlockDownloadSchedulerTest, PeersGetDifferentSegments) {
+  BlockDownloadScheduler scheduler{anchor_, 25, 10, 4};
+  scheduler.addPeer(peer1_, 25);
+  scheduler.addPeer(peer2_, 25);
+  scheduler.addPeer(peer3_, 25);
+
+  EXPECT_EQ(scheduler.assign(peer1_, now_), (Segment{1, 10}));
+  EXPECT_EQ(scheduler.assign(peer1_, now_), std::nullopt);
+  EXPECT_EQ(scheduler.assign(peer2_, now_), (Segment{11, 10}));
+  EXPECT_EQ(scheduler.assign(peer3_, now_), (Segment{21, 5}));
+
+  EXPECT_TRUE(scheduler.isAssigned({1, 10}, peer1_));
+  EXPECT_TRUE(scheduler.isAssigned({11, 10}, peer2_));
+  EXPECT_TRUE(scheduler.isAssigned({21, 5}, peer3_));
+}
+
+/**
+ * @given peer having only some of blocks
+ * @when it asks for a segment
+ * @then it doesn't get segments above its best block
+ */
+TEST_F(BlockDownloadSchedulerTest, SegmentsAboveBestOfPeerAreNotAssigned) {
+  BlockDownloadScheduler scheduler{anchor_, 30, 10, 4};
+  scheduler.addPeer(peer1_, 30);
+  scheduler.addPeer(peer2_, 10);
+
+  EXPECT_EQ(scheduler.assign(peer1_, now_), (Segment{1, 10}));
+  EXPECT_EQ(scheduler.assign(peer2_, now_), std::nullopt);
+}
+
+/**
+ * @given segments loaded out of order
+ * @when linked blocks are taken
+ * @then blocks are handed out in order once the gap is filled
+ */
+TEST_F(BlockDownloadSchedulerTest, OutOfOrderSegmentsAreReassembled) {
+  BlockDownloadScheduler scheduler{anchor_, 20, 10, 4};
+  scheduler.addPeer(peer1_, 20);
+  scheduler.addPeer(peer2_, 20);
+
+  ASSERT_EQ(scheduler.assign(peer1_, now_), (Segment{1, 10}));
+  ASSERT_EQ(scheduler.assign(peer2_, now_), (Segment{11, 10}));
+
+  EXPECT_TRUE(scheduler.onLoaded({11, 10}, peer2_, chain(11, 20)));
+  EXPECT_TRUE(scheduler.takeLinked().empty());
+
+  EXPECT_TRUE(scheduler.onLoaded({1, 10}, peer1_, chain(1, 10)));
+  auto linked = scheduler.takeLinked();
+  ASSERT_EQ(linked.size(), 20u);
+  EXPECT_EQ(numbers(linked).front(), 1u);
+  EXPECT_EQ(numbers(linked).back(), 20u);
+  EXPECT_EQ(linked.back().peer_id, peer2_);
+  EXPECT_EQ(scheduler.linked(), (BlockInfo{20, hash(20)}));
+  EXPECT_TRUE(scheduler.complete());
+}
+
+/**
+ * @given segment assigned to a peer
+ * @when peer returns only part of segment
+ * @then the rest of segment is assigned again
+ */
+TEST_F(BlockDownloadSchedulerTest, PartiallyLoadedSegmentIsContinued) {
+  BlockDownloadScheduler scheduler{anchor_, 10, 10, 4};
+  scheduler.addPeer(peer1_, 10);
+
+  ASSERT_EQ(scheduler.assign(peer1_, now_), (Segment{1, 10}));
+  EXPECT_TRUE(scheduler.onLoaded({1, 10}, peer1_, chain(1, 4)));
+  EXPECT_EQ(numbers(scheduler.takeLinked()),
+            (std::vector<BlockNumber>{1, 2, 3, 4}));
+
+  EXPECT_EQ(scheduler.assign(peer1_, now_), (Segment{5, 6}));
+}
+
+/**
+ * @given segment assigned to a peer
+ * @when its request lasts too long
+ * @then segment is taken over by another peer, and the first peer gets
+ * nothing until its request completes
+ */
+TEST_F(BlockDownloadSchedulerTest, StuckSegmentIsReassigned) {
+  BlockDownloadScheduler scheduler{anchor_, 20, 10, 4};
+  scheduler.addPeer(peer1_, 20);
+  scheduler.addPeer(peer2_, 20);
+
+  ASSERT_EQ(scheduler.assign(peer1_, now_), (Segment{1, 10}));
+
+  auto later = now_ + BlockDownloadScheduler::kSlowRequestDuration
+             + std::chrono::seconds(1);
+  EXPECT_EQ(scheduler.assign(peer2_, later), (Segment{1, 10}));
+  EXPECT_FALSE(scheduler.isAssigned({1, 10}, peer1_));
+  EXPECT_TRUE(scheduler.isAssigned({1, 10}, peer2_));
+
+  EXPECT_EQ(scheduler.assign(peer1_, later), std::nullopt);
+  scheduler.onOutdated(peer1_);
+  EXPECT_EQ(scheduler.assign(peer1_, later), (Segment{11, 10}));
+}
+
+/**
+ * @given segments loaded from peers of different forks
+ * @when linked blocks are taken
+ * @then blocks of the other fork are dropped and loaded again, and once
+ * reloaded blocks are linked, the peer of dropped blocks gets failure
+ */
+TEST_F(BlockDownloadSchedulerTest, BlocksOfOtherForkAreDropped) {
+  BlockDownloadScheduler scheduler{anchor_, 20, 10, 4};
+  scheduler.addPeer(peer1_, 20);
+  scheduler.addPeer(peer2_, 20);
+
+  ASSERT_EQ(scheduler.assign(peer1_, now_), (Segment{1, 10}));
+  ASSERT_EQ(scheduler.assign(peer2_, now_), (Segment{11, 10}));
+  EXPECT_TRUE(scheduler.onLoaded({11, 10}, peer2_, chain(11, 20, 1)));
+  EXPECT_TRUE(scheduler.onLoaded({1, 10}, peer1_, chain(1, 10)));
+
+  EXPECT_EQ(scheduler.takeLinked().size(), 10u);
+  EXPECT_EQ(scheduler.failures(peer2_), 0u);
+
+  EXPECT_EQ(scheduler.assign(peer1_, now_), (Segment{11, 10}));
+  EXPECT_TRUE(scheduler.onLoaded({11, 10}, peer1_, chain(11, 20)));
+  EXPECT_EQ(scheduler.takeLinked().size(), 10u);
+  EXPECT_EQ(scheduler.failures(peer1_), 0u);
+  EXPECT_EQ(scheduler.failures(peer2_), 1u);
+}
+
+/**
+ * @given blocks linked from a peer of other fork than the rest of peers
+ * @when blocks of two other peers don't match the linked ones
+ * @then the peer of linked blocks gets failure
+ */
+TEST_F(BlockDownloadSchedulerTest, PeerOfWrongLinkedBlocksIsBlamed) {
+  BlockDownloadScheduler scheduler{anchor_, 20, 10, 4};
+  scheduler.addPeer(peer1_, 20);
+  scheduler.addPeer(peer2_, 20);
+  scheduler.addPeer(peer3_, 20);
+
+  ASSERT_EQ(scheduler.assign(peer1_, now_), (Segment{1, 10}));
+  ASSERT_EQ(scheduler.assign(peer2_, now_), (Segment{11, 10}));
+  EXPECT_TRUE(scheduler.onLoaded({1, 10}, peer1_, chain(1, 10, 1)));
+  EXPECT_TRUE(scheduler.onLoaded({11, 10}, peer2_, chain(11, 20)));
+  EXPECT_EQ(scheduler.takeLinked().size(), 10u);
+
+  ASSERT_EQ(scheduler.assign(peer3_, now_), (Segment{11, 10}));
+  EXPECT_TRUE(scheduler.onLoaded({11, 10}, peer3_, chain(11, 20)));
+  EXPECT_TRUE(scheduler.takeLinked().empty());
+
+  EXPECT_EQ(scheduler.failures(peer1_), 1u);
+  EXPECT_EQ(scheduler.failures(peer2_), 0u);
+  EXPECT_EQ(scheduler.failures(peer3_), 0u);
+}
+
+/**
+ * @given peer failed requests too many times
+ * @when it asks for a segment
+ * @then nothing is assigned and the peer isn't used anymore
+ */
+TEST_F(BlockDownloadSchedulerTest, FailingPeerIsNotUsed) {
+  BlockDownloadScheduler scheduler{anchor_, 10, 10, 4};
+  scheduler.addPeer(peer1_, 10);
+
+  for (size_t i = 0; i < BlockDownloadScheduler::kMaxPeerFailures; ++i) {
+    auto segment = scheduler.assign(peer1_, now_);
+    ASSERT_EQ(segment, (Segment{1, 10}));
+    scheduler.onFailed(segment.value(), peer1_);
+  }
+  EXPECT_EQ(scheduler.assign(peer1_, now_), std::nullopt);
+  EXPECT_TRUE(scheduler.peers().empty());
+}
@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/protocols/grandpa_protocol.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::consensus::grandpa::Precommit;
+using kagome::consensus::grandpa::Prevote;
+using kagome::consensus::grandpa::RoundNumber;
+using kagome::consensus::grandpa::VoterSetId;
+using kagome::network::GrandpaVote;
+using kagome::network::VoteMessage;
+using kagome::network::detail::SeenVotes;
+
+struct SeenVotesTest : ::testing::Test {
+  static GrandpaVote makeVote(VoterSetId set_id,
+                              RoundNumber round,
+                              uint8_t voter) {
+    VoteMessage msg{.round_number = round, .counter = set_id};
+    msg.vote.message = Prevote{1, "A"_hash256};
+    msg.vote.id[0] = voter;
+    return GrandpaVote{std::move(msg)};
+  }
+
+  SeenVotes seen_votes_{2, 2};
+};
+
+/**
+ * @given remembered vote
+ * @when the same vote received again
+ * @then it is seen, while other votes are not
+ */
+TEST_F(SeenVotesTest, RememberedVoteIsSeen) {
+  EXPECT_FALSE(seen_votes_.isSeen(makeVote(0, 1, 1)));
+  seen_votes_.remember(makeVote(0, 1, 1));
+  EXPECT_TRUE(seen_votes_.isSeen(makeVote(0, 1, 1)));
+  EXPECT_FALSE(seen_votes_.isSeen(makeVote(0, 1, 2)));
+  EXPECT_FALSE(seen_votes_.isSeen(makeVote(0, 2, 1)));
+  EXPECT_FALSE(seen_votes_.isSeen(makeVote(1, 1, 1)));
+}
+
+/**
+ * @given remembered vote
+ * @when vote with the same voter and signature but other content received
+ * @then it is not seen
+ */
+TEST_F(SeenVotesTest, WholeVoteIsCompared) {
+  seen_votes_.remember(makeVote(0, 1, 1));
+
+  auto other_block = makeVote(0, 1, 1);
+  other_block.vote.message = Prevote{1, "B"_hash256};
+  EXPECT_FALSE(seen_votes_.isSeen(other_block));
+
+  auto other_kind = makeVote(0, 1, 1);
+  other_kind.vote.message = Precommit{1, "A"_hash256};
+  EXPECT_FALSE(seen_votes_.isSeen(other_kind));
+}
+
+/**
+ * @given votes of two rounds
+ * @when vote of newer round remembered
+ * @then votes of the oldest round are forgotten,
+ * and votes older than tracked rounds are not remembered
+ */
+TEST_F(SeenVotesTest, OldestRoundEvicted) {
+  seen_votes_.remember(makeVote(0, 1, 1));
+  seen_votes_.remember(makeVote(0, 2, 1));
+  seen_votes_.remember(makeVote(0, 3, 1));
+  EXPECT_FALSE(seen_votes_.isSeen(makeVote(0, 1, 1)));
+  seen_votes_.remember(makeVote(0, 1, 1));
+  EXPECT_FALSE(seen_votes_.isSeen(makeVote(0, 1, 1)));
+  EXPECT_TRUE(seen_votes_.isSeen(makeVote(0, 2, 1)));
+  EXPECT_TRUE(seen_votes_.isSeen(makeVote(0, 3, 1)));
+}
+
+/**
+ * @given round with votes up to capacity
+ * @when one more vote of the round remembered
+ * @then it is not seen
+ */
+TEST_F(SeenVotesTest, RoundCapacityRespected) {
+  seen_votes_.remember(makeVote(0, 1, 1));
+  seen_votes_.remember(makeVote(0, 1, 2));
+  seen_votes_.remember(makeVote(0, 1, 3));
+  EXPECT_FALSE(seen_votes_.isSeen(makeVote(0, 1, 3)));
+  EXPECT_TRUE(seen_votes_.isSeen(makeVote(0, 1, 1)));
+  EXPECT_TRUE(seen_votes_.isSeen(makeVote(0, 1, 2)));
+}
@@ -0,0 +1,174 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/peer_scoring_impl.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::network::PeerScoringImpl;
+using libp2p::peer::PeerId;
+using std::chrono_literals::operator""ms;
+
+struct PeerScoringTest : ::testing::Test {
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    scoring_.addPeer(peer1_);
+    scoring_.addPeer(peer2_);
+  }
+
+  const std::string sync_{"/sync/2"};
+  const std::string grandpa_{"/grandpa/1"};
+  const PeerId peer1_{"peer1"_peerid};
+  const PeerId peer2_{"peer2"_peerid};
+  const PeerId peer3_{"peer3"_peerid};
+
+  PeerScoringImpl scoring_;
+};
+
+/**
+ * @given scoring of two peers
+ * @when no statistics are accounted yet
+ * @then peers have neutral score, and unknown peer has no score
+ */
+TEST_F(PeerScoringTest, NeutralScore) {
+  EXPECT_EQ(scoring_.score(peer1_), PeerScoringImpl::kNeutralScore);
+  EXPECT_EQ(scoring_.score(peer2_), PeerScoringImpl::kNeutralScore);
+  EXPECT_FALSE(scoring_.score(peer3_).has_value());
+  EXPECT_FALSE(scoring_.stats(peer3_).has_value());
+}
+
+/**
+ * @given two peers
+ * @when one of them responds faster and with more data
+ * @then it gets higher score, and the other one is the worst peer
+ */
+TEST_F(PeerScoringTest, FastPeerIsPreferred) {
+  for (auto i = 0; i < 5; ++i) {
+    scoring_.onResponse(peer1_, sync_, 50ms, 1 << 20);
+    scoring_.onResponse(peer2_, sync_, 2000ms, 64 << 10);
+  }
+  EXPECT_GT(scoring_.score(peer1_).value(), scoring_.score(peer2_).value());
+  EXPECT_EQ(scoring_.worstPeer(), peer2_);
+
+  auto stats = scoring_.stats(peer1_).value();
+  EXPECT_EQ(stats.protocols.at(sync_).requests, 5);
+  EXPECT_EQ(stats.protocols.at(sync_).latency, 50ms);
+
+  // Peer becomes slow, so its score falls down
+  for (auto i = 0; i < 20; ++i) {
+    scoring_.onResponse(peer1_, sync_, 5000ms, 1 << 10);
+    scoring_.onResponse(peer2_, sync_, 100ms, 1 << 20);
+  }
+  EXPECT_EQ(scoring_.worstPeer(), peer1_);
+}
+
+/**
+ * @given two peers responding equally
+ * @when requests to one of them fail
+ * @then it gets lower score
+ */
+TEST_F(PeerScoringTest, FailuresLowerScore) {
+  scoring_.onResponse(peer1_, sync_, 100ms, 1 << 16);
+  scoring_.onResponse(peer2_, sync_, 100ms, 1 << 16);
+  scoring_.onRequestFailed(peer1_, sync_);
+  scoring_.onRequestFailed(peer1_, sync_);
+
+  EXPECT_LT(scoring_.score(peer1_).value(), scoring_.score(peer2_).value());
+  EXPECT_EQ(scoring_.worstPeer(), peer1_);
+  EXPECT_EQ(scoring_.stats(peer1_)->protocols.at(sync_).failures, 2);
+}
+
+/**
+ * @given two peers
+ * @when one of them gossips mostly known messages
+ * @then it gets lower score
+ */
+TEST_F(PeerScoringTest, UselessMessagesLowerScore) {
+  for (auto i = 0; i < 10; ++i) {
+    scoring_.onMessage(peer1_, grandpa_, true);
+    scoring_.onMessage(peer2_, grandpa_, i == 0);
+  }
+  EXPECT_GT(scoring_.score(peer1_).value(), scoring_.score(peer2_).value());
+  EXPECT_EQ(scoring_.worstPeer(), peer2_);
+
+  auto stats = scoring_.stats(peer2_).value();
+  EXPECT_EQ(stats.protocols.at(grandpa_).messages, 10);
+  EXPECT_EQ(stats.protocols.at(grandpa_).useful_messages, 1);
+}
+
+/**
+ * @given scored peers
+ * @when the worst one is removed
+ * @then it is not scored anymore, and its statistics are ignored
+ */
+TEST_F(PeerScoringTest, RemovedPeerIsNotScored) {
+  scoring_.onRequestFailed(peer2_, sync_);
+  ASSERT_EQ(scoring_.worstPeer(), peer2_);
+
+  scoring_.removePeer(peer2_);
+  EXPECT_EQ(scoring_.worstPeer(), peer1_);
+  EXPECT_FALSE(scoring_.score(peer2_).has_value());
+
+  scoring_.onRequestFailed(peer2_, sync_);
+  EXPECT_FALSE(scoring_.stats(peer2_).has_value());
+
+  scoring_.removePeer(peer1_);
+  EXPECT_FALSE(scoring_.worstPeer().has_value());
+}
+
+/**
+ * @given peer, which responded over one protocol
+ * @when its throughput is asked
+ * @then throughput is known for that protocol only
+ */
+TEST_F(PeerScoringTest, ThroughputIsPerProtocol) {
+  EXPECT_FALSE(scoring_.throughput(peer1_, sync_).has_value());
+
+  scoring_.onResponse(peer1_, sync_, 500ms, 1000);
+  EXPECT_EQ(scoring_.throughput(peer1_, sync_), 2000.);
+  EXPECT_FALSE(scoring_.throughput(peer1_, grandpa_).has_value());
+  EXPECT_FALSE(scoring_.throughput(peer3_, sync_).has_value());
+
+  scoring_.onRequestFailed(peer2_, sync_);
+  EXPECT_FALSE(scoring_.throughput(peer2_, sync_).has_value());
+}
+
+/**
+ * @given scoring updated by one thread
+ * @when other threads read statistics at the same time
+ * @then reads see consistent statistics
+ */
+TEST_F(PeerScoringTest, ReadsFromOtherThreads) {
+  std::atomic_bool done{false};
+  std::vector<std::thread> readers;
+  for (auto i = 0; i < 2; ++i) {
+    readers.emplace_back([&] {
+      while (not done) {
+        if (auto stats = scoring_.stats(peer1_)) {
+          EXPECT_LE(stats->score, 1.);
+        }
+        scoring_.worstPeer();
+      }
+    });
+  }
+  for (auto i = 0; i < 1000; ++i) {
+    scoring_.onResponse(peer1_, sync_, 10ms, 1000);
+    scoring_.onMessage(peer1_, grandpa_, i % 2 == 0);
+  }
+  done = true;
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(scoring_.stats(peer1_)->protocols.at(sync_).requests, 1000);
+}
@@ -11,6 +11,7 @@
 #include "mock/core/blockchain/block_header_repository_mock.hpp"
 #include "network/types/state_request.hpp"
 #include "storage/in_memory/in_memory_storage.hpp"
+#include "storage/predefined_keys.hpp"
 #include "storage/trie/impl/trie_storage_backend_impl.hpp"
 #include "storage/trie/impl/trie_storage_impl.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
@@ -141,3 +142,68 @@ TEST_F(StateProtocolObserverTest, Simple) {
 
   ASSERT_EQ(response, ref);
 }
+
+/**
+ * @given trie state with a child state
+ * @when default state request, then request continuing from child state key
+ * @then child state entries follow its key; continuation returns the rest of
+ * child state and keys of main state after the child state key
+ */
+TEST_F(StateProtocolObserverTest, ChildState) {
+  EXPECT_OUTCOME_TRUE(child_batch, persistent_empty_batch());
+  std::ignore = child_batch->put("k1"_buf, "v1"_buf);
+  std::ignore = child_batch->put("k2"_buf, "v2"_buf);
+  EXPECT_OUTCOME_TRUE(child_root, child_batch->commit());
+
+  auto child_key = Buffer{kChildStorageDefaultPrefix}.put("child");
+  auto child_value = Buffer(child_root);
+  EXPECT_OUTCOME_TRUE(batch, persistent_empty_batch());
+  std::ignore = batch->put(child_key, child_value);
+  std::ignore = batch->put("zzz"_buf, "999"_buf);
+  EXPECT_OUTCOME_TRUE(hash, batch->commit());
+
+  auto header = makeBlockHeader(hash);
+  EXPECT_CALL(*headers_, getBlockHeader({"1"_hash256}))
+      .WillRepeatedly(testing::Return(header));
+
+  auto main_root = RootHash::fromSpan(std::vector<uint8_t>(32, 0)).value();
+
+  EXPECT_OUTCOME_TRUE(
+      response,
+      state_protocol_observer_->onStateRequest({.hash = "1"_hash256}));
+
+  StateResponse ref = {
+      .entries = {{
+                      .state_root = main_root,
+                      .entries = {{.key = child_key, .value = child_value},
+                                  {.key = "zzz"_buf, .value = "999"_buf}},
+                      .complete = true,
+                  },
+                  {
+                      .state_root = child_root,
+                      .entries = {{.key = "k1"_buf, .value = "v1"_buf},
+                                  {.key = "k2"_buf, .value = "v2"_buf}},
+                      .complete = true,
+                  }},
+  };
+  ASSERT_EQ(response, ref);
+
+  EXPECT_OUTCOME_TRUE(
+      continuation,
+      state_protocol_observer_->onStateRequest(
+          {.hash = "1"_hash256, .start = {child_key, "k1"_buf}}));
+
+  StateResponse continuation_ref = {
+      .entries = {{
+                      .state_root = main_root,
+                      .entries = {{.key = "zzz"_buf, .value = "999"_buf}},
+                      .complete = true,
+                  },
+                  {
+                      .state_root = child_root,
+                      .entries = {{.key = "k2"_buf, .value = "v2"_buf}},
+                      .complete = true,
+                  }},
+  };
+  ASSERT_EQ(continuation, continuation_ref);
+}
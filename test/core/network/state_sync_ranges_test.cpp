@@ -0,0 +1,176 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/state_sync_ranges.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::common::Buffer;
+using kagome::network::StateSyncRanges;
+using libp2p::peer::PeerId;
+
+struct StateSyncRangesTest : ::testing::Test {
+  const PeerId peer1_{"peer1"_peerid};
+  const PeerId peer2_{"peer2"_peerid};
+  const PeerId peer3_{"peer3"_peerid};
+  const StateSyncRanges::Clock::time_point now_{};
+};
+
+/**
+ * @given ranges split by first byte of key
+ * @when check keys on bounds of ranges
+ * @then each key belongs to exactly one range
+ */
+TEST_F(StateSyncRangesTest, RangesCoverKeySpace) {
+  StateSyncRanges ranges{4};
+  ASSERT_EQ(ranges.ranges().size(), 4u);
+
+  for (auto key : {Buffer{},
+                   Buffer{0x00},
+                   Buffer{0x3f, 0xff},
+                   Buffer{0x40},
+                   Buffer{0x40, 0x00},
+                   Buffer{0x80},
+                   Buffer{0xc0, 0x01},
+                   Buffer{0xff, 0xff}}) {
+    auto owners = std::count_if(
+        ranges.ranges().begin(),
+        ranges.ranges().end(),
+        [&](const auto &range) { return range.contains(key); });
+    EXPECT_EQ(owners, 1) << key.toHex();
+  }
+
+  EXPECT_TRUE(ranges.ranges()[0].contains(Buffer{0x40}));
+  EXPECT_TRUE(ranges.ranges()[1].contains(Buffer{0x40, 0x00}));
+}
+
+/**
+ * @given ranges
+ * @when several peers ask for a range
+ * @then each peer gets own range, busy peer gets nothing
+ */
+TEST_F(StateSyncRangesTest, PeersGetDifferentRanges) {
+  StateSyncRanges ranges{2};
+
+  EXPECT_EQ(ranges.assign(peer1_, now_), 0u);
+  EXPECT_EQ(ranges.assign(peer1_, now_), std::nullopt);
+  EXPECT_EQ(ranges.assign(peer2_, now_), 1u);
+  EXPECT_EQ(ranges.assign(peer3_, now_), std::nullopt);
+
+  EXPECT_TRUE(ranges.isAssigned(0, peer1_));
+  EXPECT_TRUE(ranges.isAssigned(1, peer2_));
+}
+
+/**
+ * @given range assigned to a peer
+ * @when request of the peer failed
+ * @then range is given to another peer
+ */
+TEST_F(StateSyncRangesTest, FailedRangeIsReassigned) {
+  StateSyncRanges ranges{1};
+
+  EXPECT_EQ(ranges.assign(peer1_, now_), 0u);
+  ranges.onFailed(0, peer1_);
+
+  EXPECT_FALSE(ranges.isAssigned(0, peer1_));
+  EXPECT_EQ(ranges.assign(peer2_, now_), 0u);
+}
+
+/**
+ * @given range assigned to a peer
+ * @when its request lasts too long
+ * @then range is taken over by another peer
+ */
+TEST_F(StateSyncRangesTest, StuckRangeIsReassigned) {
+  StateSyncRanges ranges{1};
+
+  EXPECT_EQ(ranges.assign(peer1_, now_), 0u);
+  EXPECT_EQ(ranges.assign(peer2_, now_), std::nullopt);
+
+  auto later = now_ + StateSyncRanges::kSlowRequestDuration
+             + std::chrono::seconds(1);
+  EXPECT_EQ(ranges.assign(peer2_, later), 0u);
+  EXPECT_FALSE(ranges.isAssigned(0, peer1_));
+  EXPECT_TRUE(ranges.isAssigned(0, peer2_));
+}
+
+/**
+ * @given range taken over from a peer, and then given back to it
+ * @when late response to the first request of the peer arrives
+ * @then only the latest request of the range is current
+ */
+TEST_F(StateSyncRangesTest, LateResponseIsNotCurrent) {
+  StateSyncRanges ranges{1};
+  auto stuck = StateSyncRanges::kSlowRequestDuration + std::chrono::seconds(1);
+
+  EXPECT_EQ(ranges.assign(peer1_, now_), 0u);
+  auto first = ranges.request(0);
+  EXPECT_EQ(ranges.assign(peer2_, now_ + stuck), 0u);
+  auto second = ranges.request(0);
+  EXPECT_EQ(ranges.assign(peer1_, now_ + 2 * stuck), 0u);
+  auto third = ranges.request(0);
+
+  EXPECT_TRUE(ranges.isAssigned(0, peer1_));
+  EXPECT_FALSE(ranges.isCurrent(0, first));
+  EXPECT_FALSE(ranges.isCurrent(0, second));
+  EXPECT_TRUE(ranges.isCurrent(0, third));
+
+  ranges.onLoaded(0, peer1_, {Buffer{0x10}}, false, now_ + 2 * stuck);
+  EXPECT_FALSE(ranges.isCurrent(0, third));
+  EXPECT_TRUE(ranges.isCurrent(0, ranges.request(0)));
+}
+
+/**
+ * @given two ranges, loaded by fast and slow peers
+ * @when fast peer completes its range
+ * @then fast peer takes over the range of slow one
+ */
+TEST_F(StateSyncRangesTest, SlowPeerRangeIsReassigned) {
+  // throughput as provided by peer scoring
+  std::unordered_map<PeerId, double> throughput;
+  StateSyncRanges ranges{2, [&](const PeerId &peer_id) {
+                           auto it = throughput.find(peer_id);
+                           return it == throughput.end()
+                                    ? std::nullopt
+                                    : std::make_optional(it->second);
+                         }};
+  auto second = std::chrono::seconds(1);
+
+  EXPECT_EQ(ranges.assign(peer1_, now_), 0u);
+  EXPECT_EQ(ranges.assign(peer2_, now_), 1u);
+
+  ranges.onLoaded(1, peer2_, {Buffer{0x90}}, false, now_ + second);
+  ranges.onLoaded(0, peer1_, {Buffer{0x10}}, true, now_ + second);
+  throughput.emplace(peer2_, 100);
+  throughput.emplace(peer1_, 10000);
+  EXPECT_FALSE(ranges.complete());
+
+  EXPECT_EQ(ranges.assign(peer1_, now_ + second), 1u);
+  EXPECT_TRUE(ranges.isAssigned(1, peer1_));
+  EXPECT_EQ(ranges.range(1).start, std::vector{Buffer{0x90}});
+
+  ranges.onLoaded(1, peer1_, {Buffer{0xff}}, true, now_ + 2 * second);
+  EXPECT_TRUE(ranges.complete());
+}
+
+/**
+ * @given peer failed requests too many times
+ * @when it asks for a range
+ * @then nothing is assigned
+ */
+TEST_F(StateSyncRangesTest, FailingPeerIsNotUsed) {
+  StateSyncRanges ranges{1};
+
+  for (size_t i = 0; i < StateSyncRanges::kMaxPeerFailures; ++i) {
+    ASSERT_EQ(ranges.assign(peer1_, now_), 0u);
+    ranges.onFailed(0, peer1_);
+  }
+  EXPECT_EQ(ranges.assign(peer1_, now_), std::nullopt);
+}
@@ -43,6 +43,43 @@ namespace kagome::network {
     std::shared_ptr<PeerRatingRepositoryMock> peer_rating_repository;
   };
 
+  /// Protocol with priority of transactions gossip
+  struct TransactionsProtocolMock : SyncProtocolMock {
+    OutboundPriority outboundPriority() const override {
+      return OutboundPriority::TRANSACTIONS;
+    }
+  };
+
+  /// Protocol with priority of consensus messages
+  struct ConsensusProtocolMock : StateProtocolMock {
+    OutboundPriority outboundPriority() const override {
+      return OutboundPriority::CONSENSUS;
+    }
+  };
+
+  /// Outgoing stream, which keeps callbacks of writes to complete them later
+  struct PendingWrites {
+    std::shared_ptr<StreamMock> stream = std::make_shared<StreamMock>();
+    std::vector<libp2p::basic::Writer::WriteCallbackFunc> callbacks;
+
+    explicit PendingWrites(const PeerId &peer_id) {
+      EXPECT_CALL(*stream, remotePeerId()).WillOnce(Return(peer_id));
+      EXPECT_CALL(*stream, isClosed()).WillRepeatedly(Return(false));
+      EXPECT_CALL(*stream, write(_, _, _))
+          .WillRepeatedly([this](gsl::span<const uint8_t>,
+                                 size_t bytes,
+                                 libp2p::basic::Writer::WriteCallbackFunc cb) {
+            callbacks.emplace_back(std::move(cb));
+          });
+    }
+
+    void complete(size_t index) {
+      // callback might write next message, so it is copied out of the vector
+      auto cb = callbacks.at(index);
+      cb(outcome::success(0));
+    }
+  };
+
   static constexpr int lucky_peers = 4;
 
   /// Mock PRNG that produces a ring sequence of [0-9]
@@ -110,4 +147,164 @@ namespace kagome::network {
     ASSERT_EQ(counter, lucky_peers);
   }
 
+  /**
+   * @given StreamEngine with several outgoing streams of the same protocol
+   * @when broadcasting a message
+   * @then each stream gets the same buffer with length prefixed SCALE-encoded
+   * message, i.e. the message is encoded only once
+   */
+  TEST_F(StreamEngineTest, BroadcastEncodesOnce) {
+    std::shared_ptr<ProtocolBase> protocol =
+        std::make_shared<StateProtocolMock>();
+    std::vector<PeerId> peer_ids{
+        "peer00"_peerid, "peer01"_peerid, "peer02"_peerid};
+
+    // buffer is released after broadcast, so its content is copied
+    std::vector<std::pair<const uint8_t *, std::vector<uint8_t>>> written;
+    for (auto &peer_id : peer_ids) {
+      auto stream = std::make_shared<StreamMock>();
+      EXPECT_CALL(*stream, remotePeerId()).WillOnce(Return(peer_id));
+      EXPECT_CALL(*stream, isClosed()).WillRepeatedly(Return(false));
+      EXPECT_CALL(*stream, write(_, _, _))
+          .WillOnce([&written](gsl::span<const uint8_t> in,
+                               size_t bytes,
+                               const auto &) {
+            ASSERT_EQ(in.size(), bytes);
+            written.emplace_back(in.data(),
+                                 std::vector<uint8_t>(in.begin(), in.end()));
+          });
+      EXPECT_OUTCOME_TRUE_1(
+          stream_engine->addOutgoing(std::move(stream), protocol));
+    }
+
+    auto msg = std::make_shared<int>(42);
+    stream_engine->broadcast<int>(protocol, msg);
+
+    ASSERT_EQ(written.size(), peer_ids.size());
+    std::vector<uint8_t> expected{4, 42, 0, 0, 0};
+    for (auto &[data, bytes] : written) {
+      EXPECT_EQ(data, written.front().first);
+      EXPECT_EQ(bytes, expected);
+    }
+  }
+
+  /**
+   * @given peer with outgoing streams of consensus and transactions protocols
+   * @when consensus message is sent while transactions are being written
+   * @then consensus message is written at once, queued transactions wait
+   * until it is written
+   */
+  TEST_F(StreamEngineTest, ConsensusGoesFirst) {
+    auto peer_id = "peer00"_peerid;
+    std::shared_ptr<ProtocolBase> consensus =
+        std::make_shared<ConsensusProtocolMock>();
+    std::shared_ptr<ProtocolBase> transactions =
+        std::make_shared<TransactionsProtocolMock>();
+
+    PendingWrites consensus_stream{peer_id};
+    PendingWrites transactions_stream{peer_id};
+    EXPECT_OUTCOME_TRUE_1(
+        stream_engine->addOutgoing(consensus_stream.stream, consensus));
+    EXPECT_OUTCOME_TRUE_1(
+        stream_engine->addOutgoing(transactions_stream.stream, transactions));
+
+    stream_engine->send(peer_id, transactions, std::make_shared<int>(1));
+    stream_engine->send(peer_id, transactions, std::make_shared<int>(2));
+    ASSERT_EQ(transactions_stream.callbacks.size(), 1u);
+
+    stream_engine->send(peer_id, consensus, std::make_shared<int>(3));
+    ASSERT_EQ(consensus_stream.callbacks.size(), 1u);
+
+    transactions_stream.complete(0);
+    ASSERT_EQ(transactions_stream.callbacks.size(), 1u);
+
+    consensus_stream.complete(0);
+    ASSERT_EQ(transactions_stream.callbacks.size(), 2u);
+  }
+
+  /**
+   * @given peer, which doesn't complete writes of transactions
+   * @when more transactions are sent than the queue can keep
+   * @then the oldest transactions are dropped
+   */
+  TEST_F(StreamEngineTest, QueueOverflowDropsOldest) {
+    auto peer_id = "peer00"_peerid;
+    std::shared_ptr<ProtocolBase> transactions =
+        std::make_shared<TransactionsProtocolMock>();
+
+    PendingWrites transactions_stream{peer_id};
+    EXPECT_OUTCOME_TRUE_1(
+        stream_engine->addOutgoing(transactions_stream.stream, transactions));
+
+    auto capacity = StreamEngine::kOutboundQueueCapacity[static_cast<size_t>(
+        OutboundPriority::TRANSACTIONS)];
+    size_t dropped = 5;
+    // The first message is written at once, others are queued
+    for (size_t i = 0; i < 1 + capacity + dropped; ++i) {
+      stream_engine->send(peer_id, transactions, std::make_shared<int>(i));
+    }
+    ASSERT_EQ(transactions_stream.callbacks.size(), 1u);
+
+    for (size_t i = 0; i < transactions_stream.callbacks.size(); ++i) {
+      transactions_stream.complete(i);
+    }
+    ASSERT_EQ(transactions_stream.callbacks.size(), 1 + capacity);
+  }
+
+
+  /**
+   * @given peer, which doesn't complete writes of transactions
+   * @when the same transaction is sent several times while being queued
+   * @then it is queued and written only once
+   */
+  TEST_F(StreamEngineTest, EqualMessagesAreCoalesced) {
+    auto peer_id = "peer00"_peerid;
+    std::shared_ptr<ProtocolBase> transactions =
+        std::make_shared<TransactionsProtocolMock>();
+
+    PendingWrites transactions_stream{peer_id};
+    EXPECT_OUTCOME_TRUE_1(
+        stream_engine->addOutgoing(transactions_stream.stream, transactions));
+
+    // The first message is written at once, others are queued
+    stream_engine->send(peer_id, transactions, std::make_shared<int>(0));
+    for (auto i = 0; i < 3; ++i) {
+      stream_engine->send(peer_id, transactions, std::make_shared<int>(1));
+    }
+    stream_engine->send(peer_id, transactions, std::make_shared<int>(2));
+
+    for (size_t i = 0; i < transactions_stream.callbacks.size(); ++i) {
+      transactions_stream.complete(i);
+    }
+    ASSERT_EQ(transactions_stream.callbacks.size(), 3u);
+  }
+
+  /**
+   * @given peer, which doesn't complete writes of consensus messages
+   * @when more consensus messages are sent than the queue can keep
+   * @then no consensus message is dropped, the peer is disconnected instead
+   */
+  TEST_F(StreamEngineTest, ConsensusOverflowDisconnectsPeer) {
+    auto peer_id = "peer00"_peerid;
+    std::shared_ptr<ProtocolBase> consensus =
+        std::make_shared<ConsensusProtocolMock>();
+
+    PendingWrites consensus_stream{peer_id};
+    EXPECT_OUTCOME_TRUE_1(
+        stream_engine->addOutgoing(consensus_stream.stream, consensus));
+
+    auto capacity = StreamEngine::kOutboundQueueCapacity[static_cast<size_t>(
+        OutboundPriority::CONSENSUS)];
+    // The first message is written at once, others are queued
+    for (size_t i = 0; i < 1 + capacity; ++i) {
+      stream_engine->send(peer_id, consensus, std::make_shared<int>(0));
+    }
+    ASSERT_TRUE(stream_engine->isAlive(peer_id, consensus));
+
+    EXPECT_CALL(*consensus_stream.stream, reset());
+    stream_engine->send(peer_id, consensus, std::make_shared<int>(0));
+    ASSERT_FALSE(stream_engine->isAlive(peer_id, consensus));
+    ASSERT_EQ(consensus_stream.callbacks.size(), 1u);
+  }
+
 }  // namespace kagome::network
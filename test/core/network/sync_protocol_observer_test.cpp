@@ -113,3 +113,97 @@ TEST_F(SynchronizerTest, ProcessRequest) {
   ASSERT_EQ(received_blocks[1].body, block4_.body);
   ASSERT_FALSE(received_blocks[1].justification);
 }
+
+/**
+ * @given synchronizer, whose finalized blocks up to requested end are
+ * requested
+ * @when the same request arrives again
+ * @then response is served from cache without reading blocks again
+ */
+TEST_F(SynchronizerTest, FinalizedResponseIsCached) {
+  // GIVEN
+  BlocksRequest received_request{BlocksRequest::kBasicAttributes,
+                                 block3_hash_,
+                                 block4_hash_,
+                                 Direction::ASCENDING,
+                                 std::nullopt};
+
+  EXPECT_CALL(*tree_, getLastFinalized())
+      .WillRepeatedly(Return(BlockInfo{10, "10"_hash256}));
+
+  EXPECT_CALL(*tree_,
+              getBestChainFromBlock(
+                  block3_hash_, AppConfiguration::kAbsolutMaxBlocksInResponse))
+      .WillOnce(Return(std::vector<BlockHash>{block3_hash_, block4_hash_}));
+
+  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block3_hash_}))
+      .WillOnce(Return(block3_.header));
+  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block4_hash_}))
+      .WillOnce(Return(block4_.header));
+
+  EXPECT_CALL(*tree_, getBlockBody(BlockId{block3_hash_}))
+      .WillOnce(Return(block3_.body));
+  EXPECT_CALL(*tree_, getBlockBody(BlockId{block4_hash_}))
+      .WillOnce(Return(block4_.body));
+
+  EXPECT_CALL(*tree_, getBlockJustification(_))
+      .Times(2)
+      .WillRepeatedly(Return(::outcome::failure(boost::system::error_code{})));
+
+  // WHEN
+  EXPECT_OUTCOME_TRUE(
+      response, sync_protocol_observer_->onBlocksRequest(received_request));
+  EXPECT_OUTCOME_TRUE(
+      cached, sync_protocol_observer_->onBlocksRequest(received_request));
+
+  // THEN
+  ASSERT_EQ(cached.blocks.size(), 2);
+  ASSERT_EQ(cached.blocks[0].hash, block3_hash_);
+  ASSERT_EQ(cached.blocks[0].body, block3_.body);
+  ASSERT_EQ(cached.blocks[1].hash, block4_hash_);
+  ASSERT_EQ(cached.blocks[1].header, block4_.header);
+}
+
+/**
+ * @given synchronizer, whose finalized blocks are requested, but response
+ * has less blocks than requested, so it might grow with new blocks
+ * @when the same request arrives again
+ * @then blocks are read again
+ */
+TEST_F(SynchronizerTest, ShortResponseIsNotCached) {
+  // GIVEN
+  BlocksRequest received_request{BlocksRequest::kBasicAttributes,
+                                 block3_hash_,
+                                 std::nullopt,
+                                 Direction::ASCENDING,
+                                 std::nullopt};
+
+  EXPECT_CALL(*tree_, getLastFinalized())
+      .WillRepeatedly(Return(BlockInfo{10, "10"_hash256}));
+
+  EXPECT_CALL(*tree_,
+              getBestChainFromBlock(
+                  block3_hash_, AppConfiguration::kAbsolutMaxBlocksInResponse))
+      .Times(2)
+      .WillRepeatedly(Return(std::vector<BlockHash>{block3_hash_}));
+
+  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block3_hash_}))
+      .Times(2)
+      .WillRepeatedly(Return(block3_.header));
+  EXPECT_CALL(*tree_, getBlockBody(BlockId{block3_hash_}))
+      .Times(2)
+      .WillRepeatedly(Return(block3_.body));
+  EXPECT_CALL(*tree_, getBlockJustification(_))
+      .Times(2)
+      .WillRepeatedly(Return(::outcome::failure(boost::system::error_code{})));
+
+  // WHEN
+  EXPECT_OUTCOME_TRUE(
+      response, sync_protocol_observer_->onBlocksRequest(received_request));
+  EXPECT_OUTCOME_TRUE(
+      again, sync_protocol_observer_->onBlocksRequest(received_request));
+
+  // THEN
+  ASSERT_EQ(again.blocks.size(), 1);
+  ASSERT_EQ(again.blocks[0].hash, block3_hash_);
+}
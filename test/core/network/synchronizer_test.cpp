@@ -12,10 +12,14 @@
 #include "mock/core/application/app_configuration_mock.hpp"
 #include "mock/core/application/app_state_manager_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/consensus/authority/authority_manager_mock.hpp"
 #include "mock/core/consensus/babe/block_appender_mock.hpp"
 #include "mock/core/consensus/babe/block_executor_mock.hpp"
+#include "mock/core/crypto/ed25519_provider_mock.hpp"
 #include "mock/core/crypto/hasher_mock.hpp"
 #include "mock/core/network/protocols/sync_protocol_mock.hpp"
+#include "mock/core/network/peer_scoring_mock.hpp"
+#include "mock/core/network/rating_repository_mock.hpp"
 #include "mock/core/network/router_mock.hpp"
 #include "mock/core/storage/changes_trie/changes_tracker_mock.hpp"
 #include "mock/core/storage/persistent_map_mock.hpp"
@@ -86,7 +90,11 @@ class SynchronizerTest
                                                     router,
                                                     scheduler,
                                                     hasher,
-                                                    buffer_storage);
+                                                    buffer_storage,
+                                                    peer_rating_repository,
+                                                    peer_scoring,
+                                                    authority_manager,
+                                                    ed25519_provider);
   }
 
   application::AppConfigurationMock app_config;
@@ -120,6 +128,15 @@ class SynchronizerTest
                                             common::Buffer,
                                             common::BufferView>>();
 
+  std::shared_ptr<network::PeerRatingRepositoryMock> peer_rating_repository =
+      std::make_shared<network::PeerRatingRepositoryMock>();
+  std::shared_ptr<network::PeerScoringMock> peer_scoring =
+      std::make_shared<network::PeerScoringMock>();
+  std::shared_ptr<authority::AuthorityManagerMock> authority_manager =
+      std::make_shared<authority::AuthorityManagerMock>();
+  std::shared_ptr<crypto::Ed25519ProviderMock> ed25519_provider =
+      std::make_shared<crypto::Ed25519ProviderMock>();
+
   std::shared_ptr<network::SynchronizerImpl> synchronizer;
 
   libp2p::peer::PeerId peer_id = ""_peerid;
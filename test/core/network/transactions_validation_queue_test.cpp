@@ -0,0 +1,166 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/transactions_validation_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+
+#include <boost/asio/io_context.hpp>
+#include <gtest/gtest.h>
+
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/network/extrinsic_observer_mock.hpp"
+#include "primitives/transaction_validity.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "transaction_pool/transaction_pool_error.hpp"
+
+using kagome::common::Buffer;
+using kagome::common::Hash256;
+using kagome::crypto::HasherImpl;
+using kagome::network::ExtrinsicObserverMock;
+using kagome::network::TransactionsValidationQueue;
+using kagome::primitives::Extrinsic;
+using kagome::primitives::InvalidTransaction;
+using kagome::primitives::Transaction;
+using kagome::transaction_pool::TransactionPoolError;
+using libp2p::peer::PeerId;
+using testing::_;
+using testing::Return;
+
+struct TransactionsValidationQueueTest : ::testing::Test {
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    config_.threads = 1;
+  }
+
+  void makeQueue() {
+    queue_ = std::make_shared<TransactionsValidationQueue>(
+        observer_, std::make_shared<HasherImpl>(), main_context_, config_);
+  }
+
+  /// Expects given number of validations, each resulting in {@param result}
+  void expectValidations(size_t times,
+                         outcome::result<Transaction> result) {
+    EXPECT_CALL(*observer_, validateTx(_))
+        .Times(times)
+        .WillRepeatedly([this, times, result](const Extrinsic &) {
+          if (++validated_ == times) {
+            done_.set_value();
+          }
+          return result;
+        });
+  }
+
+  /**
+   * Waits for expected validations, stops the queue and submits validated
+   * transactions on the main context
+   */
+  void waitValidations() {
+    ASSERT_EQ(done_.get_future().wait_for(std::chrono::seconds(5)),
+              std::future_status::ready);
+    queue_->stop();
+    main_context_->run();
+  }
+
+  const PeerId peer1_{"peer1"_peerid};
+  const PeerId peer2_{"peer2"_peerid};
+  std::shared_ptr<ExtrinsicObserverMock> observer_ =
+      std::make_shared<ExtrinsicObserverMock>();
+  std::shared_ptr<boost::asio::io_context> main_context_ =
+      std::make_shared<boost::asio::io_context>();
+  TransactionsValidationQueue::Config config_;
+  std::shared_ptr<TransactionsValidationQueue> queue_;
+  std::atomic_size_t validated_{0};
+  std::promise<void> done_;
+};
+
+/**
+ * @given validation queue
+ * @when the same transaction is received from several peers
+ * @then it is validated once
+ */
+TEST_F(TransactionsValidationQueueTest, DuplicatesAreValidatedOnce) {
+  makeQueue();
+  expectValidations(2, Transaction{});
+  EXPECT_CALL(*observer_, submitTx(_))
+      .Times(2)
+      .WillRepeatedly(Return(Hash256{}));
+  queue_->start();
+
+  EXPECT_TRUE(queue_->push(peer1_, Extrinsic{Buffer{1}}));
+  EXPECT_FALSE(queue_->push(peer2_, Extrinsic{Buffer{1}}));
+  EXPECT_TRUE(queue_->push(peer2_, Extrinsic{Buffer{2}}));
+  waitValidations();
+
+  // Results of validation are remembered
+  EXPECT_FALSE(queue_->push(peer1_, Extrinsic{Buffer{1}}));
+  EXPECT_FALSE(queue_->push(peer1_, Extrinsic{Buffer{2}}));
+}
+
+/**
+ * @given validation queue
+ * @when transaction is rejected by validation as invalid
+ * @then its copies received later are not validated again
+ */
+TEST_F(TransactionsValidationQueueTest, InvalidAreRemembered) {
+  makeQueue();
+  expectValidations(1, InvalidTransaction::BadProof);
+  EXPECT_CALL(*observer_, submitTx(_)).Times(0);
+  queue_->start();
+
+  EXPECT_TRUE(queue_->push(peer1_, Extrinsic{Buffer{1}}));
+  waitValidations();
+
+  EXPECT_FALSE(queue_->push(peer2_, Extrinsic{Buffer{1}}));
+}
+
+/**
+ * @given validation queue
+ * @when transaction is rejected for a transient reason: by validation as
+ * coming from the future, or by the pool as it is full
+ * @then its copies received later are accepted for validation
+ */
+TEST_F(TransactionsValidationQueueTest, TransientRejectionsAreForgotten) {
+  makeQueue();
+  EXPECT_CALL(*observer_, validateTx(_))
+      .WillOnce(Return(InvalidTransaction::Future))
+      .WillOnce([this](const Extrinsic &) {
+        done_.set_value();
+        return Transaction{};
+      });
+  EXPECT_CALL(*observer_, submitTx(_))
+      .WillOnce(Return(TransactionPoolError::POOL_IS_FULL));
+  queue_->start();
+
+  EXPECT_TRUE(queue_->push(peer1_, Extrinsic{Buffer{1}}));
+  EXPECT_TRUE(queue_->push(peer1_, Extrinsic{Buffer{2}}));
+  waitValidations();
+
+  EXPECT_TRUE(queue_->push(peer2_, Extrinsic{Buffer{1}}));
+  EXPECT_TRUE(queue_->push(peer2_, Extrinsic{Buffer{2}}));
+}
+
+/**
+ * @given validation queue with rate limit of peers and no workers running
+ * @when peer sends more transactions than allowed
+ * @then transactions over the limit are dropped, other peers are not affected
+ */
+TEST_F(TransactionsValidationQueueTest, PeerRateIsLimited) {
+  config_.peer_rate = 0;
+  config_.peer_burst = 2;
+  makeQueue();
+  EXPECT_CALL(*observer_, validateTx(_)).Times(0);
+
+  EXPECT_TRUE(queue_->push(peer1_, Extrinsic{Buffer{1}}));
+  EXPECT_TRUE(queue_->push(peer1_, Extrinsic{Buffer{2}}));
+  EXPECT_FALSE(queue_->push(peer1_, Extrinsic{Buffer{3}}));
+  EXPECT_TRUE(queue_->push(peer2_, Extrinsic{Buffer{3}}));
+}
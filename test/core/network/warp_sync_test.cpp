@@ -0,0 +1,365 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "blockchain/block_tree_error.hpp"
+#include "crypto/ed25519/ed25519_provider_impl.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "crypto/random_generator/boost_generator.hpp"
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "network/impl/warp_proof_verifier.hpp"
+#include "network/impl/warp_protocol_observer_impl.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::application::AppStateManagerMock;
+using kagome::blockchain::BlockHeaderRepositoryMock;
+using kagome::blockchain::BlockTreeError;
+using kagome::blockchain::BlockTreeMock;
+using kagome::consensus::grandpa::GrandpaJustification;
+using kagome::consensus::grandpa::Precommit;
+using kagome::consensus::grandpa::SignedPrecommit;
+using kagome::consensus::grandpa::Vote;
+using kagome::crypto::BoostRandomGenerator;
+using kagome::crypto::Ed25519Keypair;
+using kagome::crypto::Ed25519ProviderImpl;
+using kagome::crypto::Ed25519Seed;
+using kagome::crypto::HasherImpl;
+using kagome::network::WarpProofVerifier;
+using kagome::network::WarpProtocolObserverImpl;
+using kagome::network::WarpRequest;
+using kagome::network::WarpSyncProof;
+using kagome::primitives::Authority;
+using kagome::primitives::AuthorityList;
+using kagome::primitives::AuthoritySet;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockId;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::BlockNumber;
+using kagome::primitives::Consensus;
+using kagome::primitives::ForcedChange;
+using kagome::primitives::Justification;
+using kagome::primitives::ScheduledChange;
+using kagome::primitives::events::ChainSubscriptionEngine;
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+/**
+ * Recorded chain of 14 blocks: block #5 schedules change to authority set #1,
+ * block #10 schedules change to authority set #2, and block #13 is the latest
+ * finalized one. Each of these blocks is justified by all authorities of the
+ * set in force.
+ */
+class WarpSyncTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    for (uint8_t i = 0; i < 9; ++i) {
+      Ed25519Seed seed;
+      seed.fill(i + 1);
+      keys_.emplace_back(ed25519_provider_->generateKeypair(seed));
+    }
+    for (size_t set_id = 0; set_id < 3; ++set_id) {
+      AuthorityList authorities;
+      for (size_t i = 0; i < 3; ++i) {
+        authorities.emplace_back(
+            Authority{{keys_[set_id * 3 + i].public_key}, 1});
+      }
+      sets_.emplace_back(set_id, std::move(authorities));
+    }
+
+    for (BlockNumber number = 0; number <= kFinalized; ++number) {
+      BlockHeader header;
+      header.number = number;
+      if (number != 0) {
+        header.parent_hash = hashes_.back();
+      }
+      if (number == 5) {
+        header.digest.emplace_back(
+            Consensus{ScheduledChange{sets_[1].authorities, 0}});
+      } else if (number == 10) {
+        header.digest.emplace_back(
+            Consensus{ScheduledChange{sets_[2].authorities, 0}});
+      }
+      hashes_.emplace_back(hasher_->blake2b_256(scale::encode(header).value()));
+      headers_.emplace_back(std::move(header));
+    }
+    justifications_.emplace(5, justify(5, 0, keys_.size()));
+    justifications_.emplace(10, justify(10, 1, keys_.size()));
+    justifications_.emplace(kFinalized, justify(kFinalized, 2, keys_.size()));
+
+    EXPECT_CALL(*block_tree_, getLastFinalized())
+        .WillRepeatedly(Return(BlockInfo{kFinalized, hashes_[kFinalized]}));
+    EXPECT_CALL(*block_tree_, getBlockJustification(_))
+        .WillRepeatedly(Invoke(
+            [this](const BlockId &id) -> outcome::result<Justification> {
+              auto it = justifications_.find(numberOf(id));
+              if (it == justifications_.end()) {
+                return BlockTreeError::JUSTIFICATION_NOT_FOUND;
+              }
+              Justification justification;
+              justification.data.put(scale::encode(it->second).value());
+              return justification;
+            }));
+    EXPECT_CALL(*headers_repo_, getNumberByHash(_))
+        .WillRepeatedly(Invoke([this](const BlockHash &hash) {
+          return numberOf(hash);
+        }));
+    EXPECT_CALL(*headers_repo_, getHashByNumber(_))
+        .WillRepeatedly(Invoke([this](const BlockNumber &number) {
+          return hashes_.at(number);
+        }));
+    EXPECT_CALL(*headers_repo_, getBlockHeader(_))
+        .WillRepeatedly(Invoke([this](const BlockId &id) {
+          return headers_.at(numberOf(id));
+        }));
+
+    observer_ = makeObserver();
+    observer_->prepare();
+    observer_->start();
+    waitIndexed();
+  }
+
+  void TearDown() override {
+    observer_->stop();
+  }
+
+ protected:
+  static constexpr BlockNumber kFinalized = 13;
+
+  std::shared_ptr<WarpProtocolObserverImpl> makeObserver() {
+    auto app_state_manager = std::make_shared<AppStateManagerMock>();
+    EXPECT_CALL(*app_state_manager, atPrepare(_)).WillOnce(Return());
+    EXPECT_CALL(*app_state_manager, atLaunch(_)).WillOnce(Return());
+    EXPECT_CALL(*app_state_manager, atShutdown(_)).WillOnce(Return());
+    return std::make_shared<WarpProtocolObserverImpl>(
+        app_state_manager,
+        block_tree_,
+        headers_repo_,
+        std::make_shared<ChainSubscriptionEngine>());
+  }
+
+  /// Waits until finalized blocks are indexed on the observer's thread
+  void waitIndexed() {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (observer_->onWarpRequest(WarpRequest{hashes_[kFinalized]})
+           == outcome::failure(
+               WarpProtocolObserverImpl::Error::INDEX_IS_NOT_READY)) {
+      ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  BlockNumber numberOf(const BlockId &id) const {
+    if (auto number = boost::get<BlockNumber>(&id)) {
+      return *number;
+    }
+    auto it = std::find(
+        hashes_.begin(), hashes_.end(), boost::get<BlockHash>(id));
+    return it - hashes_.begin();
+  }
+
+  /// @return justification of block signed by {@param signers} first
+  /// authorities of the set, i-th of which votes for block {@param number} +
+  /// i * {@param step}
+  GrandpaJustification justify(BlockNumber number,
+                               size_t set_id,
+                               size_t signers,
+                               BlockNumber step = 0) const {
+    GrandpaJustification justification;
+    justification.round_number = 1;
+    justification.block_info = {number, hashes_.at(number)};
+    for (size_t i = 0; i < std::min<size_t>(signers, 3); ++i) {
+      auto &keypair = keys_[set_id * 3 + i];
+      auto target = number + i * step;
+      Vote vote = Precommit{target, hashes_.at(target)};
+      auto payload =
+          scale::encode(vote, justification.round_number, set_id).value();
+      SignedPrecommit precommit;
+      precommit.message = vote;
+      precommit.signature = ed25519_provider_->sign(keypair, payload).value();
+      precommit.id = keypair.public_key;
+      justification.items.emplace_back(std::move(precommit));
+    }
+    return justification;
+  }
+
+  WarpProofVerifier makeVerifier() const {
+    return WarpProofVerifier{
+        ed25519_provider_, hasher_, {0, hashes_[0]}, sets_[0]};
+  }
+
+  std::shared_ptr<HasherImpl> hasher_ = std::make_shared<HasherImpl>();
+  std::shared_ptr<Ed25519ProviderImpl> ed25519_provider_ =
+      std::make_shared<Ed25519ProviderImpl>(
+          std::make_shared<BoostRandomGenerator>());
+  std::shared_ptr<BlockTreeMock> block_tree_ =
+      std::make_shared<BlockTreeMock>();
+  std::shared_ptr<BlockHeaderRepositoryMock> headers_repo_ =
+      std::make_shared<BlockHeaderRepositoryMock>();
+
+  std::vector<Ed25519Keypair> keys_;
+  std::vector<AuthoritySet> sets_;
+  std::vector<BlockHeader> headers_;
+  std::vector<BlockHash> hashes_;
+  std::map<BlockNumber, GrandpaJustification> justifications_;
+
+  std::shared_ptr<WarpProtocolObserverImpl> observer_;
+};
+
+/**
+ * @given recorded chain with two changes of authority set
+ * @when proof is requested from genesis and verified
+ * @then proof reaches the latest finalized block with the last authority set
+ */
+TEST_F(WarpSyncTest, ProofFromGenesisIsVerified) {
+  EXPECT_OUTCOME_TRUE(proof, observer_->onWarpRequest(WarpRequest{hashes_[0]}));
+  ASSERT_TRUE(proof.is_finished);
+  ASSERT_EQ(proof.proofs.size(), 3);
+  EXPECT_EQ(proof.proofs[0].header.number, 5);
+  EXPECT_EQ(proof.proofs[1].header.number, 10);
+  EXPECT_EQ(proof.proofs[2].header.number, kFinalized);
+
+  auto verifier = makeVerifier();
+  EXPECT_OUTCOME_TRUE_1(verifier.verify(proof));
+  EXPECT_TRUE(verifier.finished());
+  EXPECT_EQ(verifier.block(), (BlockInfo{kFinalized, hashes_[kFinalized]}));
+  EXPECT_EQ(verifier.authorities(), sets_[2]);
+  ASSERT_TRUE(verifier.justification().has_value());
+  EXPECT_EQ(verifier.justification()->data,
+            kagome::common::Buffer{
+                scale::encode(justifications_[kFinalized]).value()});
+}
+
+/**
+ * @given recorded chain with two changes of authority set
+ * @when proof is requested from the block of the first change
+ * @then proof contains only the following change and the finalized block
+ */
+TEST_F(WarpSyncTest, ProofStartsAfterBegin) {
+  EXPECT_OUTCOME_TRUE(proof, observer_->onWarpRequest(WarpRequest{hashes_[5]}));
+  ASSERT_EQ(proof.proofs.size(), 2);
+  EXPECT_EQ(proof.proofs[0].header.number, 10);
+  EXPECT_EQ(proof.proofs[1].header.number, kFinalized);
+  EXPECT_TRUE(proof.is_finished);
+}
+
+/**
+ * @given proof, the first justification of which is signed by 2 of 3
+ * authorities
+ * @when the proof is verified
+ * @then verification fails, as super-majority of 3 authorities is 3
+ */
+TEST_F(WarpSyncTest, NotEnoughWeight) {
+  justifications_[5] = justify(5, 0, 2);
+  EXPECT_OUTCOME_TRUE(proof, observer_->onWarpRequest(WarpRequest{hashes_[0]}));
+
+  auto verifier = makeVerifier();
+  EXPECT_OUTCOME_ERROR(
+      res, verifier.verify(proof), WarpProofVerifier::Error::NOT_ENOUGH_WEIGHT);
+  EXPECT_EQ(verifier.block().number, 0);
+  EXPECT_FALSE(verifier.finished());
+}
+
+/**
+ * @given proof, precommit of which is signed for other authority set
+ * @when the proof is verified
+ * @then verification fails on invalid signature
+ */
+TEST_F(WarpSyncTest, InvalidSignature) {
+  auto justification = justify(10, 0, 3);
+  justification.items[0].id = keys_[3].public_key;
+  justifications_[10] = justification;
+  EXPECT_OUTCOME_TRUE(proof, observer_->onWarpRequest(WarpRequest{hashes_[0]}));
+
+  auto verifier = makeVerifier();
+  EXPECT_OUTCOME_ERROR(
+      res, verifier.verify(proof), WarpProofVerifier::Error::INVALID_SIGNATURE);
+  // the first fragment is still applied
+  EXPECT_EQ(verifier.block().number, 5);
+  EXPECT_EQ(verifier.authorities(), sets_[1]);
+}
+
+/**
+ * @given unfinished proof, the last fragment of which doesn't change
+ * authority set
+ * @when the proof is verified
+ * @then verification fails
+ */
+TEST_F(WarpSyncTest, FragmentWithoutChange) {
+  EXPECT_OUTCOME_TRUE(proof, observer_->onWarpRequest(WarpRequest{hashes_[5]}));
+  proof.is_finished = false;
+
+  auto verifier = WarpProofVerifier{
+      ed25519_provider_, hasher_, {5, hashes_[5]}, sets_[1]};
+  EXPECT_OUTCOME_ERROR(res,
+                       verifier.verify(proof),
+                       WarpProofVerifier::Error::NO_AUTHORITY_SET_CHANGE);
+}
+
+/**
+ * @given observer, which has not indexed finalized blocks yet
+ * @when proof is requested
+ * @then request is rejected
+ */
+TEST_F(WarpSyncTest, IndexIsNotReady) {
+  auto observer = makeObserver();
+  EXPECT_OUTCOME_ERROR(res,
+                       observer->onWarpRequest(WarpRequest{hashes_[0]}),
+                       WarpProtocolObserverImpl::Error::INDEX_IS_NOT_READY);
+}
+
+/**
+ * @given proof, precommits of the first justification of which vote for
+ * descendants of the justified block
+ * @when the proof is verified
+ * @then the votes are counted due to ancestry headers in the fragment, and
+ * not counted without them
+ */
+TEST_F(WarpSyncTest, VotesForDescendants) {
+  justifications_[5] = justify(5, 0, 3, 1);
+  EXPECT_OUTCOME_TRUE(proof, observer_->onWarpRequest(WarpRequest{hashes_[0]}));
+  ASSERT_EQ(proof.proofs[0].votes_ancestries.size(), 2);
+
+  auto verifier = makeVerifier();
+  EXPECT_OUTCOME_TRUE_1(verifier.verify(proof));
+  EXPECT_TRUE(verifier.finished());
+
+  proof.proofs[0].votes_ancestries.pop_back();
+  auto incomplete_verifier = makeVerifier();
+  EXPECT_OUTCOME_ERROR(res,
+                       incomplete_verifier.verify(proof),
+                       WarpProofVerifier::Error::NOT_ENOUGH_WEIGHT);
+}
+
+/**
+ * @given proof, the second fragment of which forces change of authority set
+ * @when the proof is verified
+ * @then verification fails explicitly on forced change, and only the first
+ * fragment is applied
+ */
+TEST_F(WarpSyncTest, ForcedChangeIsReported) {
+  EXPECT_OUTCOME_TRUE(proof, observer_->onWarpRequest(WarpRequest{hashes_[0]}));
+  proof.proofs[1].header.digest.emplace_back(
+      Consensus{ForcedChange{sets_[2].authorities, 0, 10}});
+
+  auto verifier = makeVerifier();
+  EXPECT_OUTCOME_ERROR(
+      res, verifier.verify(proof), WarpProofVerifier::Error::FORCED_CHANGE);
+  EXPECT_EQ(verifier.block().number, 5);
+  EXPECT_FALSE(verifier.finished());
+}
@@ -125,6 +125,20 @@ TEST_F(Primitives, EncodeExtrinsicSuccess) {
   ASSERT_EQ(extrinsic_, decoded_extrinsic);
 }
 
+/**
+ * @given predefined extrinsic
+ * @when it is encoded by parts
+ * @then parts joined together are the same as its SCALE encoding
+ */
+TEST_F(Primitives, EncodeExtrinsicByParts) {
+  EXPECT_OUTCOME_TRUE(expected, encode(extrinsic_));
+  auto encoded = kagome::primitives::encodeExtrinsic(extrinsic_);
+  ASSERT_EQ(encoded.size(), expected.size());
+  auto joined = encoded.length;
+  joined.insert(joined.end(), encoded.data.begin(), encoded.data.end());
+  ASSERT_EQ(joined, expected);
+}
+
 /**
  * @given predefined instance of Block
  * @when encodeBlock is applied
@@ -25,7 +25,10 @@ using kagome::blockchain::BlockHeaderRepositoryMock;
 using kagome::common::Buffer;
 using kagome::primitives::BlockHash;
 using kagome::primitives::ExtrinsicIndex;
+using kagome::primitives::events::ChainEventSubscriber;
+using kagome::primitives::events::ChainEventType;
 using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::primitives::events::StorageEventSubscriber;
 using kagome::primitives::events::StorageSubscriptionEngine;
 using kagome::storage::InMemoryStorage;
 using kagome::storage::changes_trie::ChangesTracker;
@@ -78,3 +81,47 @@ TEST(ChangesTrieTest, IntegrationWithOverlay) {
 
   // THEN SUCCESS
 }
+
+/**
+ * @given changes tracker with storage subscriber of two keys
+ * @when block changing these keys and one more is added
+ * @then subscriber is notified about both changes, and then about the end of
+ * the block changes, so it can send them at once
+ */
+TEST(ChangesTrieTest, NotifiesEndOfBlockChanges) {
+  testutil::prepareLoggers();
+
+  auto storage_subscription_engine =
+      std::make_shared<StorageSubscriptionEngine>();
+  auto chain_subscription_engine = std::make_shared<ChainSubscriptionEngine>();
+  StorageChangesTrackerImpl changes_tracker(storage_subscription_engine,
+                                            chain_subscription_engine);
+
+  std::vector<std::string> events;
+  auto storage_sub = std::make_shared<StorageEventSubscriber>(
+      storage_subscription_engine, nullptr);
+  auto storage_set_id = storage_sub->generateSubscriptionSetId();
+  storage_sub->subscribe(storage_set_id, "abc"_buf);
+  storage_sub->subscribe(storage_set_id, "cde"_buf);
+  storage_sub->setCallback(
+      [&](auto set_id, auto &, auto &key, auto &value, auto &block) {
+        EXPECT_EQ(set_id, storage_set_id);
+        EXPECT_EQ(block, "aaa"_hash256);
+        events.emplace_back(key.toString() + "=" + value->toString());
+      });
+  auto chain_sub = std::make_shared<ChainEventSubscriber>(
+      chain_subscription_engine, nullptr);
+  chain_sub->subscribe(chain_sub->generateSubscriptionSetId(),
+                       ChainEventType::kStorageChangesNotified);
+  chain_sub->setCallback(
+      [&](auto, auto &, auto, auto &) { events.emplace_back("end"); });
+
+  changes_tracker.onBlockExecutionStart("aaa"_hash256);
+  changes_tracker.onPut("abc"_buf, "123"_buf, true);
+  changes_tracker.onPut("cde"_buf, "345"_buf, true);
+  changes_tracker.onPut("xyz"_buf, "678"_buf, true);
+  changes_tracker.onBlockAdded("bbb"_hash256);
+
+  EXPECT_EQ(events,
+            (std::vector<std::string>{"abc=123", "cde=345", "end"}));
+}
@@ -130,3 +130,32 @@ TEST_F(LevelDB_Integration_Test, Iterator) {
     EXPECT_EQ(counter[i], 1);
   }
 }
+
+/**
+ * @given opened database with {key}, and its secondary instance
+ * @when another key is put to database
+ * @then secondary instance reads {key} at once, and another key after catch
+ * up only, and can't be written
+ */
+TEST_F(LevelDB_Integration_Test, SecondaryFollowsPrimary) {
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(key_, value_));
+  ASSERT_OUTCOME_SUCCESS(
+      secondary,
+      RocksDB::createSecondary(getPathString(),
+                               fs::path(getPathString()) / "secondary"));
+  EXPECT_OUTCOME_TRUE_2(val, secondary->load(key_));
+  EXPECT_EQ(val, value_);
+
+  Buffer another_key{4, 2};
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(another_key, value_));
+  ASSERT_OUTCOME_SUCCESS(stale, secondary->tryLoad(another_key));
+  EXPECT_FALSE(stale.has_value());
+
+  ASSERT_OUTCOME_SUCCESS_TRY(secondary->tryCatchUpWithPrimary());
+  ASSERT_OUTCOME_SUCCESS(fresh, secondary->tryLoad(another_key));
+  EXPECT_EQ(fresh, value_);
+
+  auto r = secondary->put(key_, value_);
+  EXPECT_FALSE(r);
+  EXPECT_EQ(r.error(), DatabaseError::NOT_SUPPORTED);
+}
@@ -0,0 +1,119 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/polkadot_trie/polkadot_trie_diff.hpp"
+
+#include <gtest/gtest.h>
+
+#include "storage/in_memory/in_memory_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using kagome::storage::InMemoryStorage;
+using kagome::storage::trie::BranchNode;
+using kagome::storage::trie::DummyNode;
+using kagome::storage::trie::forEachChangedValue;
+using kagome::storage::trie::PolkadotCodec;
+using kagome::storage::trie::PolkadotTrieFactoryImpl;
+using kagome::storage::trie::RootHash;
+using kagome::storage::trie::TrieSerializerImpl;
+using kagome::storage::trie::TrieStorageBackendImpl;
+
+class PolkadotTrieDiffTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  /// Stores trie with the entries and returns its root
+  RootHash storeTrie(const std::vector<std::pair<Buffer, Buffer>> &entries) {
+    auto trie = factory_->createEmpty();
+    for (auto &[key, value] : entries) {
+      EXPECT_OUTCOME_TRUE_1(trie->put(key, value));
+    }
+    EXPECT_OUTCOME_TRUE(root, serializer_->storeTrie(*trie));
+    return root;
+  }
+
+  std::shared_ptr<PolkadotTrieFactoryImpl> factory_ =
+      std::make_shared<PolkadotTrieFactoryImpl>();
+  std::shared_ptr<TrieSerializerImpl> serializer_ =
+      std::make_shared<TrieSerializerImpl>(
+          factory_,
+          std::make_shared<PolkadotCodec>(),
+          std::make_shared<TrieStorageBackendImpl>(
+              std::make_shared<InMemoryStorage>(), Buffer{}));
+
+  // values are long enough for nodes to be stored by hashes
+  const Buffer v1_ = Buffer(40, 1);
+  const Buffer v2_ = Buffer(40, 2);
+  const Buffer v3_ = Buffer(40, 3);
+  const Buffer v4_ = Buffer(40, 4);
+};
+
+/**
+ * @given two stored tries, differing in a single subtree of the root
+ * @when values of keys from all the subtrees are compared
+ * @then changed and added values are reported, and unchanged subtree is not
+ * loaded from the storage
+ */
+TEST_F(PolkadotTrieDiffTest, SkipsUnchangedSubtree) {
+  std::vector keys{
+      "1100"_hex2buf, "1101"_hex2buf, "2200"_hex2buf, "3300"_hex2buf};
+  auto prev_root = storeTrie(
+      {{keys[0], v1_}, {keys[1], v2_}, {keys[2], v3_}, {"2201"_hex2buf, v1_}});
+  auto next_root = storeTrie({{keys[0], v1_},
+                              {keys[1], v2_},
+                              {keys[2], v4_},
+                              {"2201"_hex2buf, v1_},
+                              {keys[3], v1_}});
+  EXPECT_OUTCOME_TRUE(prev, serializer_->retrieveTrie(Buffer{prev_root}));
+  EXPECT_OUTCOME_TRUE(next, serializer_->retrieveTrie(Buffer{next_root}));
+
+  std::vector<std::pair<size_t, std::optional<Buffer>>> changed;
+  EXPECT_OUTCOME_TRUE_1(forEachChangedValue(
+      *prev, *next, keys, [&](size_t i, const std::optional<Buffer> &value) {
+        changed.emplace_back(i, value);
+      }));
+
+  std::vector<std::pair<size_t, std::optional<Buffer>>> expected{
+      {2, v4_}, {3, v1_}};
+  EXPECT_EQ(changed, expected);
+
+  auto &root = dynamic_cast<const BranchNode &>(*next->getRoot());
+  EXPECT_NE(dynamic_cast<const DummyNode *>(root.children.at(1).get()),
+            nullptr);
+  EXPECT_EQ(dynamic_cast<const DummyNode *>(root.children.at(2).get()),
+            nullptr);
+}
+
+/**
+ * @given two tries, one of which has a key removed and changes structure
+ * @when values of keys are compared
+ * @then removed key is reported with no value, unchanged keys are not reported
+ */
+TEST_F(PolkadotTrieDiffTest, ReportsRemovedValue) {
+  std::vector keys{"1100"_hex2buf, "1101"_hex2buf, "4400"_hex2buf};
+  auto prev_root = storeTrie({{keys[0], v1_}, {keys[1], v2_}});
+  auto next_root = storeTrie({{keys[0], v1_}});
+  EXPECT_OUTCOME_TRUE(prev, serializer_->retrieveTrie(Buffer{prev_root}));
+  EXPECT_OUTCOME_TRUE(next, serializer_->retrieveTrie(Buffer{next_root}));
+
+  std::vector<std::pair<size_t, std::optional<Buffer>>> changed;
+  EXPECT_OUTCOME_TRUE_1(forEachChangedValue(
+      *prev, *next, keys, [&](size_t i, const std::optional<Buffer> &value) {
+        changed.emplace_back(i, value);
+      }));
+
+  std::vector<std::pair<size_t, std::optional<Buffer>>> expected{
+      {1, std::nullopt}};
+  EXPECT_EQ(changed, expected);
+}
@@ -3,10 +3,13 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
+#include "mock/core/storage/changes_trie/changes_tracker_mock.hpp"
 #include "storage/in_memory/in_memory_storage.hpp"
 #include "storage/trie/impl/trie_storage_backend_impl.hpp"
 #include "storage/trie/impl/trie_storage_impl.hpp"
@@ -24,6 +27,8 @@ using kagome::common::Buffer;
 using kagome::common::BufferView;
 using kagome::common::Hash256;
 using kagome::primitives::BlockHash;
+using kagome::storage::changes_trie::ChangesTracker;
+using kagome::storage::changes_trie::ChangesTrackerMock;
 using kagome::storage::face::WriteBatch;
 using kagome::subscription::SubscriptionEngine;
 using testing::_;
@@ -40,9 +45,9 @@ class TrieBatchTest : public test::BaseRocksDB_Test {
 
   void SetUp() override {
     open();
-    auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
-    auto codec = std::make_shared<PolkadotCodec>();
-    auto serializer = std::make_shared<TrieSerializerImpl>(
+    factory = std::make_shared<PolkadotTrieFactoryImpl>();
+    codec = std::make_shared<PolkadotCodec>();
+    serializer = std::make_shared<TrieSerializerImpl>(
         factory,
         codec,
         std::make_shared<TrieStorageBackendImpl>(std::move(db_), kNodePrefix));
@@ -56,6 +61,9 @@ class TrieBatchTest : public test::BaseRocksDB_Test {
 
   static const std::vector<std::pair<Buffer, Buffer>> data;
 
+  std::shared_ptr<PolkadotTrieFactoryImpl> factory;
+  std::shared_ptr<PolkadotCodec> codec;
+  std::shared_ptr<TrieSerializerImpl> serializer;
   std::unique_ptr<TrieStorage> trie;
   RootHash empty_hash;
 
@@ -263,4 +271,62 @@ TEST_F(TrieBatchTest, TopperBatchRemove) {
   ASSERT_FALSE(p_batch->contains("102030"_hex2buf).value());
 }
 
+/**
+ * GIVEN two persistent batches filled with the same sorted entries
+ * WHEN the first one is committed after each put, and the second one only once
+ * THEN both batches have the same root and contain all entries, i.e. filling
+ * a trie in portions (as state sync does) doesn't affect its content
+ */
+TEST_F(TrieBatchTest, CommitInPortions) {
+  auto sorted_data = data;
+  std::sort(sorted_data.begin(), sorted_data.end());
+
+  auto portions_batch = trie->getPersistentBatchAt(empty_hash).value();
+  for (auto &entry : sorted_data) {
+    ASSERT_OUTCOME_SUCCESS_TRY(portions_batch->put(entry.first, entry.second));
+    ASSERT_OUTCOME_SUCCESS_TRY(portions_batch->commit());
+  }
+  ASSERT_OUTCOME_SUCCESS(portions_root, portions_batch->commit());
+
+  auto whole_batch = trie->getPersistentBatchAt(empty_hash).value();
+  FillSmallTrieWithBatch(*whole_batch);
+  ASSERT_OUTCOME_SUCCESS(whole_root, whole_batch->commit());
+
+  ASSERT_EQ(portions_root, whole_root);
+
+  auto read_batch = trie->getEphemeralBatchAt(portions_root).value();
+  for (auto &entry : data) {
+    ASSERT_OUTCOME_SUCCESS(res, read_batch->get(entry.first));
+    ASSERT_EQ(res.get(), entry.second);
+  }
+}
+
+/**
+ * @given a trie storage with a changes tracker
+ * @when entries are put into an untracked persistent batch and committed
+ * @then the tracker is not notified, while the entries are stored as usual
+ */
+TEST_F(TrieBatchTest, UntrackedBatch) {
+  auto tracker = std::make_shared<ChangesTrackerMock>();
+  EXPECT_CALL(*tracker, onPut(_, _, _)).Times(0);
+  EXPECT_CALL(*tracker, onRemove(_)).Times(0);
+  auto tracked_trie =
+      TrieStorageImpl::createEmpty(
+          factory,
+          codec,
+          serializer,
+          std::make_optional<std::shared_ptr<ChangesTracker>>(tracker))
+          .value();
+
+  auto batch = tracked_trie->getUntrackedPersistentBatchAt(empty_hash).value();
+  FillSmallTrieWithBatch(*batch);
+  ASSERT_OUTCOME_SUCCESS(root, batch->commit());
+
+  auto read_batch = tracked_trie->getEphemeralBatchAt(root).value();
+  for (auto &entry : data) {
+    ASSERT_OUTCOME_SUCCESS(res, read_batch->get(entry.first));
+    ASSERT_EQ(res.get(), entry.second);
+  }
+}
+
 // TODO(Harrm): #595 test clearPrefix
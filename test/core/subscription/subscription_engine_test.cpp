@@ -283,3 +283,104 @@ TEST_F(SubscriptionEngineTest, UnsubscribeStreamSub) {
 
   engine_->notify(key, data_1, data_2);
 }
+
+/**
+ * @given a subscription engine with two subscribers of the key
+ * @when the first subscriber unsubscribes the second one while notified
+ * @then notification is delivered to both of them, as it was started before
+ * unsubscription, and the next one is delivered to the first subscriber only
+ */
+TEST_F(SubscriptionEngineTest, UnsubscribeWhileNotified) {
+  std::string_view data_1(test_data);
+  int32_t data_2 = 105;
+
+  SubscriptionTargetMock target_1;
+  SubscriptionTargetMock target_2;
+  auto subscriber_1 = std::make_shared<Subscriber<std::string_view,
+                                                  SubscriptionTargetMock,
+                                                  std::string_view,
+                                                  int32_t>>(engine_);
+  auto subscriber_2 = std::make_shared<Subscriber<std::string_view,
+                                                  SubscriptionTargetMock,
+                                                  std::string_view,
+                                                  int32_t>>(engine_);
+  const auto id_1 = subscriber_1->generateSubscriptionSetId();
+  const auto id_2 = subscriber_2->generateSubscriptionSetId();
+  subscriber_1->subscribe(id_1, key);
+  subscriber_2->subscribe(id_2, key);
+  ASSERT_EQ(engine_->size(key), 2ull);
+
+  subscriber_1->setCallback([&](auto set_id,
+                                auto &,
+                                auto &key,
+                                std::string_view data_1,
+                                int32_t data_2) {
+    target_1.test_call(data_1, data_2);
+    subscriber_2->unsubscribe(id_2);
+  });
+  subscriber_2->setCallback([&](auto set_id,
+                                auto &,
+                                auto &key,
+                                std::string_view data_1,
+                                int32_t data_2) {
+    target_2.test_call(data_1, data_2);
+  });
+
+  EXPECT_CALL(target_1, test_call(data_1, data_2)).Times(2);
+  EXPECT_CALL(target_2, test_call(data_1, data_2)).Times(1);
+
+  engine_->notify(key, data_1, data_2);
+  ASSERT_EQ(engine_->size(key), 1ull);
+
+  engine_->notify(key, data_1, data_2);
+}
+
+/**
+ * @given a subscription engine with a subscriber of the key
+ * @when it subscribes another subscriber to the key while notified
+ * @then the current notification is not delivered to the new subscriber, as
+ * it was started before subscription, and the next one is delivered to both
+ */
+TEST_F(SubscriptionEngineTest, SubscribeWhileNotified) {
+  std::string_view data_1(test_data);
+  int32_t data_2 = 105;
+
+  SubscriptionTargetMock target_1;
+  SubscriptionTargetMock target_2;
+  auto subscriber_1 = std::make_shared<Subscriber<std::string_view,
+                                                  SubscriptionTargetMock,
+                                                  std::string_view,
+                                                  int32_t>>(engine_);
+  auto subscriber_2 = std::make_shared<Subscriber<std::string_view,
+                                                  SubscriptionTargetMock,
+                                                  std::string_view,
+                                                  int32_t>>(engine_);
+  const auto id_1 = subscriber_1->generateSubscriptionSetId();
+  const auto id_2 = subscriber_2->generateSubscriptionSetId();
+  subscriber_1->subscribe(id_1, key);
+  ASSERT_EQ(engine_->size(key), 1ull);
+
+  subscriber_1->setCallback([&](auto set_id,
+                                auto &,
+                                auto &key,
+                                std::string_view data_1,
+                                int32_t data_2) {
+    target_1.test_call(data_1, data_2);
+    subscriber_2->subscribe(id_2, key);
+  });
+  subscriber_2->setCallback([&](auto set_id,
+                                auto &,
+                                auto &key,
+                                std::string_view data_1,
+                                int32_t data_2) {
+    target_2.test_call(data_1, data_2);
+  });
+
+  EXPECT_CALL(target_1, test_call(data_1, data_2)).Times(2);
+  EXPECT_CALL(target_2, test_call(data_1, data_2)).Times(1);
+
+  engine_->notify(key, data_1, data_2);
+  ASSERT_EQ(engine_->size(key), 2ull);
+
+  engine_->notify(key, data_1, data_2);
+}
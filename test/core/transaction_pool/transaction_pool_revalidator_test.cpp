@@ -0,0 +1,198 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "transaction_pool/impl/transaction_pool_revalidator.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include <boost/asio/io_context.hpp>
+#include <gtest/gtest.h>
+
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/runtime/tagged_transaction_queue_mock.hpp"
+#include "mock/core/transaction_pool/transaction_pool_mock.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::application::AppStateManagerMock;
+using kagome::blockchain::BlockTreeMock;
+using kagome::common::Buffer;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::BlockNumber;
+using kagome::primitives::Extrinsic;
+using kagome::primitives::InvalidTransaction;
+using kagome::primitives::Transaction;
+using kagome::primitives::TransactionSource;
+using kagome::primitives::TransactionValidity;
+using kagome::primitives::TransactionValidityError;
+using kagome::primitives::ValidTransaction;
+using kagome::primitives::events::ChainEventType;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::runtime::TaggedTransactionQueueMock;
+using kagome::transaction_pool::TransactionPoolMock;
+using kagome::transaction_pool::TransactionPoolRevalidator;
+using testing::_;
+using testing::InvokeWithoutArgs;
+using testing::Return;
+
+struct TransactionPoolRevalidatorTest : ::testing::Test {
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    auto app_state_manager = std::make_shared<AppStateManagerMock>();
+    EXPECT_CALL(*app_state_manager, atPrepare(_)).WillOnce(Return());
+    EXPECT_CALL(*app_state_manager, atLaunch(_)).WillOnce(Return());
+    EXPECT_CALL(*app_state_manager, atShutdown(_)).WillOnce(Return());
+    EXPECT_CALL(*block_tree_, deepestLeaf()).WillRepeatedly([this] {
+      return best_block_;
+    });
+
+    TransactionPoolRevalidator::Config config;
+    config.threads = 1;
+    revalidator_ = std::make_shared<TransactionPoolRevalidator>(
+        app_state_manager,
+        pool_,
+        ttq_,
+        block_tree_,
+        chain_sub_engine_,
+        main_context_,
+        config);
+    ASSERT_TRUE(revalidator_->prepare());
+    ASSERT_TRUE(revalidator_->start());
+  }
+
+  void TearDown() override {
+    revalidator_->stop();
+  }
+
+  /// Announces new best block with number {@param number}
+  void newHead(BlockNumber number) {
+    BlockHeader header;
+    header.number = number;
+    best_block_ = BlockInfo{number, {}};
+    best_block_.hash[0] = number;
+    chain_sub_engine_->notify(ChainEventType::kNewHeads, header);
+  }
+
+  /// Runs handlers posted to the main context until {@param done} is true
+  void runMainUntil(const std::function<bool()> &done) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (not done()) {
+      ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+      main_context_->restart();
+      main_context_->run_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  static std::shared_ptr<const Transaction> makeTx(uint8_t id,
+                                                   TransactionSource source) {
+    auto tx = std::make_shared<Transaction>();
+    tx->ext = Extrinsic{Buffer{id}};
+    tx->hash[0] = id;
+    tx->source = source;
+    return tx;
+  }
+
+  std::shared_ptr<TransactionPoolMock> pool_ =
+      std::make_shared<TransactionPoolMock>();
+  std::shared_ptr<TaggedTransactionQueueMock> ttq_ =
+      std::make_shared<TaggedTransactionQueueMock>();
+  std::shared_ptr<BlockTreeMock> block_tree_ =
+      std::make_shared<BlockTreeMock>();
+  std::shared_ptr<ChainSubscriptionEngine> chain_sub_engine_ =
+      std::make_shared<ChainSubscriptionEngine>();
+  std::shared_ptr<boost::asio::io_context> main_context_ =
+      std::make_shared<boost::asio::io_context>();
+  std::shared_ptr<TransactionPoolRevalidator> revalidator_;
+
+  // accessed on the main context only
+  BlockInfo best_block_;
+};
+
+/**
+ * @given pooled transactions submitted locally and received from network
+ * @when new best block appears
+ * @then each transaction is revalidated as coming from its original source,
+ * and results are applied to the pool on the main context
+ */
+TEST_F(TransactionPoolRevalidatorTest, RevalidatesWithOriginalSource) {
+  auto local = makeTx(1, TransactionSource::Local);
+  auto external = makeTx(2, TransactionSource::External);
+  EXPECT_CALL(*pool_, getTransactionsToRevalidate(_))
+      .WillOnce(Return(std::vector{local, external}));
+  EXPECT_CALL(*ttq_, validate_transaction(TransactionSource::Local, local->ext))
+      .WillOnce(Return(TransactionValidity{ValidTransaction{}}));
+  EXPECT_CALL(*ttq_,
+              validate_transaction(TransactionSource::External, external->ext))
+      .WillOnce(Return(TransactionValidity{
+          TransactionValidityError{InvalidTransaction::Stale}}));
+
+  std::vector<std::thread::id> applied_on;
+  auto record_thread = [&] {
+    applied_on.emplace_back(std::this_thread::get_id());
+  };
+  EXPECT_CALL(*pool_, onRevalidated(local->hash, _))
+      .WillOnce(InvokeWithoutArgs(record_thread));
+  EXPECT_CALL(*pool_, onRevalidated(external->hash, _))
+      .WillOnce(InvokeWithoutArgs(record_thread));
+
+  newHead(1);
+  runMainUntil([&] { return applied_on.size() == 2; });
+
+  for (auto &id : applied_on) {
+    EXPECT_EQ(id, std::this_thread::get_id());
+  }
+}
+
+/**
+ * @given revalidation round in progress
+ * @when several new best blocks appear during the round
+ * @then they are served by a single next round, started once the results of
+ * the current one are applied
+ */
+TEST_F(TransactionPoolRevalidatorTest, PendingRoundsAreCoalesced) {
+  auto tx = makeTx(1, TransactionSource::External);
+  EXPECT_CALL(*pool_, getTransactionsToRevalidate(_))
+      .Times(2)
+      .WillRepeatedly(Return(std::vector{tx}));
+
+  std::atomic_bool started{false};
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  EXPECT_CALL(*ttq_, validate_transaction(_, _))
+      .WillOnce([&](auto, auto &) {
+        started = true;
+        released.wait();
+        return TransactionValidity{ValidTransaction{}};
+      })
+      .WillOnce(Return(TransactionValidity{ValidTransaction{}}));
+
+  size_t applied = 0;
+  EXPECT_CALL(*pool_, onRevalidated(tx->hash, _))
+      .Times(2)
+      .WillRepeatedly(InvokeWithoutArgs([&] { ++applied; }));
+
+  newHead(1);
+  runMainUntil([&] { return started.load(); });
+
+  newHead(2);
+  newHead(3);
+  newHead(4);
+  main_context_->restart();
+  main_context_->poll();
+
+  release.set_value();
+  runMainUntil([&] { return applied == 2; });
+
+  // No more rounds are started, as the best block is the same
+  main_context_->restart();
+  main_context_->poll();
+}
@@ -5,6 +5,11 @@
 
 #include "transaction_pool/impl/transaction_pool_impl.hpp"
 
+#include <atomic>
+#include <random>
+#include <set>
+#include <thread>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "mock/core/blockchain/block_header_repository_mock.hpp"
@@ -28,9 +33,12 @@ using kagome::runtime::TaggedTransactionQueueMock;
 using kagome::subscription::ExtrinsicEventKeyRepository;
 using kagome::transaction_pool::PoolModerator;
 using kagome::transaction_pool::PoolModeratorMock;
+using kagome::transaction_pool::TransactionPool;
 using kagome::transaction_pool::TransactionPoolError;
 using kagome::transaction_pool::TransactionPoolImpl;
 
+using testing::_;
+using testing::Invoke;
 using testing::NiceMock;
 using testing::Return;
 
@@ -43,8 +51,15 @@ class TransactionPoolTest : public testing::Test {
   }
 
   void SetUp() override {
-    auto ttq = std::make_shared<TaggedTransactionQueueMock>();
-    auto hasher = std::make_shared<HasherMock>();
+    pool_ = makePool(TransactionPoolImpl::Limits{3, 4});
+  }
+
+ protected:
+  static std::shared_ptr<TransactionPoolImpl> makePool(
+      TransactionPoolImpl::Limits limits,
+      std::shared_ptr<TaggedTransactionQueueMock> ttq =
+          std::make_shared<TaggedTransactionQueueMock>(),
+      std::shared_ptr<HasherMock> hasher = std::make_shared<HasherMock>()) {
     auto tx_transmitter = std::make_shared<TransactionsTransmitterMock>();
     auto moderator = std::make_unique<NiceMock<PoolModeratorMock>>();
     auto header_repo = std::make_unique<BlockHeaderRepositoryMock>();
@@ -52,7 +67,7 @@ class TransactionPoolTest : public testing::Test {
     auto extrinsic_event_key_repo =
         std::make_unique<ExtrinsicEventKeyRepository>();
 
-    pool_ = std::make_shared<TransactionPoolImpl>(
+    return std::make_shared<TransactionPoolImpl>(
         std::move(ttq),
         std::move(hasher),
         std::move(tx_transmitter),
@@ -60,10 +75,9 @@ class TransactionPoolTest : public testing::Test {
         std::move(header_repo),
         std::move(engine),
         std::move(extrinsic_event_key_repo),
-        TransactionPoolImpl::Limits{3, 4});
+        limits);
   }
 
- protected:
   std::shared_ptr<TransactionPoolImpl> pool_;
 };
 
@@ -161,3 +175,244 @@ TEST_F(TransactionPoolTest, CorrectRemoveTx) {
     EXPECT_EQ(outcome.error(), TransactionPoolError::TX_NOT_FOUND);
   }
 }
+
+/**
+ * @given transaction pool with ready transactions of different priorities,
+ * one of which requires tag provided by transaction with lower priority
+ * @when ready transactions are visited
+ * @then they are visited by descending priority and in order of import for
+ * equal priority, and dependent transaction goes right after its provider
+ * is taken, or isn't visited at all if its provider is skipped
+ */
+TEST_F(TransactionPoolTest, ReadyInPriorityOrder) {
+  auto pool = makePool(TransactionPoolImpl::Limits{10, 10});
+  std::vector<Transaction> txs{makeTx("01"_hash256, {{1}}, {}),
+                               makeTx("02"_hash256, {{2}}, {{1}}),
+                               makeTx("03"_hash256, {{3}}, {}),
+                               makeTx("04"_hash256, {{4}}, {})};
+  txs[0].priority = 1;
+  txs[1].priority = 10;
+  txs[2].priority = 5;
+  txs[3].priority = 5;
+  EXPECT_OUTCOME_TRUE_1(submit(*pool, txs));
+  ASSERT_EQ(pool->getStatus().ready_num, 4);
+
+  auto visit = [&](std::optional<Transaction::Hash> skip) {
+    std::vector<Transaction::Hash> visited;
+    pool->forEachReadyTransaction([&](const auto &tx) {
+      visited.push_back(tx->hash);
+      return tx->hash == skip ? TransactionPool::Visit::SKIPPED
+                              : TransactionPool::Visit::TAKEN;
+    });
+    return visited;
+  };
+
+  EXPECT_EQ(visit(std::nullopt),
+            (std::vector{"03"_hash256, "04"_hash256, "01"_hash256,
+                         "02"_hash256}));
+  EXPECT_EQ(visit("01"_hash256),
+            (std::vector{"03"_hash256, "04"_hash256, "01"_hash256}));
+
+  EXPECT_OUTCOME_TRUE_1(pool->removeOne("03"_hash256));
+  EXPECT_EQ(visit(std::nullopt),
+            (std::vector{"04"_hash256, "01"_hash256, "02"_hash256}));
+}
+
+/**
+ * @given transaction pool with ready transactions
+ * @when other thread changes the pool while ready transactions are visited
+ * @then it is not blocked by visiting, and visiting goes over transactions
+ * being ready at its start
+ */
+TEST_F(TransactionPoolTest, VisitingDoesNotLockPool) {
+  auto pool = makePool(TransactionPoolImpl::Limits{10, 10});
+  EXPECT_OUTCOME_TRUE_1(submit(*pool,
+                               {makeTx("01"_hash256, {{1}}, {}),
+                                makeTx("02"_hash256, {{2}}, {{1}})}));
+
+  std::vector<Transaction::Hash> visited;
+  pool->forEachReadyTransaction([&](const auto &tx) {
+    visited.push_back(tx->hash);
+    if (visited.size() == 1) {
+      std::thread([&] {
+        EXPECT_OUTCOME_TRUE_1(pool->removeOne("02"_hash256));
+        EXPECT_OUTCOME_TRUE_1(pool->submitOne(makeTx("03"_hash256, {}, {})));
+      }).join();
+    }
+    return TransactionPool::Visit::TAKEN;
+  });
+
+  EXPECT_EQ(visited, (std::vector{"01"_hash256, "02"_hash256}));
+  EXPECT_EQ(pool->getStatus().ready_num, 2);
+}
+
+/**
+ * @given transaction pool with ready transactions of random priorities
+ * @when the best ones are visited, while the pool is being changed between
+ * visits
+ * @then only the requested number of transactions is visited, and they have
+ * the highest priorities in the pool
+ */
+TEST_F(TransactionPoolTest, BestOfManyReady) {
+  constexpr size_t kPooled = 2000;
+  constexpr size_t kBest = 100;
+  auto pool = makePool(TransactionPoolImpl::Limits{kPooled, kPooled});
+
+  std::mt19937_64 random{42};
+  std::multiset<Transaction::Priority, std::greater<>> priorities;
+  for (size_t i = 0; i < kPooled; ++i) {
+    Hash256 hash;
+    std::copy_n(reinterpret_cast<const uint8_t *>(&i), sizeof(i), hash.data());
+    auto tx = makeTx(hash, {}, {});
+    tx.priority = random() % kPooled;
+    priorities.emplace(tx.priority);
+    EXPECT_OUTCOME_TRUE_1(pool->submitOne(std::move(tx)));
+  }
+  ASSERT_EQ(pool->getStatus().ready_num, kPooled);
+
+  auto check_best = [&] {
+    std::vector<Transaction::Priority> visited;
+    pool->forEachReadyTransaction([&](const auto &tx) {
+      visited.push_back(tx->priority);
+      return visited.size() < kBest ? TransactionPool::Visit::TAKEN
+                                    : TransactionPool::Visit::STOP;
+    });
+    ASSERT_EQ(visited.size(), kBest);
+    EXPECT_TRUE(std::equal(visited.begin(), visited.end(), priorities.begin()));
+  };
+
+  check_best();
+
+  // the best ones are included to a block and removed from the pool
+  std::vector<std::pair<Transaction::Hash, Transaction::Priority>> best;
+  pool->forEachReadyTransaction([&](const auto &tx) {
+    best.emplace_back(tx->hash, tx->priority);
+    return best.size() < kBest ? TransactionPool::Visit::TAKEN
+                               : TransactionPool::Visit::STOP;
+  });
+  for (auto &[hash, priority] : best) {
+    EXPECT_OUTCOME_TRUE_1(pool->removeOne(hash));
+    priorities.erase(priorities.find(priority));
+  }
+
+  check_best();
+}
+
+/**
+ * @given transaction pool with transaction, which depends on other one
+ * @when the other one is removed from the pool, as included to a block
+ * @then the dependent transaction is revalidated first, and once its
+ * requirement is known to be satisfied by the chain, it becomes ready
+ */
+TEST_F(TransactionPoolTest, RevalidateTouchedFirst) {
+  auto pool = makePool(TransactionPoolImpl::Limits{10, 10});
+  EXPECT_OUTCOME_TRUE_1(submit(*pool,
+                               {makeTx("01"_hash256, {{3}}, {}),
+                                makeTx("02"_hash256, {{1}}, {}),
+                                makeTx("03"_hash256, {{2}}, {{1}})}));
+  ASSERT_EQ(pool->getStatus().ready_num, 3);
+
+  EXPECT_OUTCOME_TRUE_1(pool->removeOne("02"_hash256));
+  EXPECT_EQ(pool->getStatus().ready_num, 1);
+
+  auto txs = pool->getTransactionsToRevalidate(1);
+  ASSERT_EQ(txs.size(), 1);
+  EXPECT_EQ(txs[0]->hash, "03"_hash256);
+
+  kagome::primitives::ValidTransaction valid;
+  valid.priority = 1;
+  valid.provides = {{2}};
+  pool->onRevalidated("03"_hash256, valid);
+  EXPECT_EQ(pool->getStatus().ready_num, 2);
+  EXPECT_EQ(pool->getStatus().waiting_num, 0);
+
+  // the rest are revalidated in round-robin order
+  txs = pool->getTransactionsToRevalidate(10);
+  EXPECT_EQ(txs.size(), 2);
+}
+
+/**
+ * @given transaction pool with transactions
+ * @when revalidation finds one of them invalid and validity of other one
+ * unknown
+ * @then the invalid one is removed, and the other one is kept
+ */
+TEST_F(TransactionPoolTest, RevalidationRemovesInvalid) {
+  using kagome::primitives::InvalidTransaction;
+  using kagome::primitives::TransactionValidityError;
+  using kagome::primitives::UnknownTransaction;
+
+  EXPECT_OUTCOME_TRUE_1(submit(
+      *pool_,
+      {makeTx("01"_hash256, {{1}}, {}), makeTx("02"_hash256, {{2}}, {})}));
+  ASSERT_EQ(pool_->getStatus().ready_num, 2);
+
+  pool_->onRevalidated("01"_hash256,
+                       TransactionValidityError{InvalidTransaction::Stale});
+  pool_->onRevalidated(
+      "02"_hash256, TransactionValidityError{UnknownTransaction::CannotLookup});
+
+  EXPECT_EQ(pool_->getStatus().ready_num, 1);
+  EXPECT_EQ(pool_->getPendingTransactions().count("01"_hash256), 0);
+  EXPECT_EQ(pool_->getPendingTransactions().count("02"_hash256), 1);
+}
+
+/**
+ * @given transaction pool
+ * @when many threads submit extrinsics concurrently, and each extrinsic is
+ * submitted by two threads
+ * @then each extrinsic is imported once, and another submission of it is
+ * rejected as duplicate
+ */
+TEST_F(TransactionPoolTest, ConcurrentSubmission) {
+  using kagome::primitives::TransactionSource;
+  using kagome::primitives::TransactionValidity;
+  using kagome::primitives::ValidTransaction;
+
+  constexpr size_t kThreads = 4;
+  constexpr size_t kExtrinsics = 1000;
+
+  auto ttq = std::make_shared<TaggedTransactionQueueMock>();
+  EXPECT_CALL(*ttq, validate_transaction(_, _))
+      .WillRepeatedly(Return(TransactionValidity{ValidTransaction{}}));
+  auto hasher = std::make_shared<HasherMock>();
+  EXPECT_CALL(*hasher, blake2b_256(_)).WillRepeatedly(Invoke([](auto data) {
+    Hash256 hash;
+    std::copy_n(data.begin(), std::min<size_t>(data.size(), hash.size()),
+                hash.begin());
+    return hash;
+  }));
+  auto pool = makePool(TransactionPoolImpl::Limits{kExtrinsics, kExtrinsics},
+                       ttq,
+                       hasher);
+
+  std::atomic_size_t imported = 0;
+  std::atomic_size_t duplicates = 0;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (size_t i = 0; i < kExtrinsics; ++i) {
+        if (i % kThreads != t and i % kThreads != (t + 1) % kThreads) {
+          continue;
+        }
+        Buffer data;
+        data.putUint64(i);
+        auto res = pool->submitExtrinsic(TransactionSource::External,
+                                         {std::move(data)});
+        if (res.has_value()) {
+          ++imported;
+        } else if (res.error() == TransactionPoolError::TX_ALREADY_IMPORTED) {
+          ++duplicates;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(imported, kExtrinsics);
+  EXPECT_EQ(duplicates, kExtrinsics);
+  EXPECT_EQ(pool->getStatus().ready_num, kExtrinsics);
+  EXPECT_EQ(pool->getPendingTransactions().size(), kExtrinsics);
+}
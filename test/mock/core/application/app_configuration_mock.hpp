@@ -89,6 +89,14 @@ namespace kagome::application {
 
     MOCK_METHOD(uint32_t, maxWsConnections, (), (const, override));
 
+    MOCK_METHOD(uint32_t, rpcMaxConcurrentCalls, (), (const, override));
+
+    using MethodLimits = std::unordered_map<std::string, uint32_t>;
+    MOCK_METHOD(const MethodLimits &,
+                rpcMethodConcurrentCalls,
+                (),
+                (const, override));
+
     MOCK_METHOD(std::chrono::seconds,
                 getRandomWalkInterval,
                 (),
@@ -139,6 +147,11 @@ namespace kagome::application {
                 (),
                 (const, override));
 
+    MOCK_METHOD(std::optional<boost::filesystem::path>,
+                dbSecondaryPath,
+                (),
+                (const, override));
+
     MOCK_METHOD(uint32_t, outPeers, (), (const, override));
 
     MOCK_METHOD(uint32_t, inPeers, (), (const, override));
@@ -17,7 +17,8 @@ namespace kagome::authorship {
                 propose,
                 (const primitives::BlockInfo &,
                  const primitives::InherentData &,
-                 const primitives::Digest &),
+                 const primitives::Digest &,
+                 std::chrono::milliseconds),
                 (override));
   };
 }  // namespace kagome::authorship
@@ -76,6 +76,12 @@ namespace kagome::blockchain {
                  const primitives::Justification &),
                 (override));
 
+    MOCK_METHOD(outcome::result<void>,
+                resetToFinalized,
+                (const primitives::BlockHeader &,
+                 const primitives::Justification &),
+                (override));
+
     MOCK_METHOD(BlockHashVecRes,
                 getChainByBlock,
                 (const primitives::BlockHash &),
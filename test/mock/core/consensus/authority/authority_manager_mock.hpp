@@ -53,6 +53,12 @@ namespace kagome::authority {
 
     MOCK_METHOD(void, prune, (const primitives::BlockInfo &block), (override));
 
+    MOCK_METHOD(outcome::result<void>,
+                warp,
+                (const primitives::BlockInfo &,
+                 const primitives::AuthoritySet &),
+                (override));
+
     MOCK_METHOD(outcome::result<void>,
                 recalculateStoredState,
                 (primitives::BlockNumber last_finalized_number));
@@ -25,7 +25,7 @@ namespace kagome::consensus::grandpa {
                  const network::GrandpaNeighborMessage &msg),
                 (override));
 
-    MOCK_METHOD(void,
+    MOCK_METHOD(bool,
                 onVoteMessage,
                 (const PeerId &peer_id, const VoteMessage &),
                 (override));
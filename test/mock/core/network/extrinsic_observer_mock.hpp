@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_EXTRINSICOBSERVERMOCK
+#define KAGOME_NETWORK_EXTRINSICOBSERVERMOCK
+
+#include "network/extrinsic_observer.hpp"
+
+#include <gmock/gmock.h>
+
+#include "primitives/extrinsic.hpp"
+#include "primitives/transaction.hpp"
+
+namespace kagome::network {
+
+  class ExtrinsicObserverMock : public ExtrinsicObserver {
+   public:
+    MOCK_METHOD(outcome::result<common::Hash256>,
+                onTxMessage,
+                (const primitives::Extrinsic &),
+                (override));
+
+    MOCK_METHOD(outcome::result<primitives::Transaction>,
+                validateTx,
+                (const primitives::Extrinsic &),
+                (override));
+
+    MOCK_METHOD(outcome::result<common::Hash256>,
+                submitTx,
+                (primitives::Transaction),
+                ());
+    outcome::result<common::Hash256> submitTx(
+        primitives::Transaction &&tx) override {
+      return submitTx(tx);
+    }
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_EXTRINSICOBSERVERMOCK
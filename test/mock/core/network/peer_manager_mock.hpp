@@ -56,6 +56,11 @@ namespace kagome::network {
                 (const PeerId &),
                 (override));
 
+    MOCK_METHOD(std::optional<PeerStats>,
+                getPeerStats,
+                (const PeerId &),
+                (const, override));
+
     MOCK_METHOD(size_t, activePeersNumber, (), (const, override));
 
     MOCK_METHOD(void,
@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_PEERSCORINGMOCK
+#define KAGOME_NETWORK_PEERSCORINGMOCK
+
+#include <gmock/gmock.h>
+
+#include "network/peer_scoring.hpp"
+
+namespace kagome::network {
+
+  class PeerScoringMock : public PeerScoring {
+   public:
+    MOCK_METHOD(void, addPeer, (const PeerId &), (override));
+
+    MOCK_METHOD(void, removePeer, (const PeerId &), (override));
+
+    MOCK_METHOD(void,
+                onResponse,
+                (const PeerId &,
+                 const std::string &,
+                 std::chrono::milliseconds,
+                 size_t),
+                (override));
+
+    MOCK_METHOD(void,
+                onRequestFailed,
+                (const PeerId &, const std::string &),
+                (override));
+
+    MOCK_METHOD(void,
+                onMessage,
+                (const PeerId &, const std::string &, bool),
+                (override));
+
+    MOCK_METHOD(std::optional<double>,
+                score,
+                (const PeerId &),
+                (const, override));
+
+    MOCK_METHOD(std::optional<double>,
+                throughput,
+                (const PeerId &, const std::string &),
+                (const, override));
+
+    MOCK_METHOD(std::optional<PeerStats>,
+                stats,
+                (const PeerId &),
+                (const, override));
+
+    MOCK_METHOD(std::optional<PeerId>, worstPeer, (), (const, override));
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_PEERSCORINGMOCK
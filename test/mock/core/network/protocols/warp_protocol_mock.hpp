@@ -0,0 +1,35 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_NETWORK_WARPPROTOCOLMOCK
+#define KAGOME_NETWORK_WARPPROTOCOLMOCK
+
+#include "mock/core/network/protocol_base_mock.hpp"
+#include "network/protocols/warp_protocol.hpp"
+
+#include <gmock/gmock.h>
+
+namespace kagome::network {
+
+  class WarpProtocolMock : public WarpProtocol, public ProtocolBaseMock {
+   public:
+    MOCK_METHOD(void,
+                request,
+                (const PeerId &,
+                 WarpRequest,
+                 const std::function<void(outcome::result<WarpSyncProof>)> &));
+
+    void request(const PeerId &peer_id,
+                 WarpRequest request,
+                 std::function<void(outcome::result<WarpSyncProof>)>
+                     &&response_handler) override {
+      const auto h = std::move(response_handler);
+      this->request(peer_id, std::move(request), h);
+    }
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_NETWORK_WARPPROTOCOLMOCK
@@ -49,6 +49,11 @@ namespace kagome::network {
                 (),
                 (const, override));
 
+    MOCK_METHOD(std::shared_ptr<WarpProtocol>,
+                getWarpProtocol,
+                (),
+                (const, override));
+
     MOCK_METHOD(std::shared_ptr<GrandpaProtocol>,
                 getGrandpaProtocol,
                 (),
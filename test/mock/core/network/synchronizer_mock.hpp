@@ -68,6 +68,16 @@ namespace kagome::network {
     }
 
     MOCK_METHOD(bool, hasIncompleteRequestOfStateSync, (), (const));
+
+    MOCK_METHOD(void,
+                syncWarp,
+                (const libp2p::peer::PeerId &, const SyncResultHandler &),
+                ());
+
+    void syncWarp(const libp2p::peer::PeerId &peer_id,
+                  SyncResultHandler &&handler) override {
+      return syncWarp(peer_id, handler);
+    }
   };
 
 }  // namespace kagome::network
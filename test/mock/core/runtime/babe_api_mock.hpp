@@ -16,7 +16,17 @@ namespace kagome::runtime {
    public:
     MOCK_METHOD(outcome::result<primitives::BabeConfiguration>,
                 configuration,
-                (),
+                (primitives::BlockHash const &),
+                (override));
+
+    MOCK_METHOD(outcome::result<primitives::Epoch>,
+                current_epoch,
+                (primitives::BlockHash const &),
+                (override));
+
+    MOCK_METHOD(outcome::result<primitives::Epoch>,
+                next_epoch,
+                (primitives::BlockHash const &),
                 (override));
   };
 
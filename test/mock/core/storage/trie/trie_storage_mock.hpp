@@ -19,6 +19,11 @@ namespace kagome::storage::trie {
                 (const storage::trie::RootHash &root),
                 (override));
 
+    MOCK_METHOD(outcome::result<std::unique_ptr<PersistentTrieBatch>>,
+                getUntrackedPersistentBatchAt,
+                (const storage::trie::RootHash &root),
+                (override));
+
     MOCK_METHOD(outcome::result<std::unique_ptr<EphemeralTrieBatch>>,
                 getEphemeralBatchAt,
                 (const storage::trie::RootHash &root),
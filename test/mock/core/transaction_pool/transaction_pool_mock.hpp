@@ -15,16 +15,25 @@ namespace kagome::transaction_pool {
   class TransactionPoolMock : public TransactionPool {
    public:
     MOCK_METHOD(
-        (std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>> &),
+        (std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>),
         getPendingTransactions,
         (),
-        (const));
+        (const, override));
 
     MOCK_METHOD(outcome::result<Transaction::Hash>,
                 submitExtrinsic,
                 (primitives::TransactionSource, primitives::Extrinsic),
                 (override));
 
+    MOCK_METHOD(outcome::result<Transaction::Hash>,
+                submitTransaction,
+                (Transaction),
+                ());
+    outcome::result<Transaction::Hash> submitTransaction(
+        Transaction &&tx) override {
+      return submitTransaction(tx);
+    }
+
     MOCK_METHOD(outcome::result<void>, submitOne, (Transaction), ());
     outcome::result<void> submitOne(Transaction &&tx) override {
       return submitOne(tx);
@@ -44,11 +53,27 @@ namespace kagome::transaction_pool {
                 (),
                 (const));
 
+    MOCK_METHOD(void,
+                forEachReadyTransaction,
+                (const ReadyTransactionVisitor &),
+                (const, override));
+
     MOCK_METHOD(outcome::result<std::vector<Transaction>>,
                 removeStale,
                 (const primitives::BlockId &),
                 (override));
 
+    MOCK_METHOD(std::vector<std::shared_ptr<const Transaction>>,
+                getTransactionsToRevalidate,
+                (size_t),
+                (override));
+
+    MOCK_METHOD(void,
+                onRevalidated,
+                (const Transaction::Hash &,
+                 const primitives::TransactionValidity &),
+                (override));
+
     MOCK_METHOD(Status, getStatus, (), (const, override));
 
     MOCK_METHOD(outcome::result<primitives::Transaction>,